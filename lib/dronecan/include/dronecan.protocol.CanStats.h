@@ -91,7 +91,7 @@ bool dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_protocol_CanStats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_protocol_CanStats* msg, bool tao);
-static inline bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_protocol_CanStats* msg, bool tao);
+static inline bool _dronecan_protocol_CanStats_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_protocol_CanStats* msg, bool tao);
 void _dronecan_protocol_CanStats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_protocol_CanStats* msg, bool tao) {
 
     (void)buffer;
@@ -207,9 +207,9 @@ void _dronecan_protocol_CanStats_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode dronecan_protocol_CanStats, return true on failure, false on success
 */
-bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_protocol_CanStats* msg, bool tao) {
+bool _dronecan_protocol_CanStats_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_protocol_CanStats* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -218,7 +218,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->interface);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->interface);
 
     *bit_ofs += 8;
 
@@ -228,7 +228,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->tx_requests);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->tx_requests);
 
     *bit_ofs += 32;
 
@@ -238,7 +238,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->tx_rejected);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->tx_rejected);
 
     *bit_ofs += 16;
 
@@ -248,7 +248,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->tx_overflow);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->tx_overflow);
 
     *bit_ofs += 16;
 
@@ -258,7 +258,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->tx_success);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->tx_success);
 
     *bit_ofs += 16;
 
@@ -268,7 +268,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->tx_timedout);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->tx_timedout);
 
     *bit_ofs += 16;
 
@@ -278,7 +278,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->tx_abort);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->tx_abort);
 
     *bit_ofs += 16;
 
@@ -288,7 +288,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->rx_received);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->rx_received);
 
     *bit_ofs += 32;
 
@@ -298,7 +298,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_overflow);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_overflow);
 
     *bit_ofs += 16;
 
@@ -308,7 +308,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_errors);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_errors);
 
     *bit_ofs += 16;
 
@@ -318,7 +318,7 @@ bool _dronecan_protocol_CanStats_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->busoff_errors);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->busoff_errors);
 
     *bit_ofs += 16;
 
@@ -63,7 +63,7 @@ bool dronecan_protocol_FlexDebug_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_protocol_FlexDebug_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_protocol_FlexDebug* msg, bool tao);
-static inline bool _dronecan_protocol_FlexDebug_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_protocol_FlexDebug* msg, bool tao);
+static inline bool _dronecan_protocol_FlexDebug_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_protocol_FlexDebug* msg, bool tao);
 void _dronecan_protocol_FlexDebug_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_protocol_FlexDebug* msg, bool tao) {
 
     (void)buffer;
@@ -120,9 +120,9 @@ void _dronecan_protocol_FlexDebug_encode(uint8_t* buffer, uint32_t* bit_ofs, str
 /*
  decode dronecan_protocol_FlexDebug, return true on failure, false on success
 */
-bool _dronecan_protocol_FlexDebug_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_protocol_FlexDebug* msg, bool tao) {
+bool _dronecan_protocol_FlexDebug_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_protocol_FlexDebug* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -131,7 +131,7 @@ bool _dronecan_protocol_FlexDebug_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->id);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->id);
 
     *bit_ofs += 16;
 
@@ -145,14 +145,14 @@ bool _dronecan_protocol_FlexDebug_decode(const CanardRxTransfer* transfer, uint3
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->u8.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->u8.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->u8.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->u8.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -170,7 +170,7 @@ bool _dronecan_protocol_FlexDebug_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->u8.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->u8.data[i]);
 
         *bit_ofs += 8;
 
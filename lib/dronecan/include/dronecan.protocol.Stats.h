@@ -95,7 +95,7 @@ bool dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, struct dro
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_protocol_Stats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_protocol_Stats* msg, bool tao);
-static inline bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_protocol_Stats* msg, bool tao);
+static inline bool _dronecan_protocol_Stats_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_protocol_Stats* msg, bool tao);
 void _dronecan_protocol_Stats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_protocol_Stats* msg, bool tao) {
 
     (void)buffer;
@@ -220,9 +220,9 @@ void _dronecan_protocol_Stats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode dronecan_protocol_Stats, return true on failure, false on success
 */
-bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_protocol_Stats* msg, bool tao) {
+bool _dronecan_protocol_Stats_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_protocol_Stats* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -231,7 +231,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->tx_frames);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->tx_frames);
 
     *bit_ofs += 32;
 
@@ -241,7 +241,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->tx_errors);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->tx_errors);
 
     *bit_ofs += 16;
 
@@ -251,7 +251,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->rx_frames);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->rx_frames);
 
     *bit_ofs += 32;
 
@@ -261,7 +261,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_error_oom);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_error_oom);
 
     *bit_ofs += 16;
 
@@ -271,7 +271,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_error_internal);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_error_internal);
 
     *bit_ofs += 16;
 
@@ -281,7 +281,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_error_missed_start);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_error_missed_start);
 
     *bit_ofs += 16;
 
@@ -291,7 +291,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_error_wrong_toggle);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_error_wrong_toggle);
 
     *bit_ofs += 16;
 
@@ -301,7 +301,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_error_short_frame);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_error_short_frame);
 
     *bit_ofs += 16;
 
@@ -311,7 +311,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_error_bad_crc);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_error_bad_crc);
 
     *bit_ofs += 16;
 
@@ -321,7 +321,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_ignored_wrong_address);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_ignored_wrong_address);
 
     *bit_ofs += 16;
 
@@ -331,7 +331,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_ignored_not_wanted);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_ignored_not_wanted);
 
     *bit_ofs += 16;
 
@@ -341,7 +341,7 @@ bool _dronecan_protocol_Stats_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->rx_ignored_unexpected_tid);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->rx_ignored_unexpected_tid);
 
     *bit_ofs += 16;
 
@@ -61,7 +61,7 @@ bool dronecan_remoteid_ArmStatus_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_ArmStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_ArmStatus* msg, bool tao);
-static inline bool _dronecan_remoteid_ArmStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_ArmStatus* msg, bool tao);
+static inline bool _dronecan_remoteid_ArmStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_ArmStatus* msg, bool tao);
 void _dronecan_remoteid_ArmStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_ArmStatus* msg, bool tao) {
 
     (void)buffer;
@@ -118,9 +118,9 @@ void _dronecan_remoteid_ArmStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, str
 /*
  decode dronecan_remoteid_ArmStatus, return true on failure, false on success
 */
-bool _dronecan_remoteid_ArmStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_ArmStatus* msg, bool tao) {
+bool _dronecan_remoteid_ArmStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_ArmStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -129,7 +129,7 @@ bool _dronecan_remoteid_ArmStatus_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->status);
 
     *bit_ofs += 8;
 
@@ -143,14 +143,14 @@ bool _dronecan_remoteid_ArmStatus_decode(const CanardRxTransfer* transfer, uint3
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->error.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->error.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->error.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->error.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -168,7 +168,7 @@ bool _dronecan_remoteid_ArmStatus_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->error.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->error.data[i]);
 
         *bit_ofs += 8;
 
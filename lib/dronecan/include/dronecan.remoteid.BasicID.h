@@ -107,7 +107,7 @@ bool dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, struct d
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_BasicID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_BasicID* msg, bool tao);
-static inline bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_BasicID* msg, bool tao);
+static inline bool _dronecan_remoteid_BasicID_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_BasicID* msg, bool tao);
 void _dronecan_remoteid_BasicID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_BasicID* msg, bool tao) {
 
     (void)buffer;
@@ -198,9 +198,9 @@ void _dronecan_remoteid_BasicID_encode(uint8_t* buffer, uint32_t* bit_ofs, struc
 /*
  decode dronecan_remoteid_BasicID, return true on failure, false on success
 */
-bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_BasicID* msg, bool tao) {
+bool _dronecan_remoteid_BasicID_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_BasicID* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -210,7 +210,7 @@ bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->id_or_mac.len);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->id_or_mac.len);
     *bit_ofs += 5;
 
 
@@ -225,7 +225,7 @@ bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
 
         *bit_ofs += 8;
 
@@ -239,7 +239,7 @@ bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->id_type);
 
     *bit_ofs += 8;
 
@@ -249,7 +249,7 @@ bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->ua_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->ua_type);
 
     *bit_ofs += 8;
 
@@ -263,14 +263,14 @@ bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->uas_id.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->uas_id.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->uas_id.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->uas_id.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -288,7 +288,7 @@ bool _dronecan_remoteid_BasicID_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->uas_id.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->uas_id.data[i]);
 
         *bit_ofs += 8;
 
@@ -209,7 +209,7 @@ bool dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_Location_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_Location* msg, bool tao);
-static inline bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_Location* msg, bool tao);
+static inline bool _dronecan_remoteid_Location_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_Location* msg, bool tao);
 void _dronecan_remoteid_Location_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_Location* msg, bool tao) {
 
     (void)buffer;
@@ -395,9 +395,9 @@ void _dronecan_remoteid_Location_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode dronecan_remoteid_Location, return true on failure, false on success
 */
-bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_Location* msg, bool tao) {
+bool _dronecan_remoteid_Location_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_Location* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -407,7 +407,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->id_or_mac.len);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->id_or_mac.len);
     *bit_ofs += 5;
 
 
@@ -422,7 +422,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
 
         *bit_ofs += 8;
 
@@ -436,7 +436,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->status);
 
     *bit_ofs += 8;
 
@@ -446,7 +446,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->direction);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->direction);
 
     *bit_ofs += 16;
 
@@ -456,7 +456,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->speed_horizontal);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->speed_horizontal);
 
     *bit_ofs += 16;
 
@@ -466,7 +466,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, true, &msg->speed_vertical);
+    canardReadScalar(reader, *bit_ofs, 16, true, &msg->speed_vertical);
 
     *bit_ofs += 16;
 
@@ -476,7 +476,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->latitude);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->latitude);
 
     *bit_ofs += 32;
 
@@ -486,7 +486,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->longitude);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->longitude);
 
     *bit_ofs += 32;
 
@@ -496,7 +496,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->altitude_barometric);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->altitude_barometric);
 
     *bit_ofs += 32;
 
@@ -506,7 +506,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->altitude_geodetic);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->altitude_geodetic);
 
     *bit_ofs += 32;
 
@@ -516,7 +516,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->height_reference);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->height_reference);
 
     *bit_ofs += 8;
 
@@ -526,7 +526,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->height);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->height);
 
     *bit_ofs += 32;
 
@@ -536,7 +536,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->horizontal_accuracy);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->horizontal_accuracy);
 
     *bit_ofs += 8;
 
@@ -546,7 +546,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->vertical_accuracy);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->vertical_accuracy);
 
     *bit_ofs += 8;
 
@@ -556,7 +556,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->barometer_accuracy);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->barometer_accuracy);
 
     *bit_ofs += 8;
 
@@ -566,7 +566,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->speed_accuracy);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->speed_accuracy);
 
     *bit_ofs += 8;
 
@@ -576,7 +576,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->timestamp);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->timestamp);
 
     *bit_ofs += 32;
 
@@ -586,7 +586,7 @@ bool _dronecan_remoteid_Location_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->timestamp_accuracy);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->timestamp_accuracy);
 
     *bit_ofs += 8;
 
@@ -63,7 +63,7 @@ bool dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, struc
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_OperatorID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_OperatorID* msg, bool tao);
-static inline bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_OperatorID* msg, bool tao);
+static inline bool _dronecan_remoteid_OperatorID_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_OperatorID* msg, bool tao);
 void _dronecan_remoteid_OperatorID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_OperatorID* msg, bool tao) {
 
     (void)buffer;
@@ -145,9 +145,9 @@ void _dronecan_remoteid_OperatorID_encode(uint8_t* buffer, uint32_t* bit_ofs, st
 /*
  decode dronecan_remoteid_OperatorID, return true on failure, false on success
 */
-bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_OperatorID* msg, bool tao) {
+bool _dronecan_remoteid_OperatorID_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_OperatorID* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -157,7 +157,7 @@ bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->id_or_mac.len);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->id_or_mac.len);
     *bit_ofs += 5;
 
 
@@ -172,7 +172,7 @@ bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
 
         *bit_ofs += 8;
 
@@ -186,7 +186,7 @@ bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->operator_id_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->operator_id_type);
 
     *bit_ofs += 8;
 
@@ -200,14 +200,14 @@ bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->operator_id.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->operator_id.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->operator_id.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->operator_id.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -225,7 +225,7 @@ bool _dronecan_remoteid_OperatorID_decode(const CanardRxTransfer* transfer, uint
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->operator_id.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->operator_id.data[i]);
 
         *bit_ofs += 8;
 
@@ -79,7 +79,7 @@ bool dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* trans
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_SecureCommandRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandRequest* msg, bool tao);
-static inline bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandRequest* msg, bool tao);
+static inline bool _dronecan_remoteid_SecureCommandRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandRequest* msg, bool tao);
 void _dronecan_remoteid_SecureCommandRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandRequest* msg, bool tao) {
 
     (void)buffer;
@@ -154,9 +154,9 @@ void _dronecan_remoteid_SecureCommandRequest_encode(uint8_t* buffer, uint32_t* b
 /*
  decode dronecan_remoteid_SecureCommandRequest, return true on failure, false on success
 */
-bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandRequest* msg, bool tao) {
+bool _dronecan_remoteid_SecureCommandRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -165,7 +165,7 @@ bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* tran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->sequence);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->sequence);
 
     *bit_ofs += 32;
 
@@ -175,7 +175,7 @@ bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* tran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->operation);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->operation);
 
     *bit_ofs += 32;
 
@@ -185,7 +185,7 @@ bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* tran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->sig_length);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->sig_length);
 
     *bit_ofs += 8;
 
@@ -199,14 +199,14 @@ bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* tran
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->data.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->data.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -224,7 +224,7 @@ bool _dronecan_remoteid_SecureCommandRequest_decode(const CanardRxTransfer* tran
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.data[i]);
 
         *bit_ofs += 8;
 
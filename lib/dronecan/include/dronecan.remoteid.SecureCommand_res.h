@@ -75,7 +75,7 @@ bool dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* tran
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_SecureCommandResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandResponse* msg, bool tao);
-static inline bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandResponse* msg, bool tao);
+static inline bool _dronecan_remoteid_SecureCommandResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandResponse* msg, bool tao);
 void _dronecan_remoteid_SecureCommandResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandResponse* msg, bool tao) {
 
     (void)buffer;
@@ -150,9 +150,9 @@ void _dronecan_remoteid_SecureCommandResponse_encode(uint8_t* buffer, uint32_t*
 /*
  decode dronecan_remoteid_SecureCommandResponse, return true on failure, false on success
 */
-bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandResponse* msg, bool tao) {
+bool _dronecan_remoteid_SecureCommandResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_SecureCommandResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -161,7 +161,7 @@ bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->sequence);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->sequence);
 
     *bit_ofs += 32;
 
@@ -171,7 +171,7 @@ bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->operation);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->operation);
 
     *bit_ofs += 32;
 
@@ -181,7 +181,7 @@ bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->result);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->result);
 
     *bit_ofs += 8;
 
@@ -195,14 +195,14 @@ bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* tra
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->data.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->data.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -220,7 +220,7 @@ bool _dronecan_remoteid_SecureCommandResponse_decode(const CanardRxTransfer* tra
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.data[i]);
 
         *bit_ofs += 8;
 
@@ -63,7 +63,7 @@ bool dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, struct dr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_SelfID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_SelfID* msg, bool tao);
-static inline bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_SelfID* msg, bool tao);
+static inline bool _dronecan_remoteid_SelfID_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_SelfID* msg, bool tao);
 void _dronecan_remoteid_SelfID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_SelfID* msg, bool tao) {
 
     (void)buffer;
@@ -145,9 +145,9 @@ void _dronecan_remoteid_SelfID_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode dronecan_remoteid_SelfID, return true on failure, false on success
 */
-bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_SelfID* msg, bool tao) {
+bool _dronecan_remoteid_SelfID_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_SelfID* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -157,7 +157,7 @@ bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->id_or_mac.len);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->id_or_mac.len);
     *bit_ofs += 5;
 
 
@@ -172,7 +172,7 @@ bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
 
         *bit_ofs += 8;
 
@@ -186,7 +186,7 @@ bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->description_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->description_type);
 
     *bit_ofs += 8;
 
@@ -200,14 +200,14 @@ bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->description.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->description.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->description.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->description.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -225,7 +225,7 @@ bool _dronecan_remoteid_SelfID_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->description.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->description.data[i]);
 
         *bit_ofs += 8;
 
@@ -133,7 +133,7 @@ bool dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, struct dr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_remoteid_System_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_System* msg, bool tao);
-static inline bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_System* msg, bool tao);
+static inline bool _dronecan_remoteid_System_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_System* msg, bool tao);
 void _dronecan_remoteid_System_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_remoteid_System* msg, bool tao) {
 
     (void)buffer;
@@ -283,9 +283,9 @@ void _dronecan_remoteid_System_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode dronecan_remoteid_System, return true on failure, false on success
 */
-bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_remoteid_System* msg, bool tao) {
+bool _dronecan_remoteid_System_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_remoteid_System* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -295,7 +295,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->id_or_mac.len);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->id_or_mac.len);
     *bit_ofs += 5;
 
 
@@ -310,7 +310,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->id_or_mac.data[i]);
 
         *bit_ofs += 8;
 
@@ -324,7 +324,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->operator_location_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->operator_location_type);
 
     *bit_ofs += 8;
 
@@ -334,7 +334,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->classification_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->classification_type);
 
     *bit_ofs += 8;
 
@@ -344,7 +344,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->operator_latitude);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->operator_latitude);
 
     *bit_ofs += 32;
 
@@ -354,7 +354,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->operator_longitude);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->operator_longitude);
 
     *bit_ofs += 32;
 
@@ -364,7 +364,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->area_count);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->area_count);
 
     *bit_ofs += 16;
 
@@ -374,7 +374,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->area_radius);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->area_radius);
 
     *bit_ofs += 16;
 
@@ -384,7 +384,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->area_ceiling);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->area_ceiling);
 
     *bit_ofs += 32;
 
@@ -394,7 +394,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->area_floor);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->area_floor);
 
     *bit_ofs += 32;
 
@@ -404,7 +404,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->category_eu);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->category_eu);
 
     *bit_ofs += 8;
 
@@ -414,7 +414,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->class_eu);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->class_eu);
 
     *bit_ofs += 8;
 
@@ -424,7 +424,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->operator_altitude_geo);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->operator_altitude_geo);
 
     *bit_ofs += 32;
 
@@ -434,7 +434,7 @@ bool _dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->timestamp);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->timestamp);
 
     *bit_ofs += 32;
 
@@ -59,7 +59,7 @@ bool dronecan_sensors_hygrometer_Hygrometer_decode(const CanardRxTransfer* trans
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_sensors_hygrometer_Hygrometer_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_hygrometer_Hygrometer* msg, bool tao);
-static inline bool _dronecan_sensors_hygrometer_Hygrometer_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_hygrometer_Hygrometer* msg, bool tao);
+static inline bool _dronecan_sensors_hygrometer_Hygrometer_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_hygrometer_Hygrometer* msg, bool tao);
 void _dronecan_sensors_hygrometer_Hygrometer_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_hygrometer_Hygrometer* msg, bool tao) {
 
     (void)buffer;
@@ -109,9 +109,9 @@ void _dronecan_sensors_hygrometer_Hygrometer_encode(uint8_t* buffer, uint32_t* b
 /*
  decode dronecan_sensors_hygrometer_Hygrometer, return true on failure, false on success
 */
-bool _dronecan_sensors_hygrometer_Hygrometer_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_hygrometer_Hygrometer* msg, bool tao) {
+bool _dronecan_sensors_hygrometer_Hygrometer_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_hygrometer_Hygrometer* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -122,7 +122,7 @@ bool _dronecan_sensors_hygrometer_Hygrometer_decode(const CanardRxTransfer* tran
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -136,7 +136,7 @@ bool _dronecan_sensors_hygrometer_Hygrometer_decode(const CanardRxTransfer* tran
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->humidity = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -148,7 +148,7 @@ bool _dronecan_sensors_hygrometer_Hygrometer_decode(const CanardRxTransfer* tran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->id);
 
     *bit_ofs += 8;
 
@@ -55,7 +55,7 @@ bool dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(const Canar
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes* msg, bool tao);
-static inline bool _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes* msg, bool tao);
+static inline bool _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes* msg, bool tao);
 void _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes* msg, bool tao) {
 
     (void)buffer;
@@ -98,9 +98,9 @@ void _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_encode(uint8_t* b
 /*
  decode dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes, return true on failure, false on success
 */
-bool _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes* msg, bool tao) {
+bool _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -109,7 +109,7 @@ bool _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(const Cana
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->sensor_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->sensor_id);
 
     *bit_ofs += 8;
 
@@ -124,7 +124,7 @@ bool _dronecan_sensors_magnetometer_MagneticFieldStrengthHiRes_decode(const Cana
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->magnetic_field_ga[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->magnetic_field_ga[i]);
 
         *bit_ofs += 32;
 
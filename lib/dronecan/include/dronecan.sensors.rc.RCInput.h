@@ -69,7 +69,7 @@ bool dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_sensors_rc_RCInput_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_rc_RCInput* msg, bool tao);
-static inline bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_rc_RCInput* msg, bool tao);
+static inline bool _dronecan_sensors_rc_RCInput_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_rc_RCInput* msg, bool tao);
 void _dronecan_sensors_rc_RCInput_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_rc_RCInput* msg, bool tao) {
 
     (void)buffer;
@@ -144,9 +144,9 @@ void _dronecan_sensors_rc_RCInput_encode(uint8_t* buffer, uint32_t* bit_ofs, str
 /*
  decode dronecan_sensors_rc_RCInput, return true on failure, false on success
 */
-bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_rc_RCInput* msg, bool tao) {
+bool _dronecan_sensors_rc_RCInput_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_rc_RCInput* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -155,7 +155,7 @@ bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->status);
 
     *bit_ofs += 16;
 
@@ -165,7 +165,7 @@ bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->quality);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->quality);
 
     *bit_ofs += 8;
 
@@ -175,7 +175,7 @@ bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->id);
+    canardReadScalar(reader, *bit_ofs, 4, false, &msg->id);
 
     *bit_ofs += 4;
 
@@ -189,14 +189,14 @@ bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint3
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->rcin.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->rcin.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->rcin.len = ((transfer->payload_len*8)-*bit_ofs)/12;
+        msg->rcin.len = ((reader->transfer->payload_len*8)-*bit_ofs)/12;
 
 
     }
@@ -214,7 +214,7 @@ bool _dronecan_sensors_rc_RCInput_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 12, false, &msg->rcin.data[i]);
+        canardReadScalar(reader, *bit_ofs, 12, false, &msg->rcin.data[i]);
 
         *bit_ofs += 12;
 
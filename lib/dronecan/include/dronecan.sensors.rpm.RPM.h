@@ -63,7 +63,7 @@ bool dronecan_sensors_rpm_RPM_decode(const CanardRxTransfer* transfer, struct dr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _dronecan_sensors_rpm_RPM_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_rpm_RPM* msg, bool tao);
-static inline bool _dronecan_sensors_rpm_RPM_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_rpm_RPM* msg, bool tao);
+static inline bool _dronecan_sensors_rpm_RPM_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_rpm_RPM* msg, bool tao);
 void _dronecan_sensors_rpm_RPM_encode(uint8_t* buffer, uint32_t* bit_ofs, struct dronecan_sensors_rpm_RPM* msg, bool tao) {
 
     (void)buffer;
@@ -107,9 +107,9 @@ void _dronecan_sensors_rpm_RPM_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode dronecan_sensors_rpm_RPM, return true on failure, false on success
 */
-bool _dronecan_sensors_rpm_RPM_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct dronecan_sensors_rpm_RPM* msg, bool tao) {
+bool _dronecan_sensors_rpm_RPM_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct dronecan_sensors_rpm_RPM* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -118,7 +118,7 @@ bool _dronecan_sensors_rpm_RPM_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->sensor_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->sensor_id);
 
     *bit_ofs += 8;
 
@@ -128,7 +128,7 @@ bool _dronecan_sensors_rpm_RPM_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->flags);
 
     *bit_ofs += 16;
 
@@ -138,7 +138,7 @@ bool _dronecan_sensors_rpm_RPM_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->rpm);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->rpm);
 
     *bit_ofs += 32;
 
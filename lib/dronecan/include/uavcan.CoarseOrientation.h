@@ -49,7 +49,7 @@ bool uavcan_CoarseOrientation_decode(const CanardRxTransfer* transfer, struct ua
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_CoarseOrientation_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_CoarseOrientation* msg, bool tao);
-static inline bool _uavcan_CoarseOrientation_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_CoarseOrientation* msg, bool tao);
+static inline bool _uavcan_CoarseOrientation_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_CoarseOrientation* msg, bool tao);
 void _uavcan_CoarseOrientation_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_CoarseOrientation* msg, bool tao) {
 
     (void)buffer;
@@ -92,9 +92,9 @@ void _uavcan_CoarseOrientation_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode uavcan_CoarseOrientation, return true on failure, false on success
 */
-bool _uavcan_CoarseOrientation_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_CoarseOrientation* msg, bool tao) {
+bool _uavcan_CoarseOrientation_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_CoarseOrientation* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -108,7 +108,7 @@ bool _uavcan_CoarseOrientation_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, true, &msg->fixed_axis_roll_pitch_yaw[i]);
+        canardReadScalar(reader, *bit_ofs, 5, true, &msg->fixed_axis_roll_pitch_yaw[i]);
 
         *bit_ofs += 5;
 
@@ -122,7 +122,7 @@ bool _uavcan_CoarseOrientation_decode(const CanardRxTransfer* transfer, uint32_t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->orientation_defined);
+    canardReadScalar(reader, *bit_ofs, 1, false, &msg->orientation_defined);
 
     *bit_ofs += 1;
 
@@ -45,7 +45,7 @@ bool uavcan_Timestamp_decode(const CanardRxTransfer* transfer, struct uavcan_Tim
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_Timestamp_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_Timestamp* msg, bool tao);
-static inline bool _uavcan_Timestamp_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_Timestamp* msg, bool tao);
+static inline bool _uavcan_Timestamp_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_Timestamp* msg, bool tao);
 void _uavcan_Timestamp_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_Timestamp* msg, bool tao) {
 
     (void)buffer;
@@ -71,9 +71,9 @@ void _uavcan_Timestamp_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_
 /*
  decode uavcan_Timestamp, return true on failure, false on success
 */
-bool _uavcan_Timestamp_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_Timestamp* msg, bool tao) {
+bool _uavcan_Timestamp_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_Timestamp* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -82,7 +82,7 @@ bool _uavcan_Timestamp_decode(const CanardRxTransfer* transfer, uint32_t* bit_of
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 56, false, &msg->usec);
+    canardReadScalar(reader, *bit_ofs, 56, false, &msg->usec);
 
     *bit_ofs += 56;
 
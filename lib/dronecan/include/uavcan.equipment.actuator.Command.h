@@ -61,7 +61,7 @@ bool uavcan_equipment_actuator_Command_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_actuator_Command_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Command* msg, bool tao);
-static inline bool _uavcan_equipment_actuator_Command_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Command* msg, bool tao);
+static inline bool _uavcan_equipment_actuator_Command_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Command* msg, bool tao);
 void _uavcan_equipment_actuator_Command_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Command* msg, bool tao) {
 
     (void)buffer;
@@ -108,9 +108,9 @@ void _uavcan_equipment_actuator_Command_encode(uint8_t* buffer, uint32_t* bit_of
 /*
  decode uavcan_equipment_actuator_Command, return true on failure, false on success
 */
-bool _uavcan_equipment_actuator_Command_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Command* msg, bool tao) {
+bool _uavcan_equipment_actuator_Command_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Command* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -119,7 +119,7 @@ bool _uavcan_equipment_actuator_Command_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->actuator_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->actuator_id);
 
     *bit_ofs += 8;
 
@@ -129,7 +129,7 @@ bool _uavcan_equipment_actuator_Command_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->command_type);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->command_type);
 
     *bit_ofs += 8;
 
@@ -141,7 +141,7 @@ bool _uavcan_equipment_actuator_Command_decode(const CanardRxTransfer* transfer,
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->command_value = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
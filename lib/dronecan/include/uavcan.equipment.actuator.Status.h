@@ -73,7 +73,7 @@ bool uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer, s
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_actuator_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Status* msg, bool tao);
-static inline bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Status* msg, bool tao);
+static inline bool _uavcan_equipment_actuator_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Status* msg, bool tao);
 void _uavcan_equipment_actuator_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Status* msg, bool tao) {
 
     (void)buffer;
@@ -150,9 +150,9 @@ void _uavcan_equipment_actuator_Status_encode(uint8_t* buffer, uint32_t* bit_ofs
 /*
  decode uavcan_equipment_actuator_Status, return true on failure, false on success
 */
-bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Status* msg, bool tao) {
+bool _uavcan_equipment_actuator_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_actuator_Status* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -161,7 +161,7 @@ bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->actuator_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->actuator_id);
 
     *bit_ofs += 8;
 
@@ -173,7 +173,7 @@ bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer,
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->position = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -187,7 +187,7 @@ bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer,
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->force = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -201,7 +201,7 @@ bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer,
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->speed = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -220,7 +220,7 @@ bool _uavcan_equipment_actuator_Status_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->power_rating_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->power_rating_pct);
 
     *bit_ofs += 7;
 
@@ -55,7 +55,7 @@ bool uavcan_equipment_ahrs_MagneticFieldStrength_decode(const CanardRxTransfer*
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ahrs_MagneticFieldStrength_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength* msg, bool tao);
-static inline bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength* msg, bool tao);
+static inline bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength* msg, bool tao);
 void _uavcan_equipment_ahrs_MagneticFieldStrength_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength* msg, bool tao) {
 
     (void)buffer;
@@ -126,9 +126,9 @@ void _uavcan_equipment_ahrs_MagneticFieldStrength_encode(uint8_t* buffer, uint32
 /*
  decode uavcan_equipment_ahrs_MagneticFieldStrength, return true on failure, false on success
 */
-bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength* msg, bool tao) {
+bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -144,7 +144,7 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(const CanardRxTransfer*
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->magnetic_field_ga[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -164,14 +164,14 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(const CanardRxTransfer*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->magnetic_field_covariance.len);
+        canardReadScalar(reader, *bit_ofs, 4, false, &msg->magnetic_field_covariance.len);
         *bit_ofs += 4;
 
 
 
     } else {
 
-        msg->magnetic_field_covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->magnetic_field_covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -191,7 +191,7 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength_decode(const CanardRxTransfer*
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->magnetic_field_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -59,7 +59,7 @@ bool uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer*
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ahrs_MagneticFieldStrength2_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength2* msg, bool tao);
-static inline bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength2* msg, bool tao);
+static inline bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength2* msg, bool tao);
 void _uavcan_equipment_ahrs_MagneticFieldStrength2_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength2* msg, bool tao) {
 
     (void)buffer;
@@ -139,9 +139,9 @@ void _uavcan_equipment_ahrs_MagneticFieldStrength2_encode(uint8_t* buffer, uint3
 /*
  decode uavcan_equipment_ahrs_MagneticFieldStrength2, return true on failure, false on success
 */
-bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength2* msg, bool tao) {
+bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_MagneticFieldStrength2* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -150,7 +150,7 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->sensor_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->sensor_id);
 
     *bit_ofs += 8;
 
@@ -167,7 +167,7 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->magnetic_field_ga[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -187,14 +187,14 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->magnetic_field_covariance.len);
+        canardReadScalar(reader, *bit_ofs, 4, false, &msg->magnetic_field_covariance.len);
         *bit_ofs += 4;
 
 
 
     } else {
 
-        msg->magnetic_field_covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->magnetic_field_covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -214,7 +214,7 @@ bool _uavcan_equipment_ahrs_MagneticFieldStrength2_decode(const CanardRxTransfer
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->magnetic_field_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
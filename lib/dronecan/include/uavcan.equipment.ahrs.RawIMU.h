@@ -77,7 +77,7 @@ bool uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, struc
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ahrs_RawIMU_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_RawIMU* msg, bool tao);
-static inline bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_RawIMU* msg, bool tao);
+static inline bool _uavcan_equipment_ahrs_RawIMU_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_RawIMU* msg, bool tao);
 void _uavcan_equipment_ahrs_RawIMU_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_RawIMU* msg, bool tao) {
 
     (void)buffer;
@@ -217,9 +217,9 @@ void _uavcan_equipment_ahrs_RawIMU_encode(uint8_t* buffer, uint32_t* bit_ofs, st
 /*
  decode uavcan_equipment_ahrs_RawIMU, return true on failure, false on success
 */
-bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_RawIMU* msg, bool tao) {
+bool _uavcan_equipment_ahrs_RawIMU_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_RawIMU* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -227,7 +227,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->timestamp, false)) {return true;}
 
 
 
@@ -235,7 +235,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->integration_interval);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->integration_interval);
 
     *bit_ofs += 32;
 
@@ -252,7 +252,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->rate_gyro_latest[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -273,7 +273,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->rate_gyro_integral[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->rate_gyro_integral[i]);
 
         *bit_ofs += 32;
 
@@ -294,7 +294,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->accelerometer_latest[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -315,7 +315,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->accelerometer_integral[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->accelerometer_integral[i]);
 
         *bit_ofs += 32;
 
@@ -333,14 +333,14 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->covariance.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->covariance.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -360,7 +360,7 @@ bool _uavcan_equipment_ahrs_RawIMU_decode(const CanardRxTransfer* transfer, uint
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
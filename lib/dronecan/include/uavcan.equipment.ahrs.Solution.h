@@ -81,7 +81,7 @@ bool uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, str
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ahrs_Solution_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_Solution* msg, bool tao);
-static inline bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_Solution* msg, bool tao);
+static inline bool _uavcan_equipment_ahrs_Solution_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_Solution* msg, bool tao);
 void _uavcan_equipment_ahrs_Solution_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_Solution* msg, bool tao) {
 
     (void)buffer;
@@ -266,9 +266,9 @@ void _uavcan_equipment_ahrs_Solution_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_equipment_ahrs_Solution, return true on failure, false on success
 */
-bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_Solution* msg, bool tao) {
+bool _uavcan_equipment_ahrs_Solution_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ahrs_Solution* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -276,7 +276,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->timestamp, false)) {return true;}
 
 
 
@@ -291,7 +291,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->orientation_xyzw[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -315,7 +315,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->orientation_covariance.len);
+    canardReadScalar(reader, *bit_ofs, 4, false, &msg->orientation_covariance.len);
     *bit_ofs += 4;
 
 
@@ -332,7 +332,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->orientation_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -355,7 +355,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->angular_velocity[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -379,7 +379,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->angular_velocity_covariance.len);
+    canardReadScalar(reader, *bit_ofs, 4, false, &msg->angular_velocity_covariance.len);
     *bit_ofs += 4;
 
 
@@ -396,7 +396,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->angular_velocity_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -419,7 +419,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->linear_acceleration[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -439,14 +439,14 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->linear_acceleration_covariance.len);
+        canardReadScalar(reader, *bit_ofs, 4, false, &msg->linear_acceleration_covariance.len);
         *bit_ofs += 4;
 
 
 
     } else {
 
-        msg->linear_acceleration_covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->linear_acceleration_covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -466,7 +466,7 @@ bool _uavcan_equipment_ahrs_Solution_decode(const CanardRxTransfer* transfer, ui
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->linear_acceleration_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
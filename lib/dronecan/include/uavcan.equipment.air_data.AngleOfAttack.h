@@ -65,7 +65,7 @@ bool uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* tran
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_air_data_AngleOfAttack_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_AngleOfAttack* msg, bool tao);
-static inline bool _uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_AngleOfAttack* msg, bool tao);
+static inline bool _uavcan_equipment_air_data_AngleOfAttack_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_AngleOfAttack* msg, bool tao);
 void _uavcan_equipment_air_data_AngleOfAttack_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_AngleOfAttack* msg, bool tao) {
 
     (void)buffer;
@@ -115,9 +115,9 @@ void _uavcan_equipment_air_data_AngleOfAttack_encode(uint8_t* buffer, uint32_t*
 /*
  decode uavcan_equipment_air_data_AngleOfAttack, return true on failure, false on success
 */
-bool _uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_AngleOfAttack* msg, bool tao) {
+bool _uavcan_equipment_air_data_AngleOfAttack_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_AngleOfAttack* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -126,7 +126,7 @@ bool _uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->sensor_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->sensor_id);
 
     *bit_ofs += 8;
 
@@ -138,7 +138,7 @@ bool _uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* tra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->aoa = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -152,7 +152,7 @@ bool _uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* tra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->aoa_variance = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
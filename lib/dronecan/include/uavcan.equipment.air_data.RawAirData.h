@@ -89,7 +89,7 @@ bool uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transfe
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_air_data_RawAirData_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_RawAirData* msg, bool tao);
-static inline bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_RawAirData* msg, bool tao);
+static inline bool _uavcan_equipment_air_data_RawAirData_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_RawAirData* msg, bool tao);
 void _uavcan_equipment_air_data_RawAirData_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_RawAirData* msg, bool tao) {
 
     (void)buffer;
@@ -215,9 +215,9 @@ void _uavcan_equipment_air_data_RawAirData_encode(uint8_t* buffer, uint32_t* bit
 /*
  decode uavcan_equipment_air_data_RawAirData, return true on failure, false on success
 */
-bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_RawAirData* msg, bool tao) {
+bool _uavcan_equipment_air_data_RawAirData_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_RawAirData* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -226,7 +226,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->flags);
 
     *bit_ofs += 8;
 
@@ -236,7 +236,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->static_pressure);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->static_pressure);
 
     *bit_ofs += 32;
 
@@ -246,7 +246,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->differential_pressure);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->differential_pressure);
 
     *bit_ofs += 32;
 
@@ -258,7 +258,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->static_pressure_sensor_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -272,7 +272,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->differential_pressure_sensor_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -286,7 +286,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->static_air_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -300,7 +300,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->pitot_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -316,14 +316,14 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->covariance.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->covariance.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -343,7 +343,7 @@ bool _uavcan_equipment_air_data_RawAirData_decode(const CanardRxTransfer* transf
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -55,7 +55,7 @@ bool uavcan_equipment_air_data_StaticPressure_decode(const CanardRxTransfer* tra
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_air_data_StaticPressure_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticPressure* msg, bool tao);
-static inline bool _uavcan_equipment_air_data_StaticPressure_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticPressure* msg, bool tao);
+static inline bool _uavcan_equipment_air_data_StaticPressure_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticPressure* msg, bool tao);
 void _uavcan_equipment_air_data_StaticPressure_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticPressure* msg, bool tao) {
 
     (void)buffer;
@@ -93,9 +93,9 @@ void _uavcan_equipment_air_data_StaticPressure_encode(uint8_t* buffer, uint32_t*
 /*
  decode uavcan_equipment_air_data_StaticPressure, return true on failure, false on success
 */
-bool _uavcan_equipment_air_data_StaticPressure_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticPressure* msg, bool tao) {
+bool _uavcan_equipment_air_data_StaticPressure_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticPressure* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -104,7 +104,7 @@ bool _uavcan_equipment_air_data_StaticPressure_decode(const CanardRxTransfer* tr
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->static_pressure);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->static_pressure);
 
     *bit_ofs += 32;
 
@@ -116,7 +116,7 @@ bool _uavcan_equipment_air_data_StaticPressure_decode(const CanardRxTransfer* tr
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->static_pressure_variance = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -55,7 +55,7 @@ bool uavcan_equipment_air_data_StaticTemperature_decode(const CanardRxTransfer*
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_air_data_StaticTemperature_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticTemperature* msg, bool tao);
-static inline bool _uavcan_equipment_air_data_StaticTemperature_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticTemperature* msg, bool tao);
+static inline bool _uavcan_equipment_air_data_StaticTemperature_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticTemperature* msg, bool tao);
 void _uavcan_equipment_air_data_StaticTemperature_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticTemperature* msg, bool tao) {
 
     (void)buffer;
@@ -96,9 +96,9 @@ void _uavcan_equipment_air_data_StaticTemperature_encode(uint8_t* buffer, uint32
 /*
  decode uavcan_equipment_air_data_StaticTemperature, return true on failure, false on success
 */
-bool _uavcan_equipment_air_data_StaticTemperature_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticTemperature* msg, bool tao) {
+bool _uavcan_equipment_air_data_StaticTemperature_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_air_data_StaticTemperature* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -109,7 +109,7 @@ bool _uavcan_equipment_air_data_StaticTemperature_decode(const CanardRxTransfer*
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->static_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -123,7 +123,7 @@ bool _uavcan_equipment_air_data_StaticTemperature_decode(const CanardRxTransfer*
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->static_temperature_variance = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -61,7 +61,7 @@ bool uavcan_equipment_camera_gimbal_AngularCommand_decode(const CanardRxTransfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_camera_gimbal_AngularCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_AngularCommand* msg, bool tao);
-static inline bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_AngularCommand* msg, bool tao);
+static inline bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_AngularCommand* msg, bool tao);
 void _uavcan_equipment_camera_gimbal_AngularCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_AngularCommand* msg, bool tao) {
 
     (void)buffer;
@@ -113,9 +113,9 @@ void _uavcan_equipment_camera_gimbal_AngularCommand_encode(uint8_t* buffer, uint
 /*
  decode uavcan_equipment_camera_gimbal_AngularCommand, return true on failure, false on success
 */
-bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_AngularCommand* msg, bool tao) {
+bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_AngularCommand* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -124,7 +124,7 @@ bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(const CanardRxTransfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->gimbal_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->gimbal_id);
 
     *bit_ofs += 8;
 
@@ -133,7 +133,7 @@ bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(const CanardRxTransfe
 
 
 
-    if (_uavcan_equipment_camera_gimbal_Mode_decode(transfer, bit_ofs, &msg->mode, false)) {return true;}
+    if (_uavcan_equipment_camera_gimbal_Mode_decode(reader, bit_ofs, &msg->mode, false)) {return true;}
 
 
 
@@ -148,7 +148,7 @@ bool _uavcan_equipment_camera_gimbal_AngularCommand_decode(const CanardRxTransfe
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->quaternion_xyzw[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -79,7 +79,7 @@ bool uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer*
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_camera_gimbal_GEOPOICommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_GEOPOICommand* msg, bool tao);
-static inline bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_GEOPOICommand* msg, bool tao);
+static inline bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_GEOPOICommand* msg, bool tao);
 void _uavcan_equipment_camera_gimbal_GEOPOICommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_GEOPOICommand* msg, bool tao) {
 
     (void)buffer;
@@ -147,9 +147,9 @@ void _uavcan_equipment_camera_gimbal_GEOPOICommand_encode(uint8_t* buffer, uint3
 /*
  decode uavcan_equipment_camera_gimbal_GEOPOICommand, return true on failure, false on success
 */
-bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_GEOPOICommand* msg, bool tao) {
+bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_GEOPOICommand* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -158,7 +158,7 @@ bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->gimbal_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->gimbal_id);
 
     *bit_ofs += 8;
 
@@ -167,7 +167,7 @@ bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer
 
 
 
-    if (_uavcan_equipment_camera_gimbal_Mode_decode(transfer, bit_ofs, &msg->mode, false)) {return true;}
+    if (_uavcan_equipment_camera_gimbal_Mode_decode(reader, bit_ofs, &msg->mode, false)) {return true;}
 
 
 
@@ -175,7 +175,7 @@ bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->longitude_deg_1e7);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->longitude_deg_1e7);
 
     *bit_ofs += 32;
 
@@ -185,7 +185,7 @@ bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->latitude_deg_1e7);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->latitude_deg_1e7);
 
     *bit_ofs += 32;
 
@@ -195,7 +195,7 @@ bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 22, true, &msg->height_cm);
+    canardReadScalar(reader, *bit_ofs, 22, true, &msg->height_cm);
 
     *bit_ofs += 22;
 
@@ -205,7 +205,7 @@ bool _uavcan_equipment_camera_gimbal_GEOPOICommand_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 2, false, &msg->height_reference);
+    canardReadScalar(reader, *bit_ofs, 2, false, &msg->height_reference);
 
     *bit_ofs += 2;
 
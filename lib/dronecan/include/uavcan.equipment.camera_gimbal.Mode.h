@@ -51,7 +51,7 @@ bool uavcan_equipment_camera_gimbal_Mode_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_camera_gimbal_Mode_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Mode* msg, bool tao);
-static inline bool _uavcan_equipment_camera_gimbal_Mode_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Mode* msg, bool tao);
+static inline bool _uavcan_equipment_camera_gimbal_Mode_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Mode* msg, bool tao);
 void _uavcan_equipment_camera_gimbal_Mode_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Mode* msg, bool tao) {
 
     (void)buffer;
@@ -77,9 +77,9 @@ void _uavcan_equipment_camera_gimbal_Mode_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_equipment_camera_gimbal_Mode, return true on failure, false on success
 */
-bool _uavcan_equipment_camera_gimbal_Mode_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Mode* msg, bool tao) {
+bool _uavcan_equipment_camera_gimbal_Mode_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Mode* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -88,7 +88,7 @@ bool _uavcan_equipment_camera_gimbal_Mode_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->command_mode);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->command_mode);
 
     *bit_ofs += 8;
 
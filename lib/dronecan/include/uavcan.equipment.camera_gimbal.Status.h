@@ -65,7 +65,7 @@ bool uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* transf
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_camera_gimbal_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Status* msg, bool tao);
-static inline bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Status* msg, bool tao);
+static inline bool _uavcan_equipment_camera_gimbal_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Status* msg, bool tao);
 void _uavcan_equipment_camera_gimbal_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Status* msg, bool tao) {
 
     (void)buffer;
@@ -151,9 +151,9 @@ void _uavcan_equipment_camera_gimbal_Status_encode(uint8_t* buffer, uint32_t* bi
 /*
  decode uavcan_equipment_camera_gimbal_Status, return true on failure, false on success
 */
-bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Status* msg, bool tao) {
+bool _uavcan_equipment_camera_gimbal_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_camera_gimbal_Status* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -162,7 +162,7 @@ bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* trans
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->gimbal_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->gimbal_id);
 
     *bit_ofs += 8;
 
@@ -171,7 +171,7 @@ bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* trans
 
 
 
-    if (_uavcan_equipment_camera_gimbal_Mode_decode(transfer, bit_ofs, &msg->mode, false)) {return true;}
+    if (_uavcan_equipment_camera_gimbal_Mode_decode(reader, bit_ofs, &msg->mode, false)) {return true;}
 
 
 
@@ -186,7 +186,7 @@ bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* trans
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->camera_orientation_in_body_frame_xyzw[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -206,14 +206,14 @@ bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* trans
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->camera_orientation_in_body_frame_covariance.len);
+        canardReadScalar(reader, *bit_ofs, 4, false, &msg->camera_orientation_in_body_frame_covariance.len);
         *bit_ofs += 4;
 
 
 
     } else {
 
-        msg->camera_orientation_in_body_frame_covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->camera_orientation_in_body_frame_covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -233,7 +233,7 @@ bool _uavcan_equipment_camera_gimbal_Status_decode(const CanardRxTransfer* trans
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->camera_orientation_in_body_frame_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -65,7 +65,7 @@ bool uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_device_Temperature_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_device_Temperature* msg, bool tao);
-static inline bool _uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_device_Temperature* msg, bool tao);
+static inline bool _uavcan_equipment_device_Temperature_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_device_Temperature* msg, bool tao);
 void _uavcan_equipment_device_Temperature_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_device_Temperature* msg, bool tao) {
 
     (void)buffer;
@@ -112,9 +112,9 @@ void _uavcan_equipment_device_Temperature_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_equipment_device_Temperature, return true on failure, false on success
 */
-bool _uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_device_Temperature* msg, bool tao) {
+bool _uavcan_equipment_device_Temperature_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_device_Temperature* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -123,7 +123,7 @@ bool _uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->device_id);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->device_id);
 
     *bit_ofs += 16;
 
@@ -135,7 +135,7 @@ bool _uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfe
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -147,7 +147,7 @@ bool _uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->error_flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->error_flags);
 
     *bit_ofs += 8;
 
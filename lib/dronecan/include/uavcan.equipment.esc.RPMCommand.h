@@ -51,7 +51,7 @@ bool uavcan_equipment_esc_RPMCommand_decode(const CanardRxTransfer* transfer, st
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_esc_RPMCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_esc_RPMCommand* msg, bool tao);
-static inline bool _uavcan_equipment_esc_RPMCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_esc_RPMCommand* msg, bool tao);
+static inline bool _uavcan_equipment_esc_RPMCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_esc_RPMCommand* msg, bool tao);
 void _uavcan_equipment_esc_RPMCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_esc_RPMCommand* msg, bool tao) {
 
     (void)buffer;
@@ -99,9 +99,9 @@ void _uavcan_equipment_esc_RPMCommand_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_equipment_esc_RPMCommand, return true on failure, false on success
 */
-bool _uavcan_equipment_esc_RPMCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_esc_RPMCommand* msg, bool tao) {
+bool _uavcan_equipment_esc_RPMCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_esc_RPMCommand* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -114,14 +114,14 @@ bool _uavcan_equipment_esc_RPMCommand_decode(const CanardRxTransfer* transfer, u
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->rpm.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->rpm.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->rpm.len = ((transfer->payload_len*8)-*bit_ofs)/18;
+        msg->rpm.len = ((reader->transfer->payload_len*8)-*bit_ofs)/18;
 
 
     }
@@ -139,7 +139,7 @@ bool _uavcan_equipment_esc_RPMCommand_decode(const CanardRxTransfer* transfer, u
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 18, true, &msg->rpm.data[i]);
+        canardReadScalar(reader, *bit_ofs, 18, true, &msg->rpm.data[i]);
 
         *bit_ofs += 18;
 
@@ -75,7 +75,7 @@ bool uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_esc_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_esc_Status* msg, bool tao);
-static inline bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_esc_Status* msg, bool tao);
+static inline bool _uavcan_equipment_esc_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_esc_Status* msg, bool tao);
 void _uavcan_equipment_esc_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_esc_Status* msg, bool tao) {
 
     (void)buffer;
@@ -164,9 +164,9 @@ void _uavcan_equipment_esc_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, str
 /*
  decode uavcan_equipment_esc_Status, return true on failure, false on success
 */
-bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_esc_Status* msg, bool tao) {
+bool _uavcan_equipment_esc_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_esc_Status* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -175,7 +175,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->error_count);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->error_count);
 
     *bit_ofs += 32;
 
@@ -187,7 +187,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->voltage = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -201,7 +201,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->current = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -215,7 +215,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -227,7 +227,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 18, true, &msg->rpm);
+    canardReadScalar(reader, *bit_ofs, 18, true, &msg->rpm);
 
     *bit_ofs += 18;
 
@@ -237,7 +237,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->power_rating_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->power_rating_pct);
 
     *bit_ofs += 7;
 
@@ -247,7 +247,7 @@ bool _uavcan_equipment_esc_Status_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->esc_index);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->esc_index);
 
     *bit_ofs += 5;
 
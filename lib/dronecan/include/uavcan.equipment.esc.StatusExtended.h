@@ -71,7 +71,7 @@ bool uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_esc_StatusExtended_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_esc_StatusExtended* msg, bool tao);
-static inline bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_esc_StatusExtended* msg, bool tao);
+static inline bool _uavcan_equipment_esc_StatusExtended_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_esc_StatusExtended* msg, bool tao);
 void _uavcan_equipment_esc_StatusExtended_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_esc_StatusExtended* msg, bool tao) {
 
     (void)buffer;
@@ -142,9 +142,9 @@ void _uavcan_equipment_esc_StatusExtended_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_equipment_esc_StatusExtended, return true on failure, false on success
 */
-bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_esc_StatusExtended* msg, bool tao) {
+bool _uavcan_equipment_esc_StatusExtended_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_esc_StatusExtended* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -153,7 +153,7 @@ bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->input_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->input_pct);
 
     *bit_ofs += 7;
 
@@ -163,7 +163,7 @@ bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->output_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->output_pct);
 
     *bit_ofs += 7;
 
@@ -173,7 +173,7 @@ bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 9, true, &msg->motor_temperature_degC);
+    canardReadScalar(reader, *bit_ofs, 9, true, &msg->motor_temperature_degC);
 
     *bit_ofs += 9;
 
@@ -183,7 +183,7 @@ bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 9, false, &msg->motor_angle);
+    canardReadScalar(reader, *bit_ofs, 9, false, &msg->motor_angle);
 
     *bit_ofs += 9;
 
@@ -193,7 +193,7 @@ bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 19, false, &msg->status_flags);
+    canardReadScalar(reader, *bit_ofs, 19, false, &msg->status_flags);
 
     *bit_ofs += 19;
 
@@ -203,7 +203,7 @@ bool _uavcan_equipment_esc_StatusExtended_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->esc_index);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->esc_index);
 
     *bit_ofs += 5;
 
@@ -83,7 +83,7 @@ bool uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, st
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_gnss_Auxiliary_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Auxiliary* msg, bool tao);
-static inline bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Auxiliary* msg, bool tao);
+static inline bool _uavcan_equipment_gnss_Auxiliary_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Auxiliary* msg, bool tao);
 void _uavcan_equipment_gnss_Auxiliary_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Auxiliary* msg, bool tao) {
 
     (void)buffer;
@@ -202,9 +202,9 @@ void _uavcan_equipment_gnss_Auxiliary_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_equipment_gnss_Auxiliary, return true on failure, false on success
 */
-bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Auxiliary* msg, bool tao) {
+bool _uavcan_equipment_gnss_Auxiliary_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Auxiliary* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -215,7 +215,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->gdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -229,7 +229,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->pdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -243,7 +243,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->hdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -257,7 +257,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->vdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -271,7 +271,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->tdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -285,7 +285,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->ndop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -299,7 +299,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->edop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -311,7 +311,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->sats_visible);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->sats_visible);
 
     *bit_ofs += 7;
 
@@ -321,7 +321,7 @@ bool _uavcan_equipment_gnss_Auxiliary_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->sats_used);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->sats_used);
 
     *bit_ofs += 6;
 
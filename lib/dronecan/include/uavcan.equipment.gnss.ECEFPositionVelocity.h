@@ -51,7 +51,7 @@ bool uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer* t
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_gnss_ECEFPositionVelocity_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_ECEFPositionVelocity* msg, bool tao);
-static inline bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_ECEFPositionVelocity* msg, bool tao);
+static inline bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_ECEFPositionVelocity* msg, bool tao);
 void _uavcan_equipment_gnss_ECEFPositionVelocity_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_ECEFPositionVelocity* msg, bool tao) {
 
     (void)buffer;
@@ -142,9 +142,9 @@ void _uavcan_equipment_gnss_ECEFPositionVelocity_encode(uint8_t* buffer, uint32_
 /*
  decode uavcan_equipment_gnss_ECEFPositionVelocity, return true on failure, false on success
 */
-bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_ECEFPositionVelocity* msg, bool tao) {
+bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_ECEFPositionVelocity* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -158,7 +158,7 @@ bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->velocity_xyz[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->velocity_xyz[i]);
 
         *bit_ofs += 32;
 
@@ -177,7 +177,7 @@ bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 36, true, &msg->position_xyz_mm[i]);
+        canardReadScalar(reader, *bit_ofs, 36, true, &msg->position_xyz_mm[i]);
 
         *bit_ofs += 36;
 
@@ -202,14 +202,14 @@ bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->covariance.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->covariance.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -229,7 +229,7 @@ bool _uavcan_equipment_gnss_ECEFPositionVelocity_decode(const CanardRxTransfer*
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -129,7 +129,7 @@ bool uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, struct u
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_gnss_Fix_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix* msg, bool tao);
-static inline bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix* msg, bool tao);
+static inline bool _uavcan_equipment_gnss_Fix_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix* msg, bool tao);
 void _uavcan_equipment_gnss_Fix_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix* msg, bool tao) {
 
     (void)buffer;
@@ -336,9 +336,9 @@ void _uavcan_equipment_gnss_Fix_encode(uint8_t* buffer, uint32_t* bit_ofs, struc
 /*
  decode uavcan_equipment_gnss_Fix, return true on failure, false on success
 */
-bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix* msg, bool tao) {
+bool _uavcan_equipment_gnss_Fix_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -346,14 +346,14 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->timestamp, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->gnss_timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->gnss_timestamp, false)) {return true;}
 
 
 
@@ -361,7 +361,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->gnss_time_standard);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->gnss_time_standard);
 
     *bit_ofs += 3;
 
@@ -378,7 +378,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->num_leap_seconds);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->num_leap_seconds);
 
     *bit_ofs += 8;
 
@@ -388,7 +388,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 37, true, &msg->longitude_deg_1e8);
+    canardReadScalar(reader, *bit_ofs, 37, true, &msg->longitude_deg_1e8);
 
     *bit_ofs += 37;
 
@@ -398,7 +398,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 37, true, &msg->latitude_deg_1e8);
+    canardReadScalar(reader, *bit_ofs, 37, true, &msg->latitude_deg_1e8);
 
     *bit_ofs += 37;
 
@@ -408,7 +408,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 27, true, &msg->height_ellipsoid_mm);
+    canardReadScalar(reader, *bit_ofs, 27, true, &msg->height_ellipsoid_mm);
 
     *bit_ofs += 27;
 
@@ -418,7 +418,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 27, true, &msg->height_msl_mm);
+    canardReadScalar(reader, *bit_ofs, 27, true, &msg->height_msl_mm);
 
     *bit_ofs += 27;
 
@@ -435,7 +435,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->ned_velocity[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -451,7 +451,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->sats_used);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->sats_used);
 
     *bit_ofs += 6;
 
@@ -461,7 +461,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 2, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 2, false, &msg->status);
 
     *bit_ofs += 2;
 
@@ -473,7 +473,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->pdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -493,7 +493,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->position_covariance.len);
+    canardReadScalar(reader, *bit_ofs, 4, false, &msg->position_covariance.len);
     *bit_ofs += 4;
 
 
@@ -510,7 +510,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->position_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -530,14 +530,14 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->velocity_covariance.len);
+        canardReadScalar(reader, *bit_ofs, 4, false, &msg->velocity_covariance.len);
         *bit_ofs += 4;
 
 
 
     } else {
 
-        msg->velocity_covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->velocity_covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -557,7 +557,7 @@ bool _uavcan_equipment_gnss_Fix_decode(const CanardRxTransfer* transfer, uint32_
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->velocity_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
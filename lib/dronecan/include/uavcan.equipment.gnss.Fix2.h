@@ -153,7 +153,7 @@ bool uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_gnss_Fix2_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix2* msg, bool tao);
-static inline bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix2* msg, bool tao);
+static inline bool _uavcan_equipment_gnss_Fix2_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix2* msg, bool tao);
 void _uavcan_equipment_gnss_Fix2_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix2* msg, bool tao) {
 
     (void)buffer;
@@ -363,9 +363,9 @@ void _uavcan_equipment_gnss_Fix2_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode uavcan_equipment_gnss_Fix2, return true on failure, false on success
 */
-bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix2* msg, bool tao) {
+bool _uavcan_equipment_gnss_Fix2_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_Fix2* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -373,14 +373,14 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->timestamp, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->gnss_timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->gnss_timestamp, false)) {return true;}
 
 
 
@@ -388,7 +388,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->gnss_time_standard);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->gnss_time_standard);
 
     *bit_ofs += 3;
 
@@ -405,7 +405,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->num_leap_seconds);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->num_leap_seconds);
 
     *bit_ofs += 8;
 
@@ -415,7 +415,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 37, true, &msg->longitude_deg_1e8);
+    canardReadScalar(reader, *bit_ofs, 37, true, &msg->longitude_deg_1e8);
 
     *bit_ofs += 37;
 
@@ -425,7 +425,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 37, true, &msg->latitude_deg_1e8);
+    canardReadScalar(reader, *bit_ofs, 37, true, &msg->latitude_deg_1e8);
 
     *bit_ofs += 37;
 
@@ -435,7 +435,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 27, true, &msg->height_ellipsoid_mm);
+    canardReadScalar(reader, *bit_ofs, 27, true, &msg->height_ellipsoid_mm);
 
     *bit_ofs += 27;
 
@@ -445,7 +445,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 27, true, &msg->height_msl_mm);
+    canardReadScalar(reader, *bit_ofs, 27, true, &msg->height_msl_mm);
 
     *bit_ofs += 27;
 
@@ -460,7 +460,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->ned_velocity[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->ned_velocity[i]);
 
         *bit_ofs += 32;
 
@@ -474,7 +474,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->sats_used);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->sats_used);
 
     *bit_ofs += 6;
 
@@ -484,7 +484,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 2, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 2, false, &msg->status);
 
     *bit_ofs += 2;
 
@@ -494,7 +494,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->mode);
+    canardReadScalar(reader, *bit_ofs, 4, false, &msg->mode);
 
     *bit_ofs += 4;
 
@@ -504,7 +504,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->sub_mode);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->sub_mode);
 
     *bit_ofs += 6;
 
@@ -515,7 +515,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->covariance.len);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->covariance.len);
     *bit_ofs += 6;
 
 
@@ -532,7 +532,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -550,7 +550,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->pdop = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -566,7 +566,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->ecef_position_velocity.len);
+        canardReadScalar(reader, *bit_ofs, 1, false, &msg->ecef_position_velocity.len);
         *bit_ofs += 1;
 
 
@@ -581,10 +581,10 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
         msg->ecef_position_velocity.len = 0;
         size_t max_len = 1;
-        uint32_t max_bits = (transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
+        uint32_t max_bits = (reader->transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
         while (max_bits > *bit_ofs) {
 
-            if (!max_len-- || _uavcan_equipment_gnss_ECEFPositionVelocity_decode(transfer, bit_ofs, &msg->ecef_position_velocity.data[msg->ecef_position_velocity.len], false)) {return true;}
+            if (!max_len-- || _uavcan_equipment_gnss_ECEFPositionVelocity_decode(reader, bit_ofs, &msg->ecef_position_velocity.data[msg->ecef_position_velocity.len], false)) {return true;}
             msg->ecef_position_velocity.len++;
 
         }
@@ -603,7 +603,7 @@ bool _uavcan_equipment_gnss_Fix2_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-            if (_uavcan_equipment_gnss_ECEFPositionVelocity_decode(transfer, bit_ofs, &msg->ecef_position_velocity.data[i], false)) {return true;}
+            if (_uavcan_equipment_gnss_ECEFPositionVelocity_decode(reader, bit_ofs, &msg->ecef_position_velocity.data[i], false)) {return true;}
 
 
         }
@@ -63,7 +63,7 @@ bool uavcan_equipment_gnss_RTCMStream_decode(const CanardRxTransfer* transfer, s
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_gnss_RTCMStream_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_RTCMStream* msg, bool tao);
-static inline bool _uavcan_equipment_gnss_RTCMStream_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_RTCMStream* msg, bool tao);
+static inline bool _uavcan_equipment_gnss_RTCMStream_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_RTCMStream* msg, bool tao);
 void _uavcan_equipment_gnss_RTCMStream_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_RTCMStream* msg, bool tao) {
 
     (void)buffer;
@@ -120,9 +120,9 @@ void _uavcan_equipment_gnss_RTCMStream_encode(uint8_t* buffer, uint32_t* bit_ofs
 /*
  decode uavcan_equipment_gnss_RTCMStream, return true on failure, false on success
 */
-bool _uavcan_equipment_gnss_RTCMStream_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_gnss_RTCMStream* msg, bool tao) {
+bool _uavcan_equipment_gnss_RTCMStream_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_gnss_RTCMStream* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -131,7 +131,7 @@ bool _uavcan_equipment_gnss_RTCMStream_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->protocol_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->protocol_id);
 
     *bit_ofs += 8;
 
@@ -145,14 +145,14 @@ bool _uavcan_equipment_gnss_RTCMStream_decode(const CanardRxTransfer* transfer,
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->data.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->data.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -170,7 +170,7 @@ bool _uavcan_equipment_gnss_RTCMStream_decode(const CanardRxTransfer* transfer,
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.data[i]);
 
         *bit_ofs += 8;
 
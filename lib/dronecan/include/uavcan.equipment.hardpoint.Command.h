@@ -55,7 +55,7 @@ bool uavcan_equipment_hardpoint_Command_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_hardpoint_Command_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Command* msg, bool tao);
-static inline bool _uavcan_equipment_hardpoint_Command_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Command* msg, bool tao);
+static inline bool _uavcan_equipment_hardpoint_Command_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Command* msg, bool tao);
 void _uavcan_equipment_hardpoint_Command_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Command* msg, bool tao) {
 
     (void)buffer;
@@ -90,9 +90,9 @@ void _uavcan_equipment_hardpoint_Command_encode(uint8_t* buffer, uint32_t* bit_o
 /*
  decode uavcan_equipment_hardpoint_Command, return true on failure, false on success
 */
-bool _uavcan_equipment_hardpoint_Command_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Command* msg, bool tao) {
+bool _uavcan_equipment_hardpoint_Command_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Command* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -101,7 +101,7 @@ bool _uavcan_equipment_hardpoint_Command_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->hardpoint_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->hardpoint_id);
 
     *bit_ofs += 8;
 
@@ -111,7 +111,7 @@ bool _uavcan_equipment_hardpoint_Command_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->command);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->command);
 
     *bit_ofs += 16;
 
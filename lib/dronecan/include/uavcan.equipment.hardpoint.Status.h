@@ -63,7 +63,7 @@ bool uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_hardpoint_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Status* msg, bool tao);
-static inline bool _uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Status* msg, bool tao);
+static inline bool _uavcan_equipment_hardpoint_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Status* msg, bool tao);
 void _uavcan_equipment_hardpoint_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Status* msg, bool tao) {
 
     (void)buffer;
@@ -122,9 +122,9 @@ void _uavcan_equipment_hardpoint_Status_encode(uint8_t* buffer, uint32_t* bit_of
 /*
  decode uavcan_equipment_hardpoint_Status, return true on failure, false on success
 */
-bool _uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Status* msg, bool tao) {
+bool _uavcan_equipment_hardpoint_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_hardpoint_Status* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -133,7 +133,7 @@ bool _uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->hardpoint_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->hardpoint_id);
 
     *bit_ofs += 8;
 
@@ -145,7 +145,7 @@ bool _uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer,
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->payload_weight = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -159,7 +159,7 @@ bool _uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer,
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->payload_weight_variance = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -171,7 +171,7 @@ bool _uavcan_equipment_hardpoint_Status_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->status);
 
     *bit_ofs += 16;
 
@@ -69,7 +69,7 @@ bool uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ice_FuelTankStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ice_FuelTankStatus* msg, bool tao);
-static inline bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ice_FuelTankStatus* msg, bool tao);
+static inline bool _uavcan_equipment_ice_FuelTankStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ice_FuelTankStatus* msg, bool tao);
 void _uavcan_equipment_ice_FuelTankStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ice_FuelTankStatus* msg, bool tao) {
 
     (void)buffer;
@@ -140,9 +140,9 @@ void _uavcan_equipment_ice_FuelTankStatus_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_equipment_ice_FuelTankStatus, return true on failure, false on success
 */
-bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ice_FuelTankStatus* msg, bool tao) {
+bool _uavcan_equipment_ice_FuelTankStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ice_FuelTankStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -158,7 +158,7 @@ bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->available_fuel_volume_percent);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->available_fuel_volume_percent);
 
     *bit_ofs += 7;
 
@@ -168,7 +168,7 @@ bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->available_fuel_volume_cm3);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->available_fuel_volume_cm3);
 
     *bit_ofs += 32;
 
@@ -178,7 +178,7 @@ bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->fuel_consumption_rate_cm3pm);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->fuel_consumption_rate_cm3pm);
 
     *bit_ofs += 32;
 
@@ -190,7 +190,7 @@ bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfe
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->fuel_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -202,7 +202,7 @@ bool _uavcan_equipment_ice_FuelTankStatus_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->fuel_tank_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->fuel_tank_id);
 
     *bit_ofs += 8;
 
@@ -57,7 +57,7 @@ bool uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTran
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ice_reciprocating_CylinderStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_CylinderStatus* msg, bool tao);
-static inline bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_CylinderStatus* msg, bool tao);
+static inline bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_CylinderStatus* msg, bool tao);
 void _uavcan_equipment_ice_reciprocating_CylinderStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_CylinderStatus* msg, bool tao) {
 
     (void)buffer;
@@ -134,9 +134,9 @@ void _uavcan_equipment_ice_reciprocating_CylinderStatus_encode(uint8_t* buffer,
 /*
  decode uavcan_equipment_ice_reciprocating_CylinderStatus, return true on failure, false on success
 */
-bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_CylinderStatus* msg, bool tao) {
+bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_CylinderStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -147,7 +147,7 @@ bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->ignition_timing_deg = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -161,7 +161,7 @@ bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->injection_time_ms = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -175,7 +175,7 @@ bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->cylinder_head_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -189,7 +189,7 @@ bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->exhaust_gas_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -203,7 +203,7 @@ bool _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(const CanardRxTra
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->lambda_coefficient = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -181,7 +181,7 @@ bool uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* tr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_ice_reciprocating_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_Status* msg, bool tao);
-static inline bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_Status* msg, bool tao);
+static inline bool _uavcan_equipment_ice_reciprocating_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_Status* msg, bool tao);
 void _uavcan_equipment_ice_reciprocating_Status_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_Status* msg, bool tao) {
 
     (void)buffer;
@@ -409,9 +409,9 @@ void _uavcan_equipment_ice_reciprocating_Status_encode(uint8_t* buffer, uint32_t
 /*
  decode uavcan_equipment_ice_reciprocating_Status, return true on failure, false on success
 */
-bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_Status* msg, bool tao) {
+bool _uavcan_equipment_ice_reciprocating_Status_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_ice_reciprocating_Status* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -420,7 +420,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 2, false, &msg->state);
+    canardReadScalar(reader, *bit_ofs, 2, false, &msg->state);
 
     *bit_ofs += 2;
 
@@ -430,7 +430,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 30, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 30, false, &msg->flags);
 
     *bit_ofs += 30;
 
@@ -447,7 +447,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->engine_load_percent);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->engine_load_percent);
 
     *bit_ofs += 7;
 
@@ -457,7 +457,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 17, false, &msg->engine_speed_rpm);
+    canardReadScalar(reader, *bit_ofs, 17, false, &msg->engine_speed_rpm);
 
     *bit_ofs += 17;
 
@@ -469,7 +469,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->spark_dwell_time_ms = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -483,7 +483,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->atmospheric_pressure_kpa = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -497,7 +497,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->intake_manifold_pressure_kpa = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -511,7 +511,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->intake_manifold_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -525,7 +525,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->coolant_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -539,7 +539,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->oil_pressure = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -553,7 +553,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->oil_temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -567,7 +567,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->fuel_pressure = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -579,7 +579,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->fuel_consumption_rate_cm3pm);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->fuel_consumption_rate_cm3pm);
 
     *bit_ofs += 32;
 
@@ -589,7 +589,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->estimated_consumed_fuel_volume_cm3);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->estimated_consumed_fuel_volume_cm3);
 
     *bit_ofs += 32;
 
@@ -599,7 +599,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->throttle_position_percent);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->throttle_position_percent);
 
     *bit_ofs += 7;
 
@@ -609,7 +609,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->ecu_index);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->ecu_index);
 
     *bit_ofs += 6;
 
@@ -619,7 +619,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->spark_plug_usage);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->spark_plug_usage);
 
     *bit_ofs += 3;
 
@@ -633,7 +633,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->cylinder_status.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->cylinder_status.len);
         *bit_ofs += 5;
 
 
@@ -648,10 +648,10 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
         msg->cylinder_status.len = 0;
         size_t max_len = 16;
-        uint32_t max_bits = (transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
+        uint32_t max_bits = (reader->transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
         while (max_bits > *bit_ofs) {
 
-            if (!max_len-- || _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(transfer, bit_ofs, &msg->cylinder_status.data[msg->cylinder_status.len], false)) {return true;}
+            if (!max_len-- || _uavcan_equipment_ice_reciprocating_CylinderStatus_decode(reader, bit_ofs, &msg->cylinder_status.data[msg->cylinder_status.len], false)) {return true;}
             msg->cylinder_status.len++;
 
         }
@@ -670,7 +670,7 @@ bool _uavcan_equipment_ice_reciprocating_Status_decode(const CanardRxTransfer* t
 
 
 
-            if (_uavcan_equipment_ice_reciprocating_CylinderStatus_decode(transfer, bit_ofs, &msg->cylinder_status.data[i], false)) {return true;}
+            if (_uavcan_equipment_ice_reciprocating_CylinderStatus_decode(reader, bit_ofs, &msg->cylinder_status.data[i], false)) {return true;}
 
 
         }
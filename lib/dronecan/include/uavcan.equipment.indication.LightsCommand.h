@@ -53,7 +53,7 @@ bool uavcan_equipment_indication_LightsCommand_decode(const CanardRxTransfer* tr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_indication_LightsCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_indication_LightsCommand* msg, bool tao);
-static inline bool _uavcan_equipment_indication_LightsCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_indication_LightsCommand* msg, bool tao);
+static inline bool _uavcan_equipment_indication_LightsCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_indication_LightsCommand* msg, bool tao);
 void _uavcan_equipment_indication_LightsCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_indication_LightsCommand* msg, bool tao) {
 
     (void)buffer;
@@ -98,9 +98,9 @@ void _uavcan_equipment_indication_LightsCommand_encode(uint8_t* buffer, uint32_t
 /*
  decode uavcan_equipment_indication_LightsCommand, return true on failure, false on success
 */
-bool _uavcan_equipment_indication_LightsCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_indication_LightsCommand* msg, bool tao) {
+bool _uavcan_equipment_indication_LightsCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_indication_LightsCommand* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -113,7 +113,7 @@ bool _uavcan_equipment_indication_LightsCommand_decode(const CanardRxTransfer* t
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->commands.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->commands.len);
         *bit_ofs += 5;
 
 
@@ -128,10 +128,10 @@ bool _uavcan_equipment_indication_LightsCommand_decode(const CanardRxTransfer* t
 
         msg->commands.len = 0;
         size_t max_len = 20;
-        uint32_t max_bits = (transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
+        uint32_t max_bits = (reader->transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
         while (max_bits > *bit_ofs) {
 
-            if (!max_len-- || _uavcan_equipment_indication_SingleLightCommand_decode(transfer, bit_ofs, &msg->commands.data[msg->commands.len], false)) {return true;}
+            if (!max_len-- || _uavcan_equipment_indication_SingleLightCommand_decode(reader, bit_ofs, &msg->commands.data[msg->commands.len], false)) {return true;}
             msg->commands.len++;
 
         }
@@ -150,7 +150,7 @@ bool _uavcan_equipment_indication_LightsCommand_decode(const CanardRxTransfer* t
 
 
 
-            if (_uavcan_equipment_indication_SingleLightCommand_decode(transfer, bit_ofs, &msg->commands.data[i], false)) {return true;}
+            if (_uavcan_equipment_indication_SingleLightCommand_decode(reader, bit_ofs, &msg->commands.data[i], false)) {return true;}
 
 
         }
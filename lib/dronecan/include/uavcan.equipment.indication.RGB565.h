@@ -49,7 +49,7 @@ bool uavcan_equipment_indication_RGB565_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_indication_RGB565_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_indication_RGB565* msg, bool tao);
-static inline bool _uavcan_equipment_indication_RGB565_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_indication_RGB565* msg, bool tao);
+static inline bool _uavcan_equipment_indication_RGB565_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_indication_RGB565* msg, bool tao);
 void _uavcan_equipment_indication_RGB565_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_indication_RGB565* msg, bool tao) {
 
     (void)buffer;
@@ -93,9 +93,9 @@ void _uavcan_equipment_indication_RGB565_encode(uint8_t* buffer, uint32_t* bit_o
 /*
  decode uavcan_equipment_indication_RGB565, return true on failure, false on success
 */
-bool _uavcan_equipment_indication_RGB565_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_indication_RGB565* msg, bool tao) {
+bool _uavcan_equipment_indication_RGB565_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_indication_RGB565* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -104,7 +104,7 @@ bool _uavcan_equipment_indication_RGB565_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->red);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->red);
 
     *bit_ofs += 5;
 
@@ -114,7 +114,7 @@ bool _uavcan_equipment_indication_RGB565_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->green);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->green);
 
     *bit_ofs += 6;
 
@@ -124,7 +124,7 @@ bool _uavcan_equipment_indication_RGB565_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->blue);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->blue);
 
     *bit_ofs += 5;
 
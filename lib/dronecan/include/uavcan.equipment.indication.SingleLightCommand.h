@@ -69,7 +69,7 @@ bool uavcan_equipment_indication_SingleLightCommand_decode(const CanardRxTransfe
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_indication_SingleLightCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_indication_SingleLightCommand* msg, bool tao);
-static inline bool _uavcan_equipment_indication_SingleLightCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_indication_SingleLightCommand* msg, bool tao);
+static inline bool _uavcan_equipment_indication_SingleLightCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_indication_SingleLightCommand* msg, bool tao);
 void _uavcan_equipment_indication_SingleLightCommand_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_indication_SingleLightCommand* msg, bool tao) {
 
     (void)buffer;
@@ -101,9 +101,9 @@ void _uavcan_equipment_indication_SingleLightCommand_encode(uint8_t* buffer, uin
 /*
  decode uavcan_equipment_indication_SingleLightCommand, return true on failure, false on success
 */
-bool _uavcan_equipment_indication_SingleLightCommand_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_indication_SingleLightCommand* msg, bool tao) {
+bool _uavcan_equipment_indication_SingleLightCommand_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_indication_SingleLightCommand* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -112,7 +112,7 @@ bool _uavcan_equipment_indication_SingleLightCommand_decode(const CanardRxTransf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->light_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->light_id);
 
     *bit_ofs += 8;
 
@@ -121,7 +121,7 @@ bool _uavcan_equipment_indication_SingleLightCommand_decode(const CanardRxTransf
 
 
 
-    if (_uavcan_equipment_indication_RGB565_decode(transfer, bit_ofs, &msg->color, tao)) {return true;}
+    if (_uavcan_equipment_indication_RGB565_decode(reader, bit_ofs, &msg->color, tao)) {return true;}
 
 
 
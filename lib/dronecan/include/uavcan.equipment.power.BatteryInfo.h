@@ -129,7 +129,7 @@ bool uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_power_BatteryInfo_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_power_BatteryInfo* msg, bool tao);
-static inline bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_power_BatteryInfo* msg, bool tao);
+static inline bool _uavcan_equipment_power_BatteryInfo_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_power_BatteryInfo* msg, bool tao);
 void _uavcan_equipment_power_BatteryInfo_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_power_BatteryInfo* msg, bool tao) {
 
     (void)buffer;
@@ -315,9 +315,9 @@ void _uavcan_equipment_power_BatteryInfo_encode(uint8_t* buffer, uint32_t* bit_o
 /*
  decode uavcan_equipment_power_BatteryInfo, return true on failure, false on success
 */
-bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_power_BatteryInfo* msg, bool tao) {
+bool _uavcan_equipment_power_BatteryInfo_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_power_BatteryInfo* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -328,7 +328,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->temperature = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -342,7 +342,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->voltage = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -356,7 +356,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->current = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -370,7 +370,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->average_power_10sec = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -384,7 +384,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->remaining_capacity_wh = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -398,7 +398,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->full_charge_capacity_wh = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -412,7 +412,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->hours_to_full_charge = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -424,7 +424,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 11, false, &msg->status_flags);
+    canardReadScalar(reader, *bit_ofs, 11, false, &msg->status_flags);
 
     *bit_ofs += 11;
 
@@ -434,7 +434,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->state_of_health_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->state_of_health_pct);
 
     *bit_ofs += 7;
 
@@ -444,7 +444,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->state_of_charge_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->state_of_charge_pct);
 
     *bit_ofs += 7;
 
@@ -454,7 +454,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->state_of_charge_pct_stdev);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->state_of_charge_pct_stdev);
 
     *bit_ofs += 7;
 
@@ -464,7 +464,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->battery_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->battery_id);
 
     *bit_ofs += 8;
 
@@ -474,7 +474,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->model_instance_id);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->model_instance_id);
 
     *bit_ofs += 32;
 
@@ -488,14 +488,14 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->model_name.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->model_name.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->model_name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->model_name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -513,7 +513,7 @@ bool _uavcan_equipment_power_BatteryInfo_decode(const CanardRxTransfer* transfer
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->model_name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->model_name.data[i]);
 
         *bit_ofs += 8;
 
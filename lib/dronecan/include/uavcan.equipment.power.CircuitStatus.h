@@ -73,7 +73,7 @@ bool uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transfe
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_power_CircuitStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_power_CircuitStatus* msg, bool tao);
-static inline bool _uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_power_CircuitStatus* msg, bool tao);
+static inline bool _uavcan_equipment_power_CircuitStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_power_CircuitStatus* msg, bool tao);
 void _uavcan_equipment_power_CircuitStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_power_CircuitStatus* msg, bool tao) {
 
     (void)buffer;
@@ -132,9 +132,9 @@ void _uavcan_equipment_power_CircuitStatus_encode(uint8_t* buffer, uint32_t* bit
 /*
  decode uavcan_equipment_power_CircuitStatus, return true on failure, false on success
 */
-bool _uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_power_CircuitStatus* msg, bool tao) {
+bool _uavcan_equipment_power_CircuitStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_power_CircuitStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -143,7 +143,7 @@ bool _uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->circuit_id);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->circuit_id);
 
     *bit_ofs += 16;
 
@@ -155,7 +155,7 @@ bool _uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transf
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->voltage = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -169,7 +169,7 @@ bool _uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transf
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->current = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -181,7 +181,7 @@ bool _uavcan_equipment_power_CircuitStatus_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->error_flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->error_flags);
 
     *bit_ofs += 8;
 
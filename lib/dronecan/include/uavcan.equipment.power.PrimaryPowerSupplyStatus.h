@@ -67,7 +67,7 @@ bool uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTransf
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_power_PrimaryPowerSupplyStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_power_PrimaryPowerSupplyStatus* msg, bool tao);
-static inline bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_power_PrimaryPowerSupplyStatus* msg, bool tao);
+static inline bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_power_PrimaryPowerSupplyStatus* msg, bool tao);
 void _uavcan_equipment_power_PrimaryPowerSupplyStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_power_PrimaryPowerSupplyStatus* msg, bool tao) {
 
     (void)buffer;
@@ -135,9 +135,9 @@ void _uavcan_equipment_power_PrimaryPowerSupplyStatus_encode(uint8_t* buffer, ui
 /*
  decode uavcan_equipment_power_PrimaryPowerSupplyStatus, return true on failure, false on success
 */
-bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_power_PrimaryPowerSupplyStatus* msg, bool tao) {
+bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_power_PrimaryPowerSupplyStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -148,7 +148,7 @@ bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTrans
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->hours_to_empty_at_10sec_avg_power = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -162,7 +162,7 @@ bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTrans
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->hours_to_empty_at_10sec_avg_power_variance = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -174,7 +174,7 @@ bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTrans
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->external_power_available);
+    canardReadScalar(reader, *bit_ofs, 1, false, &msg->external_power_available);
 
     *bit_ofs += 1;
 
@@ -184,7 +184,7 @@ bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTrans
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->remaining_energy_pct);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->remaining_energy_pct);
 
     *bit_ofs += 7;
 
@@ -194,7 +194,7 @@ bool _uavcan_equipment_power_PrimaryPowerSupplyStatus_decode(const CanardRxTrans
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->remaining_energy_pct_stdev);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->remaining_energy_pct_stdev);
 
     *bit_ofs += 7;
 
@@ -97,7 +97,7 @@ bool uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* tr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_range_sensor_Measurement_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_range_sensor_Measurement* msg, bool tao);
-static inline bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_range_sensor_Measurement* msg, bool tao);
+static inline bool _uavcan_equipment_range_sensor_Measurement_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_range_sensor_Measurement* msg, bool tao);
 void _uavcan_equipment_range_sensor_Measurement_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_range_sensor_Measurement* msg, bool tao) {
 
     (void)buffer;
@@ -177,9 +177,9 @@ void _uavcan_equipment_range_sensor_Measurement_encode(uint8_t* buffer, uint32_t
 /*
  decode uavcan_equipment_range_sensor_Measurement, return true on failure, false on success
 */
-bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_range_sensor_Measurement* msg, bool tao) {
+bool _uavcan_equipment_range_sensor_Measurement_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_range_sensor_Measurement* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -187,7 +187,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->timestamp, false)) {return true;}
 
 
 
@@ -195,7 +195,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->sensor_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->sensor_id);
 
     *bit_ofs += 8;
 
@@ -204,7 +204,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
 
 
-    if (_uavcan_CoarseOrientation_decode(transfer, bit_ofs, &msg->beam_orientation_in_body_frame, false)) {return true;}
+    if (_uavcan_CoarseOrientation_decode(reader, bit_ofs, &msg->beam_orientation_in_body_frame, false)) {return true;}
 
 
 
@@ -214,7 +214,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->field_of_view = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -226,7 +226,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->sensor_type);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->sensor_type);
 
     *bit_ofs += 5;
 
@@ -236,7 +236,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->reading_type);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->reading_type);
 
     *bit_ofs += 3;
 
@@ -248,7 +248,7 @@ bool _uavcan_equipment_range_sensor_Measurement_decode(const CanardRxTransfer* t
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->range = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -57,7 +57,7 @@ bool uavcan_equipment_safety_ArmingStatus_decode(const CanardRxTransfer* transfe
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_equipment_safety_ArmingStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_safety_ArmingStatus* msg, bool tao);
-static inline bool _uavcan_equipment_safety_ArmingStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_safety_ArmingStatus* msg, bool tao);
+static inline bool _uavcan_equipment_safety_ArmingStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_safety_ArmingStatus* msg, bool tao);
 void _uavcan_equipment_safety_ArmingStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_equipment_safety_ArmingStatus* msg, bool tao) {
 
     (void)buffer;
@@ -83,9 +83,9 @@ void _uavcan_equipment_safety_ArmingStatus_encode(uint8_t* buffer, uint32_t* bit
 /*
  decode uavcan_equipment_safety_ArmingStatus, return true on failure, false on success
 */
-bool _uavcan_equipment_safety_ArmingStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_equipment_safety_ArmingStatus* msg, bool tao) {
+bool _uavcan_equipment_safety_ArmingStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_equipment_safety_ArmingStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -94,7 +94,7 @@ bool _uavcan_equipment_safety_ArmingStatus_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->status);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->status);
 
     *bit_ofs += 8;
 
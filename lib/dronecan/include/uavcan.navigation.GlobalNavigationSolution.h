@@ -105,7 +105,7 @@ bool uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer* t
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_navigation_GlobalNavigationSolution_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_navigation_GlobalNavigationSolution* msg, bool tao);
-static inline bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_navigation_GlobalNavigationSolution* msg, bool tao);
+static inline bool _uavcan_navigation_GlobalNavigationSolution_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_navigation_GlobalNavigationSolution* msg, bool tao);
 void _uavcan_navigation_GlobalNavigationSolution_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_navigation_GlobalNavigationSolution* msg, bool tao) {
 
     (void)buffer;
@@ -327,9 +327,9 @@ void _uavcan_navigation_GlobalNavigationSolution_encode(uint8_t* buffer, uint32_
 /*
  decode uavcan_navigation_GlobalNavigationSolution, return true on failure, false on success
 */
-bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_navigation_GlobalNavigationSolution* msg, bool tao) {
+bool _uavcan_navigation_GlobalNavigationSolution_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_navigation_GlobalNavigationSolution* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -337,7 +337,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    if (_uavcan_Timestamp_decode(transfer, bit_ofs, &msg->timestamp, false)) {return true;}
+    if (_uavcan_Timestamp_decode(reader, bit_ofs, &msg->timestamp, false)) {return true;}
 
 
 
@@ -345,7 +345,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 64, true, &msg->longitude);
+    canardReadScalar(reader, *bit_ofs, 64, true, &msg->longitude);
 
     *bit_ofs += 64;
 
@@ -355,7 +355,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 64, true, &msg->latitude);
+    canardReadScalar(reader, *bit_ofs, 64, true, &msg->latitude);
 
     *bit_ofs += 64;
 
@@ -365,7 +365,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->height_ellipsoid);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->height_ellipsoid);
 
     *bit_ofs += 32;
 
@@ -375,7 +375,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->height_msl);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->height_msl);
 
     *bit_ofs += 32;
 
@@ -385,7 +385,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->height_agl);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->height_agl);
 
     *bit_ofs += 32;
 
@@ -395,7 +395,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->height_baro);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->height_baro);
 
     *bit_ofs += 32;
 
@@ -407,7 +407,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
     {
         uint16_t float16_val;
-        canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+        canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
         msg->qnh_hpa = canardConvertFloat16ToNativeFloat(float16_val);
     }
 
@@ -424,7 +424,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->orientation_xyzw[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->orientation_xyzw[i]);
 
         *bit_ofs += 32;
 
@@ -439,7 +439,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->pose_covariance.len);
+    canardReadScalar(reader, *bit_ofs, 6, false, &msg->pose_covariance.len);
     *bit_ofs += 6;
 
 
@@ -456,7 +456,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->pose_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -477,7 +477,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->linear_velocity_body[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->linear_velocity_body[i]);
 
         *bit_ofs += 32;
 
@@ -496,7 +496,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->angular_velocity_body[i]);
+        canardReadScalar(reader, *bit_ofs, 32, true, &msg->angular_velocity_body[i]);
 
         *bit_ofs += 32;
 
@@ -517,7 +517,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->linear_acceleration_body[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
@@ -537,14 +537,14 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->velocity_covariance.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->velocity_covariance.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->velocity_covariance.len = ((transfer->payload_len*8)-*bit_ofs)/16;
+        msg->velocity_covariance.len = ((reader->transfer->payload_len*8)-*bit_ofs)/16;
 
 
     }
@@ -564,7 +564,7 @@ bool _uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer*
 
         {
             uint16_t float16_val;
-            canardDecodeScalar(transfer, *bit_ofs, 16, true, &float16_val);
+            canardReadScalar(reader, *bit_ofs, 16, true, &float16_val);
             msg->velocity_covariance.data[i] = canardConvertFloat16ToNativeFloat(float16_val);
         }
 
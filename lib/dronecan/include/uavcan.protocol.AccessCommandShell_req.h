@@ -69,7 +69,7 @@ bool uavcan_protocol_AccessCommandShellRequest_decode(const CanardRxTransfer* tr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_AccessCommandShellRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellRequest* msg, bool tao);
-static inline bool _uavcan_protocol_AccessCommandShellRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellRequest* msg, bool tao);
+static inline bool _uavcan_protocol_AccessCommandShellRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellRequest* msg, bool tao);
 void _uavcan_protocol_AccessCommandShellRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellRequest* msg, bool tao) {
 
     (void)buffer;
@@ -126,9 +126,9 @@ void _uavcan_protocol_AccessCommandShellRequest_encode(uint8_t* buffer, uint32_t
 /*
  decode uavcan_protocol_AccessCommandShellRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_AccessCommandShellRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellRequest* msg, bool tao) {
+bool _uavcan_protocol_AccessCommandShellRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -137,7 +137,7 @@ bool _uavcan_protocol_AccessCommandShellRequest_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->flags);
 
     *bit_ofs += 8;
 
@@ -151,14 +151,14 @@ bool _uavcan_protocol_AccessCommandShellRequest_decode(const CanardRxTransfer* t
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->input.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->input.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->input.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->input.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -176,7 +176,7 @@ bool _uavcan_protocol_AccessCommandShellRequest_decode(const CanardRxTransfer* t
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->input.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->input.data[i]);
 
         *bit_ofs += 8;
 
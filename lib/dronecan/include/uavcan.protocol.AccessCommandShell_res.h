@@ -69,7 +69,7 @@ bool uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer* t
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_AccessCommandShellResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellResponse* msg, bool tao);
-static inline bool _uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellResponse* msg, bool tao);
+static inline bool _uavcan_protocol_AccessCommandShellResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellResponse* msg, bool tao);
 void _uavcan_protocol_AccessCommandShellResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellResponse* msg, bool tao) {
 
     (void)buffer;
@@ -135,9 +135,9 @@ void _uavcan_protocol_AccessCommandShellResponse_encode(uint8_t* buffer, uint32_
 /*
  decode uavcan_protocol_AccessCommandShellResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellResponse* msg, bool tao) {
+bool _uavcan_protocol_AccessCommandShellResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_AccessCommandShellResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -146,7 +146,7 @@ bool _uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->last_exit_status);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->last_exit_status);
 
     *bit_ofs += 32;
 
@@ -156,7 +156,7 @@ bool _uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->flags);
 
     *bit_ofs += 8;
 
@@ -170,14 +170,14 @@ bool _uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 9, false, &msg->output.len);
+        canardReadScalar(reader, *bit_ofs, 9, false, &msg->output.len);
         *bit_ofs += 9;
 
 
 
     } else {
 
-        msg->output.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->output.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -195,7 +195,7 @@ bool _uavcan_protocol_AccessCommandShellResponse_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->output.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->output.data[i]);
 
         *bit_ofs += 8;
 
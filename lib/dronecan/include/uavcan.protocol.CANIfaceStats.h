@@ -49,7 +49,7 @@ bool uavcan_protocol_CANIfaceStats_decode(const CanardRxTransfer* transfer, stru
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_CANIfaceStats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_CANIfaceStats* msg, bool tao);
-static inline bool _uavcan_protocol_CANIfaceStats_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_CANIfaceStats* msg, bool tao);
+static inline bool _uavcan_protocol_CANIfaceStats_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_CANIfaceStats* msg, bool tao);
 void _uavcan_protocol_CANIfaceStats_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_CANIfaceStats* msg, bool tao) {
 
     (void)buffer;
@@ -93,9 +93,9 @@ void _uavcan_protocol_CANIfaceStats_encode(uint8_t* buffer, uint32_t* bit_ofs, s
 /*
  decode uavcan_protocol_CANIfaceStats, return true on failure, false on success
 */
-bool _uavcan_protocol_CANIfaceStats_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_CANIfaceStats* msg, bool tao) {
+bool _uavcan_protocol_CANIfaceStats_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_CANIfaceStats* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -104,7 +104,7 @@ bool _uavcan_protocol_CANIfaceStats_decode(const CanardRxTransfer* transfer, uin
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, false, &msg->frames_tx);
+    canardReadScalar(reader, *bit_ofs, 48, false, &msg->frames_tx);
 
     *bit_ofs += 48;
 
@@ -114,7 +114,7 @@ bool _uavcan_protocol_CANIfaceStats_decode(const CanardRxTransfer* transfer, uin
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, false, &msg->frames_rx);
+    canardReadScalar(reader, *bit_ofs, 48, false, &msg->frames_rx);
 
     *bit_ofs += 48;
 
@@ -124,7 +124,7 @@ bool _uavcan_protocol_CANIfaceStats_decode(const CanardRxTransfer* transfer, uin
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, false, &msg->errors);
+    canardReadScalar(reader, *bit_ofs, 48, false, &msg->errors);
 
     *bit_ofs += 48;
 
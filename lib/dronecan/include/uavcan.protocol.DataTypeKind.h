@@ -47,7 +47,7 @@ bool uavcan_protocol_DataTypeKind_decode(const CanardRxTransfer* transfer, struc
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_DataTypeKind_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_DataTypeKind* msg, bool tao);
-static inline bool _uavcan_protocol_DataTypeKind_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_DataTypeKind* msg, bool tao);
+static inline bool _uavcan_protocol_DataTypeKind_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_DataTypeKind* msg, bool tao);
 void _uavcan_protocol_DataTypeKind_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_DataTypeKind* msg, bool tao) {
 
     (void)buffer;
@@ -73,9 +73,9 @@ void _uavcan_protocol_DataTypeKind_encode(uint8_t* buffer, uint32_t* bit_ofs, st
 /*
  decode uavcan_protocol_DataTypeKind, return true on failure, false on success
 */
-bool _uavcan_protocol_DataTypeKind_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_DataTypeKind* msg, bool tao) {
+bool _uavcan_protocol_DataTypeKind_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_DataTypeKind* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -84,7 +84,7 @@ bool _uavcan_protocol_DataTypeKind_decode(const CanardRxTransfer* transfer, uint
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->value);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->value);
 
     *bit_ofs += 8;
 
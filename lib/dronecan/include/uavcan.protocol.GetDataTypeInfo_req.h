@@ -61,7 +61,7 @@ bool uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* trans
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_GetDataTypeInfoRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoRequest* msg, bool tao);
-static inline bool _uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoRequest* msg, bool tao);
+static inline bool _uavcan_protocol_GetDataTypeInfoRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoRequest* msg, bool tao);
 void _uavcan_protocol_GetDataTypeInfoRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoRequest* msg, bool tao) {
 
     (void)buffer;
@@ -124,9 +124,9 @@ void _uavcan_protocol_GetDataTypeInfoRequest_encode(uint8_t* buffer, uint32_t* b
 /*
  decode uavcan_protocol_GetDataTypeInfoRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoRequest* msg, bool tao) {
+bool _uavcan_protocol_GetDataTypeInfoRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -135,7 +135,7 @@ bool _uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* tran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->id);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->id);
 
     *bit_ofs += 16;
 
@@ -144,7 +144,7 @@ bool _uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* tran
 
 
 
-    if (_uavcan_protocol_DataTypeKind_decode(transfer, bit_ofs, &msg->kind, false)) {return true;}
+    if (_uavcan_protocol_DataTypeKind_decode(reader, bit_ofs, &msg->kind, false)) {return true;}
 
 
 
@@ -156,14 +156,14 @@ bool _uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* tran
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -181,7 +181,7 @@ bool _uavcan_protocol_GetDataTypeInfoRequest_decode(const CanardRxTransfer* tran
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->name.data[i]);
 
         *bit_ofs += 8;
 
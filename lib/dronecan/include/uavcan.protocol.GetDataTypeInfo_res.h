@@ -79,7 +79,7 @@ bool uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tran
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_GetDataTypeInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoResponse* msg, bool tao);
-static inline bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoResponse* msg, bool tao);
+static inline bool _uavcan_protocol_GetDataTypeInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoResponse* msg, bool tao);
 void _uavcan_protocol_GetDataTypeInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoResponse* msg, bool tao) {
 
     (void)buffer;
@@ -160,9 +160,9 @@ void _uavcan_protocol_GetDataTypeInfoResponse_encode(uint8_t* buffer, uint32_t*
 /*
  decode uavcan_protocol_GetDataTypeInfoResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoResponse* msg, bool tao) {
+bool _uavcan_protocol_GetDataTypeInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetDataTypeInfoResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -171,7 +171,7 @@ bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 64, false, &msg->signature);
+    canardReadScalar(reader, *bit_ofs, 64, false, &msg->signature);
 
     *bit_ofs += 64;
 
@@ -181,7 +181,7 @@ bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->id);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->id);
 
     *bit_ofs += 16;
 
@@ -190,7 +190,7 @@ bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tra
 
 
 
-    if (_uavcan_protocol_DataTypeKind_decode(transfer, bit_ofs, &msg->kind, false)) {return true;}
+    if (_uavcan_protocol_DataTypeKind_decode(reader, bit_ofs, &msg->kind, false)) {return true;}
 
 
 
@@ -198,7 +198,7 @@ bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->flags);
 
     *bit_ofs += 8;
 
@@ -212,14 +212,14 @@ bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tra
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -237,7 +237,7 @@ bool _uavcan_protocol_GetDataTypeInfoResponse_decode(const CanardRxTransfer* tra
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->name.data[i]);
 
         *bit_ofs += 8;
 
@@ -69,7 +69,7 @@ bool uavcan_protocol_GetNodeInfoResponse_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_GetNodeInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetNodeInfoResponse* msg, bool tao);
-static inline bool _uavcan_protocol_GetNodeInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetNodeInfoResponse* msg, bool tao);
+static inline bool _uavcan_protocol_GetNodeInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetNodeInfoResponse* msg, bool tao);
 void _uavcan_protocol_GetNodeInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetNodeInfoResponse* msg, bool tao) {
 
     (void)buffer;
@@ -135,9 +135,9 @@ void _uavcan_protocol_GetNodeInfoResponse_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_protocol_GetNodeInfoResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_GetNodeInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetNodeInfoResponse* msg, bool tao) {
+bool _uavcan_protocol_GetNodeInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetNodeInfoResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -145,21 +145,21 @@ bool _uavcan_protocol_GetNodeInfoResponse_decode(const CanardRxTransfer* transfe
 
 
 
-    if (_uavcan_protocol_NodeStatus_decode(transfer, bit_ofs, &msg->status, false)) {return true;}
+    if (_uavcan_protocol_NodeStatus_decode(reader, bit_ofs, &msg->status, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_protocol_SoftwareVersion_decode(transfer, bit_ofs, &msg->software_version, false)) {return true;}
+    if (_uavcan_protocol_SoftwareVersion_decode(reader, bit_ofs, &msg->software_version, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_protocol_HardwareVersion_decode(transfer, bit_ofs, &msg->hardware_version, false)) {return true;}
+    if (_uavcan_protocol_HardwareVersion_decode(reader, bit_ofs, &msg->hardware_version, false)) {return true;}
 
 
 
@@ -171,14 +171,14 @@ bool _uavcan_protocol_GetNodeInfoResponse_decode(const CanardRxTransfer* transfe
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -196,7 +196,7 @@ bool _uavcan_protocol_GetNodeInfoResponse_decode(const CanardRxTransfer* transfe
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->name.data[i]);
 
         *bit_ofs += 8;
 
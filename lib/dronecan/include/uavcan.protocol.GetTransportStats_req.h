@@ -47,7 +47,7 @@ bool uavcan_protocol_GetTransportStatsRequest_decode(const CanardRxTransfer* tra
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_GetTransportStatsRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsRequest* msg, bool tao);
-static inline bool _uavcan_protocol_GetTransportStatsRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsRequest* msg, bool tao);
+static inline bool _uavcan_protocol_GetTransportStatsRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsRequest* msg, bool tao);
 void _uavcan_protocol_GetTransportStatsRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsRequest* msg, bool tao) {
 
     (void)buffer;
@@ -64,9 +64,9 @@ void _uavcan_protocol_GetTransportStatsRequest_encode(uint8_t* buffer, uint32_t*
 /*
  decode uavcan_protocol_GetTransportStatsRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_GetTransportStatsRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsRequest* msg, bool tao) {
+bool _uavcan_protocol_GetTransportStatsRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
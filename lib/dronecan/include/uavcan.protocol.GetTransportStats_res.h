@@ -65,7 +65,7 @@ bool uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* tr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_GetTransportStatsResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsResponse* msg, bool tao);
-static inline bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsResponse* msg, bool tao);
+static inline bool _uavcan_protocol_GetTransportStatsResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsResponse* msg, bool tao);
 void _uavcan_protocol_GetTransportStatsResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsResponse* msg, bool tao) {
 
     (void)buffer;
@@ -137,9 +137,9 @@ void _uavcan_protocol_GetTransportStatsResponse_encode(uint8_t* buffer, uint32_t
 /*
  decode uavcan_protocol_GetTransportStatsResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsResponse* msg, bool tao) {
+bool _uavcan_protocol_GetTransportStatsResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GetTransportStatsResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -148,7 +148,7 @@ bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, false, &msg->transfers_tx);
+    canardReadScalar(reader, *bit_ofs, 48, false, &msg->transfers_tx);
 
     *bit_ofs += 48;
 
@@ -158,7 +158,7 @@ bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, false, &msg->transfers_rx);
+    canardReadScalar(reader, *bit_ofs, 48, false, &msg->transfers_rx);
 
     *bit_ofs += 48;
 
@@ -168,7 +168,7 @@ bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, false, &msg->transfer_errors);
+    canardReadScalar(reader, *bit_ofs, 48, false, &msg->transfer_errors);
 
     *bit_ofs += 48;
 
@@ -182,7 +182,7 @@ bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* t
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 2, false, &msg->can_iface_stats.len);
+        canardReadScalar(reader, *bit_ofs, 2, false, &msg->can_iface_stats.len);
         *bit_ofs += 2;
 
 
@@ -197,10 +197,10 @@ bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* t
 
         msg->can_iface_stats.len = 0;
         size_t max_len = 3;
-        uint32_t max_bits = (transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
+        uint32_t max_bits = (reader->transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
         while (max_bits > *bit_ofs) {
 
-            if (!max_len-- || _uavcan_protocol_CANIfaceStats_decode(transfer, bit_ofs, &msg->can_iface_stats.data[msg->can_iface_stats.len], false)) {return true;}
+            if (!max_len-- || _uavcan_protocol_CANIfaceStats_decode(reader, bit_ofs, &msg->can_iface_stats.data[msg->can_iface_stats.len], false)) {return true;}
             msg->can_iface_stats.len++;
 
         }
@@ -219,7 +219,7 @@ bool _uavcan_protocol_GetTransportStatsResponse_decode(const CanardRxTransfer* t
 
 
 
-            if (_uavcan_protocol_CANIfaceStats_decode(transfer, bit_ofs, &msg->can_iface_stats.data[i], false)) {return true;}
+            if (_uavcan_protocol_CANIfaceStats_decode(reader, bit_ofs, &msg->can_iface_stats.data[i], false)) {return true;}
 
 
         }
@@ -59,7 +59,7 @@ bool uavcan_protocol_GlobalTimeSync_decode(const CanardRxTransfer* transfer, str
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_GlobalTimeSync_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GlobalTimeSync* msg, bool tao);
-static inline bool _uavcan_protocol_GlobalTimeSync_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GlobalTimeSync* msg, bool tao);
+static inline bool _uavcan_protocol_GlobalTimeSync_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GlobalTimeSync* msg, bool tao);
 void _uavcan_protocol_GlobalTimeSync_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_GlobalTimeSync* msg, bool tao) {
 
     (void)buffer;
@@ -85,9 +85,9 @@ void _uavcan_protocol_GlobalTimeSync_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_protocol_GlobalTimeSync, return true on failure, false on success
 */
-bool _uavcan_protocol_GlobalTimeSync_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_GlobalTimeSync* msg, bool tao) {
+bool _uavcan_protocol_GlobalTimeSync_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_GlobalTimeSync* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -96,7 +96,7 @@ bool _uavcan_protocol_GlobalTimeSync_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 56, false, &msg->previous_transmission_timestamp_usec);
+    canardReadScalar(reader, *bit_ofs, 56, false, &msg->previous_transmission_timestamp_usec);
 
     *bit_ofs += 56;
 
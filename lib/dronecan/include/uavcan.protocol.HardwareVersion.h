@@ -53,7 +53,7 @@ bool uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, st
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_HardwareVersion_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_HardwareVersion* msg, bool tao);
-static inline bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_HardwareVersion* msg, bool tao);
+static inline bool _uavcan_protocol_HardwareVersion_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_HardwareVersion* msg, bool tao);
 void _uavcan_protocol_HardwareVersion_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_HardwareVersion* msg, bool tao) {
 
     (void)buffer;
@@ -136,9 +136,9 @@ void _uavcan_protocol_HardwareVersion_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_protocol_HardwareVersion, return true on failure, false on success
 */
-bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_HardwareVersion* msg, bool tao) {
+bool _uavcan_protocol_HardwareVersion_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_HardwareVersion* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -147,7 +147,7 @@ bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->major);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->major);
 
     *bit_ofs += 8;
 
@@ -157,7 +157,7 @@ bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->minor);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->minor);
 
     *bit_ofs += 8;
 
@@ -172,7 +172,7 @@ bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->unique_id[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->unique_id[i]);
 
         *bit_ofs += 8;
 
@@ -190,14 +190,14 @@ bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, u
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->certificate_of_authenticity.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->certificate_of_authenticity.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->certificate_of_authenticity.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->certificate_of_authenticity.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -215,7 +215,7 @@ bool _uavcan_protocol_HardwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->certificate_of_authenticity.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->certificate_of_authenticity.data[i]);
 
         *bit_ofs += 8;
 
@@ -93,7 +93,7 @@ bool uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_NodeStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_NodeStatus* msg, bool tao);
-static inline bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_NodeStatus* msg, bool tao);
+static inline bool _uavcan_protocol_NodeStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_NodeStatus* msg, bool tao);
 void _uavcan_protocol_NodeStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_NodeStatus* msg, bool tao) {
 
     (void)buffer;
@@ -155,9 +155,9 @@ void _uavcan_protocol_NodeStatus_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode uavcan_protocol_NodeStatus, return true on failure, false on success
 */
-bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_NodeStatus* msg, bool tao) {
+bool _uavcan_protocol_NodeStatus_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_NodeStatus* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -166,7 +166,7 @@ bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->uptime_sec);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->uptime_sec);
 
     *bit_ofs += 32;
 
@@ -176,7 +176,7 @@ bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 2, false, &msg->health);
+    canardReadScalar(reader, *bit_ofs, 2, false, &msg->health);
 
     *bit_ofs += 2;
 
@@ -186,7 +186,7 @@ bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->mode);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->mode);
 
     *bit_ofs += 3;
 
@@ -196,7 +196,7 @@ bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->sub_mode);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->sub_mode);
 
     *bit_ofs += 3;
 
@@ -206,7 +206,7 @@ bool _uavcan_protocol_NodeStatus_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->vendor_specific_status_code);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->vendor_specific_status_code);
 
     *bit_ofs += 16;
 
@@ -57,7 +57,7 @@ bool uavcan_protocol_Panic_decode(const CanardRxTransfer* transfer, struct uavca
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_Panic_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_Panic* msg, bool tao);
-static inline bool _uavcan_protocol_Panic_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_Panic* msg, bool tao);
+static inline bool _uavcan_protocol_Panic_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_Panic* msg, bool tao);
 void _uavcan_protocol_Panic_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_Panic* msg, bool tao) {
 
     (void)buffer;
@@ -105,9 +105,9 @@ void _uavcan_protocol_Panic_encode(uint8_t* buffer, uint32_t* bit_ofs, struct ua
 /*
  decode uavcan_protocol_Panic, return true on failure, false on success
 */
-bool _uavcan_protocol_Panic_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_Panic* msg, bool tao) {
+bool _uavcan_protocol_Panic_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_Panic* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -120,14 +120,14 @@ bool _uavcan_protocol_Panic_decode(const CanardRxTransfer* transfer, uint32_t* b
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->reason_text.len);
+        canardReadScalar(reader, *bit_ofs, 3, false, &msg->reason_text.len);
         *bit_ofs += 3;
 
 
 
     } else {
 
-        msg->reason_text.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->reason_text.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -145,7 +145,7 @@ bool _uavcan_protocol_Panic_decode(const CanardRxTransfer* transfer, uint32_t* b
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->reason_text.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->reason_text.data[i]);
 
         *bit_ofs += 8;
 
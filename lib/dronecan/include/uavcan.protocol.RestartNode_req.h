@@ -55,7 +55,7 @@ bool uavcan_protocol_RestartNodeRequest_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_RestartNodeRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeRequest* msg, bool tao);
-static inline bool _uavcan_protocol_RestartNodeRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeRequest* msg, bool tao);
+static inline bool _uavcan_protocol_RestartNodeRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeRequest* msg, bool tao);
 void _uavcan_protocol_RestartNodeRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeRequest* msg, bool tao) {
 
     (void)buffer;
@@ -81,9 +81,9 @@ void _uavcan_protocol_RestartNodeRequest_encode(uint8_t* buffer, uint32_t* bit_o
 /*
  decode uavcan_protocol_RestartNodeRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_RestartNodeRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeRequest* msg, bool tao) {
+bool _uavcan_protocol_RestartNodeRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -92,7 +92,7 @@ bool _uavcan_protocol_RestartNodeRequest_decode(const CanardRxTransfer* transfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 40, false, &msg->magic_number);
+    canardReadScalar(reader, *bit_ofs, 40, false, &msg->magic_number);
 
     *bit_ofs += 40;
 
@@ -51,7 +51,7 @@ bool uavcan_protocol_RestartNodeResponse_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_RestartNodeResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeResponse* msg, bool tao);
-static inline bool _uavcan_protocol_RestartNodeResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeResponse* msg, bool tao);
+static inline bool _uavcan_protocol_RestartNodeResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeResponse* msg, bool tao);
 void _uavcan_protocol_RestartNodeResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeResponse* msg, bool tao) {
 
     (void)buffer;
@@ -77,9 +77,9 @@ void _uavcan_protocol_RestartNodeResponse_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_protocol_RestartNodeResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_RestartNodeResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeResponse* msg, bool tao) {
+bool _uavcan_protocol_RestartNodeResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_RestartNodeResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -88,7 +88,7 @@ bool _uavcan_protocol_RestartNodeResponse_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->ok);
+    canardReadScalar(reader, *bit_ofs, 1, false, &msg->ok);
 
     *bit_ofs += 1;
 
@@ -63,7 +63,7 @@ bool uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, st
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_SoftwareVersion_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_SoftwareVersion* msg, bool tao);
-static inline bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_SoftwareVersion* msg, bool tao);
+static inline bool _uavcan_protocol_SoftwareVersion_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_SoftwareVersion* msg, bool tao);
 void _uavcan_protocol_SoftwareVersion_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_SoftwareVersion* msg, bool tao) {
 
     (void)buffer;
@@ -125,9 +125,9 @@ void _uavcan_protocol_SoftwareVersion_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_protocol_SoftwareVersion, return true on failure, false on success
 */
-bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_SoftwareVersion* msg, bool tao) {
+bool _uavcan_protocol_SoftwareVersion_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_SoftwareVersion* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -136,7 +136,7 @@ bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->major);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->major);
 
     *bit_ofs += 8;
 
@@ -146,7 +146,7 @@ bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->minor);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->minor);
 
     *bit_ofs += 8;
 
@@ -156,7 +156,7 @@ bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->optional_field_flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->optional_field_flags);
 
     *bit_ofs += 8;
 
@@ -166,7 +166,7 @@ bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->vcs_commit);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->vcs_commit);
 
     *bit_ofs += 32;
 
@@ -176,7 +176,7 @@ bool _uavcan_protocol_SoftwareVersion_decode(const CanardRxTransfer* transfer, u
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 64, false, &msg->image_crc);
+    canardReadScalar(reader, *bit_ofs, 64, false, &msg->image_crc);
 
     *bit_ofs += 64;
 
@@ -55,7 +55,7 @@ bool uavcan_protocol_debug_KeyValue_decode(const CanardRxTransfer* transfer, str
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_debug_KeyValue_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_debug_KeyValue* msg, bool tao);
-static inline bool _uavcan_protocol_debug_KeyValue_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_debug_KeyValue* msg, bool tao);
+static inline bool _uavcan_protocol_debug_KeyValue_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_debug_KeyValue* msg, bool tao);
 void _uavcan_protocol_debug_KeyValue_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_debug_KeyValue* msg, bool tao) {
 
     (void)buffer;
@@ -112,9 +112,9 @@ void _uavcan_protocol_debug_KeyValue_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_protocol_debug_KeyValue, return true on failure, false on success
 */
-bool _uavcan_protocol_debug_KeyValue_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_debug_KeyValue* msg, bool tao) {
+bool _uavcan_protocol_debug_KeyValue_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_debug_KeyValue* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -123,7 +123,7 @@ bool _uavcan_protocol_debug_KeyValue_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->value);
+    canardReadScalar(reader, *bit_ofs, 32, true, &msg->value);
 
     *bit_ofs += 32;
 
@@ -137,14 +137,14 @@ bool _uavcan_protocol_debug_KeyValue_decode(const CanardRxTransfer* transfer, ui
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->key.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->key.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->key.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->key.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -162,7 +162,7 @@ bool _uavcan_protocol_debug_KeyValue_decode(const CanardRxTransfer* transfer, ui
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->key.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->key.data[i]);
 
         *bit_ofs += 8;
 
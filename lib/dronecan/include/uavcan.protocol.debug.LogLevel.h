@@ -51,7 +51,7 @@ bool uavcan_protocol_debug_LogLevel_decode(const CanardRxTransfer* transfer, str
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_debug_LogLevel_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogLevel* msg, bool tao);
-static inline bool _uavcan_protocol_debug_LogLevel_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogLevel* msg, bool tao);
+static inline bool _uavcan_protocol_debug_LogLevel_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogLevel* msg, bool tao);
 void _uavcan_protocol_debug_LogLevel_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogLevel* msg, bool tao) {
 
     (void)buffer;
@@ -77,9 +77,9 @@ void _uavcan_protocol_debug_LogLevel_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_protocol_debug_LogLevel, return true on failure, false on success
 */
-bool _uavcan_protocol_debug_LogLevel_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogLevel* msg, bool tao) {
+bool _uavcan_protocol_debug_LogLevel_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogLevel* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -88,7 +88,7 @@ bool _uavcan_protocol_debug_LogLevel_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->value);
+    canardReadScalar(reader, *bit_ofs, 3, false, &msg->value);
 
     *bit_ofs += 3;
 
@@ -61,7 +61,7 @@ bool uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer, s
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_debug_LogMessage_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogMessage* msg, bool tao);
-static inline bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogMessage* msg, bool tao);
+static inline bool _uavcan_protocol_debug_LogMessage_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogMessage* msg, bool tao);
 void _uavcan_protocol_debug_LogMessage_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogMessage* msg, bool tao) {
 
     (void)buffer;
@@ -140,9 +140,9 @@ void _uavcan_protocol_debug_LogMessage_encode(uint8_t* buffer, uint32_t* bit_ofs
 /*
  decode uavcan_protocol_debug_LogMessage, return true on failure, false on success
 */
-bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogMessage* msg, bool tao) {
+bool _uavcan_protocol_debug_LogMessage_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_debug_LogMessage* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -150,7 +150,7 @@ bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer,
 
 
 
-    if (_uavcan_protocol_debug_LogLevel_decode(transfer, bit_ofs, &msg->level, false)) {return true;}
+    if (_uavcan_protocol_debug_LogLevel_decode(reader, bit_ofs, &msg->level, false)) {return true;}
 
 
 
@@ -159,7 +159,7 @@ bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->source.len);
+    canardReadScalar(reader, *bit_ofs, 5, false, &msg->source.len);
     *bit_ofs += 5;
 
 
@@ -174,7 +174,7 @@ bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer,
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->source.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->source.data[i]);
 
         *bit_ofs += 8;
 
@@ -192,14 +192,14 @@ bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer,
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->text.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->text.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->text.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->text.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -217,7 +217,7 @@ bool _uavcan_protocol_debug_LogMessage_decode(const CanardRxTransfer* transfer,
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->text.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->text.data[i]);
 
         *bit_ofs += 8;
 
@@ -75,7 +75,7 @@ bool uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer* t
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_dynamic_node_id_Allocation_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_Allocation* msg, bool tao);
-static inline bool _uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_Allocation* msg, bool tao);
+static inline bool _uavcan_protocol_dynamic_node_id_Allocation_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_Allocation* msg, bool tao);
 void _uavcan_protocol_dynamic_node_id_Allocation_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_Allocation* msg, bool tao) {
 
     (void)buffer;
@@ -141,9 +141,9 @@ void _uavcan_protocol_dynamic_node_id_Allocation_encode(uint8_t* buffer, uint32_
 /*
  decode uavcan_protocol_dynamic_node_id_Allocation, return true on failure, false on success
 */
-bool _uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_Allocation* msg, bool tao) {
+bool _uavcan_protocol_dynamic_node_id_Allocation_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_Allocation* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -152,7 +152,7 @@ bool _uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->node_id);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->node_id);
 
     *bit_ofs += 7;
 
@@ -162,7 +162,7 @@ bool _uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->first_part_of_unique_id);
+    canardReadScalar(reader, *bit_ofs, 1, false, &msg->first_part_of_unique_id);
 
     *bit_ofs += 1;
 
@@ -176,14 +176,14 @@ bool _uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 5, false, &msg->unique_id.len);
+        canardReadScalar(reader, *bit_ofs, 5, false, &msg->unique_id.len);
         *bit_ofs += 5;
 
 
 
     } else {
 
-        msg->unique_id.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->unique_id.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -201,7 +201,7 @@ bool _uavcan_protocol_dynamic_node_id_Allocation_decode(const CanardRxTransfer*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->unique_id.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->unique_id.data[i]);
 
         *bit_ofs += 8;
 
@@ -75,7 +75,7 @@ bool uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const Ca
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest* msg, bool tao);
-static inline bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest* msg, bool tao);
+static inline bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest* msg, bool tao);
 void _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest* msg, bool tao) {
 
     (void)buffer;
@@ -156,9 +156,9 @@ void _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_encode(uint8_t
 /*
  decode uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest* msg, bool tao) {
+bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -167,7 +167,7 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->term);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->term);
 
     *bit_ofs += 32;
 
@@ -177,7 +177,7 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->prev_log_term);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->prev_log_term);
 
     *bit_ofs += 32;
 
@@ -187,7 +187,7 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->prev_log_index);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->prev_log_index);
 
     *bit_ofs += 8;
 
@@ -197,7 +197,7 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->leader_commit);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->leader_commit);
 
     *bit_ofs += 8;
 
@@ -211,7 +211,7 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->entries.len);
+        canardReadScalar(reader, *bit_ofs, 1, false, &msg->entries.len);
         *bit_ofs += 1;
 
 
@@ -226,10 +226,10 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
 
         msg->entries.len = 0;
         size_t max_len = 1;
-        uint32_t max_bits = (transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
+        uint32_t max_bits = (reader->transfer->payload_len*8)-7; // TAO elements must be >= 8 bits
         while (max_bits > *bit_ofs) {
 
-            if (!max_len-- || _uavcan_protocol_dynamic_node_id_server_Entry_decode(transfer, bit_ofs, &msg->entries.data[msg->entries.len], false)) {return true;}
+            if (!max_len-- || _uavcan_protocol_dynamic_node_id_server_Entry_decode(reader, bit_ofs, &msg->entries.data[msg->entries.len], false)) {return true;}
             msg->entries.len++;
 
         }
@@ -248,7 +248,7 @@ bool _uavcan_protocol_dynamic_node_id_server_AppendEntriesRequest_decode(const C
 
 
 
-            if (_uavcan_protocol_dynamic_node_id_server_Entry_decode(transfer, bit_ofs, &msg->entries.data[i], false)) {return true;}
+            if (_uavcan_protocol_dynamic_node_id_server_Entry_decode(reader, bit_ofs, &msg->entries.data[i], false)) {return true;}
 
 
         }
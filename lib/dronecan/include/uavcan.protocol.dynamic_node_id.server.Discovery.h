@@ -59,7 +59,7 @@ bool uavcan_protocol_dynamic_node_id_server_Discovery_decode(const CanardRxTrans
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_dynamic_node_id_server_Discovery_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Discovery* msg, bool tao);
-static inline bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Discovery* msg, bool tao);
+static inline bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Discovery* msg, bool tao);
 void _uavcan_protocol_dynamic_node_id_server_Discovery_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Discovery* msg, bool tao) {
 
     (void)buffer;
@@ -116,9 +116,9 @@ void _uavcan_protocol_dynamic_node_id_server_Discovery_encode(uint8_t* buffer, u
 /*
  decode uavcan_protocol_dynamic_node_id_server_Discovery, return true on failure, false on success
 */
-bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Discovery* msg, bool tao) {
+bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Discovery* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -127,7 +127,7 @@ bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(const CanardRxTran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->configured_cluster_size);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->configured_cluster_size);
 
     *bit_ofs += 8;
 
@@ -141,14 +141,14 @@ bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(const CanardRxTran
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 3, false, &msg->known_nodes.len);
+        canardReadScalar(reader, *bit_ofs, 3, false, &msg->known_nodes.len);
         *bit_ofs += 3;
 
 
 
     } else {
 
-        msg->known_nodes.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->known_nodes.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -166,7 +166,7 @@ bool _uavcan_protocol_dynamic_node_id_server_Discovery_decode(const CanardRxTran
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->known_nodes.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->known_nodes.data[i]);
 
         *bit_ofs += 8;
 
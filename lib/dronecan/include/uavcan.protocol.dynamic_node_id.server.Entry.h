@@ -51,7 +51,7 @@ bool uavcan_protocol_dynamic_node_id_server_Entry_decode(const CanardRxTransfer*
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_dynamic_node_id_server_Entry_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Entry* msg, bool tao);
-static inline bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Entry* msg, bool tao);
+static inline bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Entry* msg, bool tao);
 void _uavcan_protocol_dynamic_node_id_server_Entry_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Entry* msg, bool tao) {
 
     (void)buffer;
@@ -109,9 +109,9 @@ void _uavcan_protocol_dynamic_node_id_server_Entry_encode(uint8_t* buffer, uint3
 /*
  decode uavcan_protocol_dynamic_node_id_server_Entry, return true on failure, false on success
 */
-bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Entry* msg, bool tao) {
+bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_Entry* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -120,7 +120,7 @@ bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->term);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->term);
 
     *bit_ofs += 32;
 
@@ -135,7 +135,7 @@ bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(const CanardRxTransfer
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->unique_id[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->unique_id[i]);
 
         *bit_ofs += 8;
 
@@ -156,7 +156,7 @@ bool _uavcan_protocol_dynamic_node_id_server_Entry_decode(const CanardRxTransfer
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->node_id);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->node_id);
 
     *bit_ofs += 7;
 
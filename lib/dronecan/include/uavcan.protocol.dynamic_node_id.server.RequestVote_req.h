@@ -59,7 +59,7 @@ bool uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(const Cana
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteRequest* msg, bool tao);
-static inline bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteRequest* msg, bool tao);
+static inline bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteRequest* msg, bool tao);
 void _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteRequest* msg, bool tao) {
 
     (void)buffer;
@@ -103,9 +103,9 @@ void _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_encode(uint8_t*
 /*
  decode uavcan_protocol_dynamic_node_id_server_RequestVoteRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteRequest* msg, bool tao) {
+bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -114,7 +114,7 @@ bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(const Can
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->term);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->term);
 
     *bit_ofs += 32;
 
@@ -124,7 +124,7 @@ bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(const Can
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->last_log_term);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->last_log_term);
 
     *bit_ofs += 32;
 
@@ -134,7 +134,7 @@ bool _uavcan_protocol_dynamic_node_id_server_RequestVoteRequest_decode(const Can
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->last_log_index);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->last_log_index);
 
     *bit_ofs += 8;
 
@@ -55,7 +55,7 @@ bool uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(const Can
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteResponse* msg, bool tao);
-static inline bool _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteResponse* msg, bool tao);
+static inline bool _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteResponse* msg, bool tao);
 void _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteResponse* msg, bool tao) {
 
     (void)buffer;
@@ -90,9 +90,9 @@ void _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_encode(uint8_t*
 /*
  decode uavcan_protocol_dynamic_node_id_server_RequestVoteResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteResponse* msg, bool tao) {
+bool _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_dynamic_node_id_server_RequestVoteResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -101,7 +101,7 @@ bool _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(const Ca
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->term);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->term);
 
     *bit_ofs += 32;
 
@@ -111,7 +111,7 @@ bool _uavcan_protocol_dynamic_node_id_server_RequestVoteResponse_decode(const Ca
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->vote_granted);
+    canardReadScalar(reader, *bit_ofs, 1, false, &msg->vote_granted);
 
     *bit_ofs += 1;
 
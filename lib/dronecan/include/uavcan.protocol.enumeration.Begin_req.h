@@ -61,7 +61,7 @@ bool uavcan_protocol_enumeration_BeginRequest_decode(const CanardRxTransfer* tra
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_enumeration_BeginRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginRequest* msg, bool tao);
-static inline bool _uavcan_protocol_enumeration_BeginRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginRequest* msg, bool tao);
+static inline bool _uavcan_protocol_enumeration_BeginRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginRequest* msg, bool tao);
 void _uavcan_protocol_enumeration_BeginRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginRequest* msg, bool tao) {
 
     (void)buffer;
@@ -118,9 +118,9 @@ void _uavcan_protocol_enumeration_BeginRequest_encode(uint8_t* buffer, uint32_t*
 /*
  decode uavcan_protocol_enumeration_BeginRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_enumeration_BeginRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginRequest* msg, bool tao) {
+bool _uavcan_protocol_enumeration_BeginRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -129,7 +129,7 @@ bool _uavcan_protocol_enumeration_BeginRequest_decode(const CanardRxTransfer* tr
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, false, &msg->timeout_sec);
+    canardReadScalar(reader, *bit_ofs, 16, false, &msg->timeout_sec);
 
     *bit_ofs += 16;
 
@@ -143,14 +143,14 @@ bool _uavcan_protocol_enumeration_BeginRequest_decode(const CanardRxTransfer* tr
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->parameter_name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->parameter_name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->parameter_name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->parameter_name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -168,7 +168,7 @@ bool _uavcan_protocol_enumeration_BeginRequest_decode(const CanardRxTransfer* tr
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->parameter_name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->parameter_name.data[i]);
 
         *bit_ofs += 8;
 
@@ -63,7 +63,7 @@ bool uavcan_protocol_enumeration_BeginResponse_decode(const CanardRxTransfer* tr
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_enumeration_BeginResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginResponse* msg, bool tao);
-static inline bool _uavcan_protocol_enumeration_BeginResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginResponse* msg, bool tao);
+static inline bool _uavcan_protocol_enumeration_BeginResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginResponse* msg, bool tao);
 void _uavcan_protocol_enumeration_BeginResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginResponse* msg, bool tao) {
 
     (void)buffer;
@@ -89,9 +89,9 @@ void _uavcan_protocol_enumeration_BeginResponse_encode(uint8_t* buffer, uint32_t
 /*
  decode uavcan_protocol_enumeration_BeginResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_enumeration_BeginResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginResponse* msg, bool tao) {
+bool _uavcan_protocol_enumeration_BeginResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_BeginResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -100,7 +100,7 @@ bool _uavcan_protocol_enumeration_BeginResponse_decode(const CanardRxTransfer* t
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->error);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->error);
 
     *bit_ofs += 8;
 
@@ -59,7 +59,7 @@ bool uavcan_protocol_enumeration_Indication_decode(const CanardRxTransfer* trans
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_enumeration_Indication_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_Indication* msg, bool tao);
-static inline bool _uavcan_protocol_enumeration_Indication_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_Indication* msg, bool tao);
+static inline bool _uavcan_protocol_enumeration_Indication_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_Indication* msg, bool tao);
 void _uavcan_protocol_enumeration_Indication_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_Indication* msg, bool tao) {
 
     (void)buffer;
@@ -119,9 +119,9 @@ void _uavcan_protocol_enumeration_Indication_encode(uint8_t* buffer, uint32_t* b
 /*
  decode uavcan_protocol_enumeration_Indication, return true on failure, false on success
 */
-bool _uavcan_protocol_enumeration_Indication_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_Indication* msg, bool tao) {
+bool _uavcan_protocol_enumeration_Indication_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_enumeration_Indication* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -136,7 +136,7 @@ bool _uavcan_protocol_enumeration_Indication_decode(const CanardRxTransfer* tran
 
 
 
-    if (_uavcan_protocol_param_NumericValue_decode(transfer, bit_ofs, &msg->value, false)) {return true;}
+    if (_uavcan_protocol_param_NumericValue_decode(reader, bit_ofs, &msg->value, false)) {return true;}
 
 
 
@@ -148,14 +148,14 @@ bool _uavcan_protocol_enumeration_Indication_decode(const CanardRxTransfer* tran
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->parameter_name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->parameter_name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->parameter_name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->parameter_name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -173,7 +173,7 @@ bool _uavcan_protocol_enumeration_Indication_decode(const CanardRxTransfer* tran
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->parameter_name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->parameter_name.data[i]);
 
         *bit_ofs += 8;
 
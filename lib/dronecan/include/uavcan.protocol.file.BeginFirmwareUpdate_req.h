@@ -57,7 +57,7 @@ bool uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(const CanardRxTransf
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_BeginFirmwareUpdateRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateRequest* msg, bool tao);
-static inline bool _uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateRequest* msg, bool tao);
+static inline bool _uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateRequest* msg, bool tao);
 void _uavcan_protocol_file_BeginFirmwareUpdateRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateRequest* msg, bool tao) {
 
     (void)buffer;
@@ -89,9 +89,9 @@ void _uavcan_protocol_file_BeginFirmwareUpdateRequest_encode(uint8_t* buffer, ui
 /*
  decode uavcan_protocol_file_BeginFirmwareUpdateRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateRequest* msg, bool tao) {
+bool _uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -100,7 +100,7 @@ bool _uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(const CanardRxTrans
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->source_node_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->source_node_id);
 
     *bit_ofs += 8;
 
@@ -109,7 +109,7 @@ bool _uavcan_protocol_file_BeginFirmwareUpdateRequest_decode(const CanardRxTrans
 
 
 
-    if (_uavcan_protocol_file_Path_decode(transfer, bit_ofs, &msg->image_file_remote_path, tao)) {return true;}
+    if (_uavcan_protocol_file_Path_decode(reader, bit_ofs, &msg->image_file_remote_path, tao)) {return true;}
 
 
 
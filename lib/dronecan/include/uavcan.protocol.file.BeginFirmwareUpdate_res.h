@@ -65,7 +65,7 @@ bool uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(const CanardRxTrans
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_BeginFirmwareUpdateResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateResponse* msg, bool tao);
-static inline bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateResponse* msg, bool tao);
+static inline bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateResponse* msg, bool tao);
 void _uavcan_protocol_file_BeginFirmwareUpdateResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateResponse* msg, bool tao) {
 
     (void)buffer;
@@ -122,9 +122,9 @@ void _uavcan_protocol_file_BeginFirmwareUpdateResponse_encode(uint8_t* buffer, u
 /*
  decode uavcan_protocol_file_BeginFirmwareUpdateResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateResponse* msg, bool tao) {
+bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_BeginFirmwareUpdateResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -133,7 +133,7 @@ bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(const CanardRxTran
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->error);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->error);
 
     *bit_ofs += 8;
 
@@ -147,14 +147,14 @@ bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(const CanardRxTran
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->optional_error_message.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->optional_error_message.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->optional_error_message.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->optional_error_message.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -172,7 +172,7 @@ bool _uavcan_protocol_file_BeginFirmwareUpdateResponse_decode(const CanardRxTran
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->optional_error_message.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->optional_error_message.data[i]);
 
         *bit_ofs += 8;
 
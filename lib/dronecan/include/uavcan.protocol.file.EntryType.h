@@ -53,7 +53,7 @@ bool uavcan_protocol_file_EntryType_decode(const CanardRxTransfer* transfer, str
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_EntryType_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_EntryType* msg, bool tao);
-static inline bool _uavcan_protocol_file_EntryType_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_EntryType* msg, bool tao);
+static inline bool _uavcan_protocol_file_EntryType_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_EntryType* msg, bool tao);
 void _uavcan_protocol_file_EntryType_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_EntryType* msg, bool tao) {
 
     (void)buffer;
@@ -79,9 +79,9 @@ void _uavcan_protocol_file_EntryType_encode(uint8_t* buffer, uint32_t* bit_ofs,
 /*
  decode uavcan_protocol_file_EntryType, return true on failure, false on success
 */
-bool _uavcan_protocol_file_EntryType_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_EntryType* msg, bool tao) {
+bool _uavcan_protocol_file_EntryType_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_EntryType* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -90,7 +90,7 @@ bool _uavcan_protocol_file_EntryType_decode(const CanardRxTransfer* transfer, ui
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->flags);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->flags);
 
     *bit_ofs += 8;
 
@@ -63,7 +63,7 @@ bool uavcan_protocol_file_Error_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_Error_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_Error* msg, bool tao);
-static inline bool _uavcan_protocol_file_Error_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_Error* msg, bool tao);
+static inline bool _uavcan_protocol_file_Error_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_Error* msg, bool tao);
 void _uavcan_protocol_file_Error_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_Error* msg, bool tao) {
 
     (void)buffer;
@@ -89,9 +89,9 @@ void _uavcan_protocol_file_Error_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode uavcan_protocol_file_Error, return true on failure, false on success
 */
-bool _uavcan_protocol_file_Error_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_Error* msg, bool tao) {
+bool _uavcan_protocol_file_Error_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_Error* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -100,7 +100,7 @@ bool _uavcan_protocol_file_Error_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 16, true, &msg->value);
+    canardReadScalar(reader, *bit_ofs, 16, true, &msg->value);
 
     *bit_ofs += 16;
 
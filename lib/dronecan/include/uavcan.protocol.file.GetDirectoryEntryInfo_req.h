@@ -57,7 +57,7 @@ bool uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(const CanardRxTran
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_GetDirectoryEntryInfoRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoRequest* msg, bool tao);
-static inline bool _uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoRequest* msg, bool tao);
+static inline bool _uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoRequest* msg, bool tao);
 void _uavcan_protocol_file_GetDirectoryEntryInfoRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoRequest* msg, bool tao) {
 
     (void)buffer;
@@ -89,9 +89,9 @@ void _uavcan_protocol_file_GetDirectoryEntryInfoRequest_encode(uint8_t* buffer,
 /*
  decode uavcan_protocol_file_GetDirectoryEntryInfoRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoRequest* msg, bool tao) {
+bool _uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -100,7 +100,7 @@ bool _uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(const CanardRxTra
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->entry_index);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->entry_index);
 
     *bit_ofs += 32;
 
@@ -109,7 +109,7 @@ bool _uavcan_protocol_file_GetDirectoryEntryInfoRequest_decode(const CanardRxTra
 
 
 
-    if (_uavcan_protocol_file_Path_decode(transfer, bit_ofs, &msg->directory_path, tao)) {return true;}
+    if (_uavcan_protocol_file_Path_decode(reader, bit_ofs, &msg->directory_path, tao)) {return true;}
 
 
 
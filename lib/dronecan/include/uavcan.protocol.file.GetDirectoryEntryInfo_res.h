@@ -65,7 +65,7 @@ bool uavcan_protocol_file_GetDirectoryEntryInfoResponse_decode(const CanardRxTra
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_GetDirectoryEntryInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoResponse* msg, bool tao);
-static inline bool _uavcan_protocol_file_GetDirectoryEntryInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoResponse* msg, bool tao);
+static inline bool _uavcan_protocol_file_GetDirectoryEntryInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoResponse* msg, bool tao);
 void _uavcan_protocol_file_GetDirectoryEntryInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoResponse* msg, bool tao) {
 
     (void)buffer;
@@ -100,9 +100,9 @@ void _uavcan_protocol_file_GetDirectoryEntryInfoResponse_encode(uint8_t* buffer,
 /*
  decode uavcan_protocol_file_GetDirectoryEntryInfoResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_file_GetDirectoryEntryInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoResponse* msg, bool tao) {
+bool _uavcan_protocol_file_GetDirectoryEntryInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_GetDirectoryEntryInfoResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -110,21 +110,21 @@ bool _uavcan_protocol_file_GetDirectoryEntryInfoResponse_decode(const CanardRxTr
 
 
 
-    if (_uavcan_protocol_file_Error_decode(transfer, bit_ofs, &msg->error, false)) {return true;}
+    if (_uavcan_protocol_file_Error_decode(reader, bit_ofs, &msg->error, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_protocol_file_EntryType_decode(transfer, bit_ofs, &msg->entry_type, false)) {return true;}
+    if (_uavcan_protocol_file_EntryType_decode(reader, bit_ofs, &msg->entry_type, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_protocol_file_Path_decode(transfer, bit_ofs, &msg->entry_full_path, tao)) {return true;}
+    if (_uavcan_protocol_file_Path_decode(reader, bit_ofs, &msg->entry_full_path, tao)) {return true;}
 
 
 
@@ -63,7 +63,7 @@ bool uavcan_protocol_file_GetInfoResponse_decode(const CanardRxTransfer* transfe
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_GetInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetInfoResponse* msg, bool tao);
-static inline bool _uavcan_protocol_file_GetInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetInfoResponse* msg, bool tao);
+static inline bool _uavcan_protocol_file_GetInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_GetInfoResponse* msg, bool tao);
 void _uavcan_protocol_file_GetInfoResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetInfoResponse* msg, bool tao) {
 
     (void)buffer;
@@ -101,9 +101,9 @@ void _uavcan_protocol_file_GetInfoResponse_encode(uint8_t* buffer, uint32_t* bit
 /*
  decode uavcan_protocol_file_GetInfoResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_file_GetInfoResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_GetInfoResponse* msg, bool tao) {
+bool _uavcan_protocol_file_GetInfoResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_GetInfoResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -112,7 +112,7 @@ bool _uavcan_protocol_file_GetInfoResponse_decode(const CanardRxTransfer* transf
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 40, false, &msg->size);
+    canardReadScalar(reader, *bit_ofs, 40, false, &msg->size);
 
     *bit_ofs += 40;
 
@@ -121,14 +121,14 @@ bool _uavcan_protocol_file_GetInfoResponse_decode(const CanardRxTransfer* transf
 
 
 
-    if (_uavcan_protocol_file_Error_decode(transfer, bit_ofs, &msg->error, false)) {return true;}
+    if (_uavcan_protocol_file_Error_decode(reader, bit_ofs, &msg->error, false)) {return true;}
 
 
 
 
 
 
-    if (_uavcan_protocol_file_EntryType_decode(transfer, bit_ofs, &msg->entry_type, tao)) {return true;}
+    if (_uavcan_protocol_file_EntryType_decode(reader, bit_ofs, &msg->entry_type, tao)) {return true;}
 
 
 
@@ -45,7 +45,7 @@ bool uavcan_protocol_file_Path_decode(const CanardRxTransfer* transfer, struct u
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_Path_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_Path* msg, bool tao);
-static inline bool _uavcan_protocol_file_Path_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_Path* msg, bool tao);
+static inline bool _uavcan_protocol_file_Path_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_Path* msg, bool tao);
 void _uavcan_protocol_file_Path_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_Path* msg, bool tao) {
 
     (void)buffer;
@@ -93,9 +93,9 @@ void _uavcan_protocol_file_Path_encode(uint8_t* buffer, uint32_t* bit_ofs, struc
 /*
  decode uavcan_protocol_file_Path, return true on failure, false on success
 */
-bool _uavcan_protocol_file_Path_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_Path* msg, bool tao) {
+bool _uavcan_protocol_file_Path_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_Path* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -108,14 +108,14 @@ bool _uavcan_protocol_file_Path_decode(const CanardRxTransfer* transfer, uint32_
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->path.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->path.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->path.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->path.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -133,7 +133,7 @@ bool _uavcan_protocol_file_Path_decode(const CanardRxTransfer* transfer, uint32_
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->path.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->path.data[i]);
 
         *bit_ofs += 8;
 
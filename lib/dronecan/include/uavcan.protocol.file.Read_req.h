@@ -57,7 +57,7 @@ bool uavcan_protocol_file_ReadRequest_decode(const CanardRxTransfer* transfer, s
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_ReadRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadRequest* msg, bool tao);
-static inline bool _uavcan_protocol_file_ReadRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadRequest* msg, bool tao);
+static inline bool _uavcan_protocol_file_ReadRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadRequest* msg, bool tao);
 void _uavcan_protocol_file_ReadRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadRequest* msg, bool tao) {
 
     (void)buffer;
@@ -89,9 +89,9 @@ void _uavcan_protocol_file_ReadRequest_encode(uint8_t* buffer, uint32_t* bit_ofs
 /*
  decode uavcan_protocol_file_ReadRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_file_ReadRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadRequest* msg, bool tao) {
+bool _uavcan_protocol_file_ReadRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -100,7 +100,7 @@ bool _uavcan_protocol_file_ReadRequest_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 40, false, &msg->offset);
+    canardReadScalar(reader, *bit_ofs, 40, false, &msg->offset);
 
     *bit_ofs += 40;
 
@@ -109,7 +109,7 @@ bool _uavcan_protocol_file_ReadRequest_decode(const CanardRxTransfer* transfer,
 
 
 
-    if (_uavcan_protocol_file_Path_decode(transfer, bit_ofs, &msg->path, tao)) {return true;}
+    if (_uavcan_protocol_file_Path_decode(reader, bit_ofs, &msg->path, tao)) {return true;}
 
 
 
@@ -57,7 +57,7 @@ bool uavcan_protocol_file_ReadResponse_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_ReadResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadResponse* msg, bool tao);
-static inline bool _uavcan_protocol_file_ReadResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadResponse* msg, bool tao);
+static inline bool _uavcan_protocol_file_ReadResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadResponse* msg, bool tao);
 void _uavcan_protocol_file_ReadResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadResponse* msg, bool tao) {
 
     (void)buffer;
@@ -111,9 +111,9 @@ void _uavcan_protocol_file_ReadResponse_encode(uint8_t* buffer, uint32_t* bit_of
 /*
  decode uavcan_protocol_file_ReadResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_file_ReadResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadResponse* msg, bool tao) {
+bool _uavcan_protocol_file_ReadResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_ReadResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -121,7 +121,7 @@ bool _uavcan_protocol_file_ReadResponse_decode(const CanardRxTransfer* transfer,
 
 
 
-    if (_uavcan_protocol_file_Error_decode(transfer, bit_ofs, &msg->error, false)) {return true;}
+    if (_uavcan_protocol_file_Error_decode(reader, bit_ofs, &msg->error, false)) {return true;}
 
 
 
@@ -133,14 +133,14 @@ bool _uavcan_protocol_file_ReadResponse_decode(const CanardRxTransfer* transfer,
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 9, false, &msg->data.len);
+        canardReadScalar(reader, *bit_ofs, 9, false, &msg->data.len);
         *bit_ofs += 9;
 
 
 
     } else {
 
-        msg->data.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->data.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -158,7 +158,7 @@ bool _uavcan_protocol_file_ReadResponse_decode(const CanardRxTransfer* transfer,
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.data[i]);
 
         *bit_ofs += 8;
 
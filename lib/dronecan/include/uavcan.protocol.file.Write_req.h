@@ -61,7 +61,7 @@ bool uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_WriteRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteRequest* msg, bool tao);
-static inline bool _uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteRequest* msg, bool tao);
+static inline bool _uavcan_protocol_file_WriteRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteRequest* msg, bool tao);
 void _uavcan_protocol_file_WriteRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteRequest* msg, bool tao) {
 
     (void)buffer;
@@ -124,9 +124,9 @@ void _uavcan_protocol_file_WriteRequest_encode(uint8_t* buffer, uint32_t* bit_of
 /*
  decode uavcan_protocol_file_WriteRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteRequest* msg, bool tao) {
+bool _uavcan_protocol_file_WriteRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -135,7 +135,7 @@ bool _uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer,
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 40, false, &msg->offset);
+    canardReadScalar(reader, *bit_ofs, 40, false, &msg->offset);
 
     *bit_ofs += 40;
 
@@ -144,7 +144,7 @@ bool _uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer,
 
 
 
-    if (_uavcan_protocol_file_Path_decode(transfer, bit_ofs, &msg->path, false)) {return true;}
+    if (_uavcan_protocol_file_Path_decode(reader, bit_ofs, &msg->path, false)) {return true;}
 
 
 
@@ -156,14 +156,14 @@ bool _uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer,
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.len);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.len);
         *bit_ofs += 8;
 
 
 
     } else {
 
-        msg->data.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->data.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -181,7 +181,7 @@ bool _uavcan_protocol_file_WriteRequest_decode(const CanardRxTransfer* transfer,
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->data.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->data.data[i]);
 
         *bit_ofs += 8;
 
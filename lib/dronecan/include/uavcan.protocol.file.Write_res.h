@@ -53,7 +53,7 @@ bool uavcan_protocol_file_WriteResponse_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_file_WriteResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteResponse* msg, bool tao);
-static inline bool _uavcan_protocol_file_WriteResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteResponse* msg, bool tao);
+static inline bool _uavcan_protocol_file_WriteResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteResponse* msg, bool tao);
 void _uavcan_protocol_file_WriteResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteResponse* msg, bool tao) {
 
     (void)buffer;
@@ -76,9 +76,9 @@ void _uavcan_protocol_file_WriteResponse_encode(uint8_t* buffer, uint32_t* bit_o
 /*
  decode uavcan_protocol_file_WriteResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_file_WriteResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteResponse* msg, bool tao) {
+bool _uavcan_protocol_file_WriteResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_file_WriteResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -86,7 +86,7 @@ bool _uavcan_protocol_file_WriteResponse_decode(const CanardRxTransfer* transfer
 
 
 
-    if (_uavcan_protocol_file_Error_decode(transfer, bit_ofs, &msg->error, tao)) {return true;}
+    if (_uavcan_protocol_file_Error_decode(reader, bit_ofs, &msg->error, tao)) {return true;}
 
 
 
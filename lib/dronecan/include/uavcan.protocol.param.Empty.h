@@ -37,7 +37,7 @@ bool uavcan_protocol_param_Empty_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_Empty_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_Empty* msg, bool tao);
-static inline bool _uavcan_protocol_param_Empty_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_Empty* msg, bool tao);
+static inline bool _uavcan_protocol_param_Empty_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_Empty* msg, bool tao);
 void _uavcan_protocol_param_Empty_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_Empty* msg, bool tao) {
 
     (void)buffer;
@@ -54,9 +54,9 @@ void _uavcan_protocol_param_Empty_encode(uint8_t* buffer, uint32_t* bit_ofs, str
 /*
  decode uavcan_protocol_param_Empty, return true on failure, false on success
 */
-bool _uavcan_protocol_param_Empty_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_Empty* msg, bool tao) {
+bool _uavcan_protocol_param_Empty_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_Empty* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -61,7 +61,7 @@ bool uavcan_protocol_param_ExecuteOpcodeRequest_decode(const CanardRxTransfer* t
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_ExecuteOpcodeRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeRequest* msg, bool tao);
-static inline bool _uavcan_protocol_param_ExecuteOpcodeRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeRequest* msg, bool tao);
+static inline bool _uavcan_protocol_param_ExecuteOpcodeRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeRequest* msg, bool tao);
 void _uavcan_protocol_param_ExecuteOpcodeRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeRequest* msg, bool tao) {
 
     (void)buffer;
@@ -96,9 +96,9 @@ void _uavcan_protocol_param_ExecuteOpcodeRequest_encode(uint8_t* buffer, uint32_
 /*
  decode uavcan_protocol_param_ExecuteOpcodeRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_param_ExecuteOpcodeRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeRequest* msg, bool tao) {
+bool _uavcan_protocol_param_ExecuteOpcodeRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -107,7 +107,7 @@ bool _uavcan_protocol_param_ExecuteOpcodeRequest_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->opcode);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->opcode);
 
     *bit_ofs += 8;
 
@@ -117,7 +117,7 @@ bool _uavcan_protocol_param_ExecuteOpcodeRequest_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, true, &msg->argument);
+    canardReadScalar(reader, *bit_ofs, 48, true, &msg->argument);
 
     *bit_ofs += 48;
 
@@ -55,7 +55,7 @@ bool uavcan_protocol_param_ExecuteOpcodeResponse_decode(const CanardRxTransfer*
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_ExecuteOpcodeResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeResponse* msg, bool tao);
-static inline bool _uavcan_protocol_param_ExecuteOpcodeResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeResponse* msg, bool tao);
+static inline bool _uavcan_protocol_param_ExecuteOpcodeResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeResponse* msg, bool tao);
 void _uavcan_protocol_param_ExecuteOpcodeResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeResponse* msg, bool tao) {
 
     (void)buffer;
@@ -90,9 +90,9 @@ void _uavcan_protocol_param_ExecuteOpcodeResponse_encode(uint8_t* buffer, uint32
 /*
  decode uavcan_protocol_param_ExecuteOpcodeResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_param_ExecuteOpcodeResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeResponse* msg, bool tao) {
+bool _uavcan_protocol_param_ExecuteOpcodeResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_ExecuteOpcodeResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -101,7 +101,7 @@ bool _uavcan_protocol_param_ExecuteOpcodeResponse_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 48, true, &msg->argument);
+    canardReadScalar(reader, *bit_ofs, 48, true, &msg->argument);
 
     *bit_ofs += 48;
 
@@ -111,7 +111,7 @@ bool _uavcan_protocol_param_ExecuteOpcodeResponse_decode(const CanardRxTransfer*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 1, false, &msg->ok);
+    canardReadScalar(reader, *bit_ofs, 1, false, &msg->ok);
 
     *bit_ofs += 1;
 
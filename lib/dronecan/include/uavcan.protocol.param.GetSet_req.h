@@ -61,7 +61,7 @@ bool uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfer
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_GetSetRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetRequest* msg, bool tao);
-static inline bool _uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetRequest* msg, bool tao);
+static inline bool _uavcan_protocol_param_GetSetRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetRequest* msg, bool tao);
 void _uavcan_protocol_param_GetSetRequest_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetRequest* msg, bool tao) {
 
     (void)buffer;
@@ -124,9 +124,9 @@ void _uavcan_protocol_param_GetSetRequest_encode(uint8_t* buffer, uint32_t* bit_
 /*
  decode uavcan_protocol_param_GetSetRequest, return true on failure, false on success
 */
-bool _uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetRequest* msg, bool tao) {
+bool _uavcan_protocol_param_GetSetRequest_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetRequest* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -135,7 +135,7 @@ bool _uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfe
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 13, false, &msg->index);
+    canardReadScalar(reader, *bit_ofs, 13, false, &msg->index);
 
     *bit_ofs += 13;
 
@@ -144,7 +144,7 @@ bool _uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfe
 
 
 
-    if (_uavcan_protocol_param_Value_decode(transfer, bit_ofs, &msg->value, false)) {return true;}
+    if (_uavcan_protocol_param_Value_decode(reader, bit_ofs, &msg->value, false)) {return true;}
 
 
 
@@ -156,14 +156,14 @@ bool _uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfe
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -181,7 +181,7 @@ bool _uavcan_protocol_param_GetSetRequest_decode(const CanardRxTransfer* transfe
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->name.data[i]);
 
         *bit_ofs += 8;
 
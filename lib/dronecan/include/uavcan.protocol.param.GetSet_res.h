@@ -79,7 +79,7 @@ bool uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transfe
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_GetSetResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetResponse* msg, bool tao);
-static inline bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetResponse* msg, bool tao);
+static inline bool _uavcan_protocol_param_GetSetResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetResponse* msg, bool tao);
 void _uavcan_protocol_param_GetSetResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetResponse* msg, bool tao) {
 
     (void)buffer;
@@ -175,9 +175,9 @@ void _uavcan_protocol_param_GetSetResponse_encode(uint8_t* buffer, uint32_t* bit
 /*
  decode uavcan_protocol_param_GetSetResponse, return true on failure, false on success
 */
-bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetResponse* msg, bool tao) {
+bool _uavcan_protocol_param_GetSetResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_GetSetResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -192,7 +192,7 @@ bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transf
 
 
 
-    if (_uavcan_protocol_param_Value_decode(transfer, bit_ofs, &msg->value, false)) {return true;}
+    if (_uavcan_protocol_param_Value_decode(reader, bit_ofs, &msg->value, false)) {return true;}
 
 
 
@@ -206,7 +206,7 @@ bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transf
 
 
 
-    if (_uavcan_protocol_param_Value_decode(transfer, bit_ofs, &msg->default_value, false)) {return true;}
+    if (_uavcan_protocol_param_Value_decode(reader, bit_ofs, &msg->default_value, false)) {return true;}
 
 
 
@@ -220,7 +220,7 @@ bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transf
 
 
 
-    if (_uavcan_protocol_param_NumericValue_decode(transfer, bit_ofs, &msg->max_value, false)) {return true;}
+    if (_uavcan_protocol_param_NumericValue_decode(reader, bit_ofs, &msg->max_value, false)) {return true;}
 
 
 
@@ -234,7 +234,7 @@ bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transf
 
 
 
-    if (_uavcan_protocol_param_NumericValue_decode(transfer, bit_ofs, &msg->min_value, false)) {return true;}
+    if (_uavcan_protocol_param_NumericValue_decode(reader, bit_ofs, &msg->min_value, false)) {return true;}
 
 
 
@@ -246,14 +246,14 @@ bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transf
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->name.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->name.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->name.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->name.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -271,7 +271,7 @@ bool _uavcan_protocol_param_GetSetResponse_decode(const CanardRxTransfer* transf
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->name.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->name.data[i]);
 
         *bit_ofs += 8;
 
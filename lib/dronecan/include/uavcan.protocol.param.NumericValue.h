@@ -64,7 +64,7 @@ bool uavcan_protocol_param_NumericValue_decode(const CanardRxTransfer* transfer,
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_NumericValue_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_NumericValue* msg, bool tao);
-static inline bool _uavcan_protocol_param_NumericValue_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_NumericValue* msg, bool tao);
+static inline bool _uavcan_protocol_param_NumericValue_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_NumericValue* msg, bool tao);
 void _uavcan_protocol_param_NumericValue_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_NumericValue* msg, bool tao) {
 
     (void)buffer;
@@ -136,15 +136,15 @@ void _uavcan_protocol_param_NumericValue_encode(uint8_t* buffer, uint32_t* bit_o
 /*
  decode uavcan_protocol_param_NumericValue, return true on failure, false on success
 */
-bool _uavcan_protocol_param_NumericValue_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_NumericValue* msg, bool tao) {
+bool _uavcan_protocol_param_NumericValue_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_NumericValue* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
 
     uint8_t union_tag;
-    canardDecodeScalar(transfer, *bit_ofs, 2, false, &union_tag);
+    canardReadScalar(reader, *bit_ofs, 2, false, &union_tag);
     *bit_ofs += 2;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wtype-limits"
@@ -163,7 +163,7 @@ bool _uavcan_protocol_param_NumericValue_decode(const CanardRxTransfer* transfer
 
 
 
-            if (_uavcan_protocol_param_Empty_decode(transfer, bit_ofs, &msg->empty, tao)) {return true;}
+            if (_uavcan_protocol_param_Empty_decode(reader, bit_ofs, &msg->empty, tao)) {return true;}
 
 
             break;
@@ -178,7 +178,7 @@ bool _uavcan_protocol_param_NumericValue_decode(const CanardRxTransfer* transfer
 
 
 
-            canardDecodeScalar(transfer, *bit_ofs, 64, true, &msg->integer_value);
+            canardReadScalar(reader, *bit_ofs, 64, true, &msg->integer_value);
 
             *bit_ofs += 64;
 
@@ -195,7 +195,7 @@ bool _uavcan_protocol_param_NumericValue_decode(const CanardRxTransfer* transfer
 
 
 
-            canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->real_value);
+            canardReadScalar(reader, *bit_ofs, 32, true, &msg->real_value);
 
             *bit_ofs += 32;
 
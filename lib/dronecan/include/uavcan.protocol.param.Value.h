@@ -76,7 +76,7 @@ bool uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_protocol_param_Value_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_Value* msg, bool tao);
-static inline bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_Value* msg, bool tao);
+static inline bool _uavcan_protocol_param_Value_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_Value* msg, bool tao);
 void _uavcan_protocol_param_Value_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_protocol_param_Value* msg, bool tao) {
 
     (void)buffer;
@@ -202,15 +202,15 @@ void _uavcan_protocol_param_Value_encode(uint8_t* buffer, uint32_t* bit_ofs, str
 /*
  decode uavcan_protocol_param_Value, return true on failure, false on success
 */
-bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_protocol_param_Value* msg, bool tao) {
+bool _uavcan_protocol_param_Value_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_protocol_param_Value* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
 
     uint8_t union_tag;
-    canardDecodeScalar(transfer, *bit_ofs, 3, false, &union_tag);
+    canardReadScalar(reader, *bit_ofs, 3, false, &union_tag);
     *bit_ofs += 3;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wtype-limits"
@@ -229,7 +229,7 @@ bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-            if (_uavcan_protocol_param_Empty_decode(transfer, bit_ofs, &msg->empty, tao)) {return true;}
+            if (_uavcan_protocol_param_Empty_decode(reader, bit_ofs, &msg->empty, tao)) {return true;}
 
 
             break;
@@ -244,7 +244,7 @@ bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-            canardDecodeScalar(transfer, *bit_ofs, 64, true, &msg->integer_value);
+            canardReadScalar(reader, *bit_ofs, 64, true, &msg->integer_value);
 
             *bit_ofs += 64;
 
@@ -261,7 +261,7 @@ bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-            canardDecodeScalar(transfer, *bit_ofs, 32, true, &msg->real_value);
+            canardReadScalar(reader, *bit_ofs, 32, true, &msg->real_value);
 
             *bit_ofs += 32;
 
@@ -278,7 +278,7 @@ bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-            canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->boolean_value);
+            canardReadScalar(reader, *bit_ofs, 8, false, &msg->boolean_value);
 
             *bit_ofs += 8;
 
@@ -299,14 +299,14 @@ bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint3
             if (!tao) {
 
 
-                canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->string_value.len);
+                canardReadScalar(reader, *bit_ofs, 8, false, &msg->string_value.len);
                 *bit_ofs += 8;
 
 
 
             } else {
 
-                msg->string_value.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+                msg->string_value.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
             }
@@ -324,7 +324,7 @@ bool _uavcan_protocol_param_Value_decode(const CanardRxTransfer* transfer, uint3
 
 
 
-                canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->string_value.data[i]);
+                canardReadScalar(reader, *bit_ofs, 8, false, &msg->string_value.data[i]);
 
                 *bit_ofs += 8;
 
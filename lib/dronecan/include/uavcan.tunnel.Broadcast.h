@@ -61,7 +61,7 @@ bool uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, struct uav
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_tunnel_Broadcast_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_Broadcast* msg, bool tao);
-static inline bool _uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_Broadcast* msg, bool tao);
+static inline bool _uavcan_tunnel_Broadcast_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_Broadcast* msg, bool tao);
 void _uavcan_tunnel_Broadcast_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_Broadcast* msg, bool tao) {
 
     (void)buffer;
@@ -124,9 +124,9 @@ void _uavcan_tunnel_Broadcast_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode uavcan_tunnel_Broadcast, return true on failure, false on success
 */
-bool _uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_Broadcast* msg, bool tao) {
+bool _uavcan_tunnel_Broadcast_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_Broadcast* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -134,7 +134,7 @@ bool _uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    if (_uavcan_tunnel_Protocol_decode(transfer, bit_ofs, &msg->protocol, false)) {return true;}
+    if (_uavcan_tunnel_Protocol_decode(reader, bit_ofs, &msg->protocol, false)) {return true;}
 
 
 
@@ -142,7 +142,7 @@ bool _uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->channel_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->channel_id);
 
     *bit_ofs += 8;
 
@@ -156,14 +156,14 @@ bool _uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, uint32_t*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->buffer.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->buffer.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->buffer.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->buffer.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -181,7 +181,7 @@ bool _uavcan_tunnel_Broadcast_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->buffer.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->buffer.data[i]);
 
         *bit_ofs += 8;
 
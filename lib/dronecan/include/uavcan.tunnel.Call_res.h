@@ -51,7 +51,7 @@ bool uavcan_tunnel_CallResponse_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_tunnel_CallResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_CallResponse* msg, bool tao);
-static inline bool _uavcan_tunnel_CallResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_CallResponse* msg, bool tao);
+static inline bool _uavcan_tunnel_CallResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_CallResponse* msg, bool tao);
 void _uavcan_tunnel_CallResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_CallResponse* msg, bool tao) {
 
     (void)buffer;
@@ -99,9 +99,9 @@ void _uavcan_tunnel_CallResponse_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode uavcan_tunnel_CallResponse, return true on failure, false on success
 */
-bool _uavcan_tunnel_CallResponse_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_CallResponse* msg, bool tao) {
+bool _uavcan_tunnel_CallResponse_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_CallResponse* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -114,14 +114,14 @@ bool _uavcan_tunnel_CallResponse_decode(const CanardRxTransfer* transfer, uint32
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 6, false, &msg->buffer.len);
+        canardReadScalar(reader, *bit_ofs, 6, false, &msg->buffer.len);
         *bit_ofs += 6;
 
 
 
     } else {
 
-        msg->buffer.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->buffer.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -139,7 +139,7 @@ bool _uavcan_tunnel_CallResponse_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->buffer.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->buffer.data[i]);
 
         *bit_ofs += 8;
 
@@ -51,7 +51,7 @@ bool uavcan_tunnel_Protocol_decode(const CanardRxTransfer* transfer, struct uavc
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_tunnel_Protocol_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_Protocol* msg, bool tao);
-static inline bool _uavcan_tunnel_Protocol_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_Protocol* msg, bool tao);
+static inline bool _uavcan_tunnel_Protocol_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_Protocol* msg, bool tao);
 void _uavcan_tunnel_Protocol_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_Protocol* msg, bool tao) {
 
     (void)buffer;
@@ -77,9 +77,9 @@ void _uavcan_tunnel_Protocol_encode(uint8_t* buffer, uint32_t* bit_ofs, struct u
 /*
  decode uavcan_tunnel_Protocol, return true on failure, false on success
 */
-bool _uavcan_tunnel_Protocol_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_Protocol* msg, bool tao) {
+bool _uavcan_tunnel_Protocol_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_Protocol* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -88,7 +88,7 @@ bool _uavcan_tunnel_Protocol_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->protocol);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->protocol);
 
     *bit_ofs += 8;
 
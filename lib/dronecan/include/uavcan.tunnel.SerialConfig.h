@@ -59,7 +59,7 @@ bool uavcan_tunnel_SerialConfig_decode(const CanardRxTransfer* transfer, struct
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_tunnel_SerialConfig_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_SerialConfig* msg, bool tao);
-static inline bool _uavcan_tunnel_SerialConfig_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_SerialConfig* msg, bool tao);
+static inline bool _uavcan_tunnel_SerialConfig_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_SerialConfig* msg, bool tao);
 void _uavcan_tunnel_SerialConfig_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_SerialConfig* msg, bool tao) {
 
     (void)buffer;
@@ -103,9 +103,9 @@ void _uavcan_tunnel_SerialConfig_encode(uint8_t* buffer, uint32_t* bit_ofs, stru
 /*
  decode uavcan_tunnel_SerialConfig, return true on failure, false on success
 */
-bool _uavcan_tunnel_SerialConfig_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_SerialConfig* msg, bool tao) {
+bool _uavcan_tunnel_SerialConfig_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_SerialConfig* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -114,7 +114,7 @@ bool _uavcan_tunnel_SerialConfig_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->channel_id);
+    canardReadScalar(reader, *bit_ofs, 8, false, &msg->channel_id);
 
     *bit_ofs += 8;
 
@@ -124,7 +124,7 @@ bool _uavcan_tunnel_SerialConfig_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 32, false, &msg->baud);
+    canardReadScalar(reader, *bit_ofs, 32, false, &msg->baud);
 
     *bit_ofs += 32;
 
@@ -134,7 +134,7 @@ bool _uavcan_tunnel_SerialConfig_decode(const CanardRxTransfer* transfer, uint32
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 24, false, &msg->options);
+    canardReadScalar(reader, *bit_ofs, 24, false, &msg->options);
 
     *bit_ofs += 24;
 
@@ -77,7 +77,7 @@ bool uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, struct uav
 #if defined(CANARD_DSDLC_INTERNAL)
 
 static inline void _uavcan_tunnel_Targetted_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_Targetted* msg, bool tao);
-static inline bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_Targetted* msg, bool tao);
+static inline bool _uavcan_tunnel_Targetted_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_Targetted* msg, bool tao);
 void _uavcan_tunnel_Targetted_encode(uint8_t* buffer, uint32_t* bit_ofs, struct uavcan_tunnel_Targetted* msg, bool tao) {
 
     (void)buffer;
@@ -167,9 +167,9 @@ void _uavcan_tunnel_Targetted_encode(uint8_t* buffer, uint32_t* bit_ofs, struct
 /*
  decode uavcan_tunnel_Targetted, return true on failure, false on success
 */
-bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t* bit_ofs, struct uavcan_tunnel_Targetted* msg, bool tao) {
+bool _uavcan_tunnel_Targetted_decode(CanardRxReader* reader, uint32_t* bit_ofs, struct uavcan_tunnel_Targetted* msg, bool tao) {
 
-    (void)transfer;
+    (void)reader;
     (void)bit_ofs;
     (void)msg;
     (void)tao;
@@ -177,7 +177,7 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    if (_uavcan_tunnel_Protocol_decode(transfer, bit_ofs, &msg->protocol, false)) {return true;}
+    if (_uavcan_tunnel_Protocol_decode(reader, bit_ofs, &msg->protocol, false)) {return true;}
 
 
 
@@ -185,7 +185,7 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->target_node);
+    canardReadScalar(reader, *bit_ofs, 7, false, &msg->target_node);
 
     *bit_ofs += 7;
 
@@ -195,7 +195,7 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 5, true, &msg->serial_id);
+    canardReadScalar(reader, *bit_ofs, 5, true, &msg->serial_id);
 
     *bit_ofs += 5;
 
@@ -205,7 +205,7 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 4, false, &msg->options);
+    canardReadScalar(reader, *bit_ofs, 4, false, &msg->options);
 
     *bit_ofs += 4;
 
@@ -215,7 +215,7 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-    canardDecodeScalar(transfer, *bit_ofs, 24, false, &msg->baudrate);
+    canardReadScalar(reader, *bit_ofs, 24, false, &msg->baudrate);
 
     *bit_ofs += 24;
 
@@ -229,14 +229,14 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
     if (!tao) {
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 7, false, &msg->buffer.len);
+        canardReadScalar(reader, *bit_ofs, 7, false, &msg->buffer.len);
         *bit_ofs += 7;
 
 
 
     } else {
 
-        msg->buffer.len = ((transfer->payload_len*8)-*bit_ofs)/8;
+        msg->buffer.len = ((reader->transfer->payload_len*8)-*bit_ofs)/8;
 
 
     }
@@ -254,7 +254,7 @@ bool _uavcan_tunnel_Targetted_decode(const CanardRxTransfer* transfer, uint32_t*
 
 
 
-        canardDecodeScalar(transfer, *bit_ofs, 8, false, &msg->buffer.data[i]);
+        canardReadScalar(reader, *bit_ofs, 8, false, &msg->buffer.data[i]);
 
         *bit_ofs += 8;
 
@@ -35,8 +35,10 @@ bool dronecan_remoteid_System_decode(const CanardRxTransfer* transfer, struct dr
         return true; /* invalid payload length */
     }
 #endif
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
     uint32_t bit_ofs = 0;
-    if (_dronecan_remoteid_System_decode(transfer, &bit_ofs, msg,
+    if (_dronecan_remoteid_System_decode(&reader, &bit_ofs, msg,
 #if CANARD_ENABLE_TAO_OPTION
     transfer->tao
 #else
@@ -35,8 +35,10 @@ bool uavcan_equipment_air_data_AngleOfAttack_decode(const CanardRxTransfer* tran
         return true; /* invalid payload length */
     }
 #endif
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
     uint32_t bit_ofs = 0;
-    if (_uavcan_equipment_air_data_AngleOfAttack_decode(transfer, &bit_ofs, msg,
+    if (_uavcan_equipment_air_data_AngleOfAttack_decode(&reader, &bit_ofs, msg,
 #if CANARD_ENABLE_TAO_OPTION
     transfer->tao
 #else
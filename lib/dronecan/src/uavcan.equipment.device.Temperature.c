@@ -35,8 +35,10 @@ bool uavcan_equipment_device_Temperature_decode(const CanardRxTransfer* transfer
         return true; /* invalid payload length */
     }
 #endif
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
     uint32_t bit_ofs = 0;
-    if (_uavcan_equipment_device_Temperature_decode(transfer, &bit_ofs, msg,
+    if (_uavcan_equipment_device_Temperature_decode(&reader, &bit_ofs, msg,
 #if CANARD_ENABLE_TAO_OPTION
     transfer->tao
 #else
@@ -35,8 +35,10 @@ bool uavcan_navigation_GlobalNavigationSolution_decode(const CanardRxTransfer* t
         return true; /* invalid payload length */
     }
 #endif
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
     uint32_t bit_ofs = 0;
-    if (_uavcan_navigation_GlobalNavigationSolution_decode(transfer, &bit_ofs, msg,
+    if (_uavcan_navigation_GlobalNavigationSolution_decode(&reader, &bit_ofs, msg,
 #if CANARD_ENABLE_TAO_OPTION
     transfer->tao
 #else
@@ -37,8 +37,10 @@ bool uavcan_protocol_file_GetInfoRequest_decode(const CanardRxTransfer* transfer
         return true; /* invalid payload length */
     }
 #endif
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
     uint32_t bit_ofs = 0;
-    if (_uavcan_protocol_file_GetInfoRequest_decode(transfer, &bit_ofs, msg,
+    if (_uavcan_protocol_file_GetInfoRequest_decode(&reader, &bit_ofs, msg,
 #if CANARD_ENABLE_TAO_OPTION
     transfer->tao
 #else
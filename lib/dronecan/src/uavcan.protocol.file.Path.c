@@ -35,8 +35,10 @@ bool uavcan_protocol_file_Path_decode(const CanardRxTransfer* transfer, struct u
         return true; /* invalid payload length */
     }
 #endif
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
     uint32_t bit_ofs = 0;
-    if (_uavcan_protocol_file_Path_decode(transfer, &bit_ofs, msg,
+    if (_uavcan_protocol_file_Path_decode(&reader, &bit_ofs, msg,
 #if CANARD_ENABLE_TAO_OPTION
     transfer->tao
 #else
@@ -36,6 +36,7 @@
 
 #define TRANSFER_TIMEOUT_USEC                       2000000U
 #define IFACE_SWITCH_DELAY_USEC                     1000000U
+#define IFACE_QUIET_TIMEOUT_USEC                    10000U
 
 #define TRANSFER_ID_BIT_LEN                         5U
 #define ANON_MSG_DATA_TYPE_ID_BIT_LEN               2U
@@ -51,6 +52,9 @@
 #define MAKE_TRANSFER_DESCRIPTOR(data_type_id, transfer_type, src_node_id, dst_node_id)             \
     (((uint32_t)(data_type_id)) | (((uint32_t)(transfer_type)) << 16U) |                            \
     (((uint32_t)(src_node_id)) << 18U) | (((uint32_t)(dst_node_id)) << 25U))
+#define SOURCE_ID_FROM_TRANSFER_DESCRIPTOR(x)       ((uint8_t) (((x) >> 18U) & 0x7FU))
+
+#define SUBSCRIPTION_KEY(data_type_id, transfer_type)  ((((uint32_t)(transfer_type)) << 16U) | (uint32_t)(data_type_id))
 
 #define TRANSFER_ID_FROM_TAIL_BYTE(x)               ((uint8_t)((x) & 0x1FU))
 
@@ -86,9 +90,33 @@ void canardInit(CanardInstance* out_ins,
     out_ins->node_id = CANARD_BROADCAST_NODE_ID;
     out_ins->on_reception = on_reception;
     out_ins->should_accept = should_accept;
-    out_ins->rx_states = NULL;
-    out_ins->tx_queue = NULL;
+    out_ins->subscriptions = NULL;
+    out_ins->subscription_count = 0;
+    out_ins->rx_payload_arena = NULL;
+    memset(&out_ins->pool_policy, 0, sizeof(out_ins->pool_policy));
+    out_ins->rx_payload_arena_size = 0;
+    for (uint16_t i = 0; i < CANARD_RX_STATE_HASH_BUCKETS; i++)
+    {
+        out_ins->rx_states[i] = NULL;
+    }
+    out_ins->rx_expiry_head = NULL;
+    out_ins->rx_expiry_tail = NULL;
+    memset(out_ins->tx_queues, 0, sizeof(out_ins->tx_queues));
+#if CANARD_ENABLE_DEADLINE
+    out_ins->tx_deadline_usec = UINT64_MAX;
+#endif
     out_ins->user_reference = user_reference;
+    memset(&out_ins->statistics, 0, sizeof(out_ins->statistics));
+#if CANARD_BUS_LOAD_BUCKETS > 0
+    memset(&out_ins->bus_load, 0, sizeof(out_ins->bus_load));
+    out_ins->bus_load.bit_rate = CANARD_DEFAULT_BUS_BIT_RATE;
+#endif
+#if CANARD_TX_TRANSFER_ID_SLOTS > 0
+    memset(out_ins->tx_transfer_id_keys, 0, sizeof(out_ins->tx_transfer_id_keys));
+    memset(out_ins->tx_transfer_ids, 0, sizeof(out_ins->tx_transfer_ids));
+    memset(out_ins->tx_transfer_id_used, 0, sizeof(out_ins->tx_transfer_id_used));
+    out_ins->tx_transfer_id_clock = 0;
+#endif
 #if CANARD_ENABLE_TAO_OPTION
     out_ins->tao_disabled = false;
 #endif
@@ -99,6 +127,98 @@ void canardInit(CanardInstance* out_ins,
     }
 
     initPoolAllocator(&out_ins->allocator, mem_arena, (uint16_t)pool_capacity);
+#if CANARD_MULTI_IFACE
+    out_ins->tx_queue_quota = (uint16_t)(pool_capacity / CANARD_NUM_IFACES);
+#endif
+}
+
+int16_t canardSetSubscriptions(CanardInstance* ins, CanardSubscription* subscriptions, uint16_t subscription_count)
+{
+    CANARD_ASSERT(ins != NULL);
+
+    if (subscriptions == NULL && subscription_count > 0)
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Validate before sorting, so that a rejected table is left as the caller wrote it
+    for (uint16_t i = 0; i < subscription_count; i++)
+    {
+        if (subscriptions[i].handler == NULL)
+        {
+            return -CANARD_ERROR_INVALID_ARGUMENT;
+        }
+        const uint32_t key = SUBSCRIPTION_KEY(subscriptions[i].data_type_id, subscriptions[i].transfer_type);
+        for (uint16_t j = 0; j < i; j++)
+        {
+            if (SUBSCRIPTION_KEY(subscriptions[j].data_type_id, subscriptions[j].transfer_type) == key)
+            {
+                return -CANARD_ERROR_INVALID_ARGUMENT;
+            }
+        }
+    }
+
+    // Insertion sort, the tables are small and usually written in order already
+    for (uint16_t i = 1; i < subscription_count; i++)
+    {
+        const CanardSubscription entry = subscriptions[i];
+        const uint32_t key = SUBSCRIPTION_KEY(entry.data_type_id, entry.transfer_type);
+        uint16_t j = i;
+        while (j > 0 && SUBSCRIPTION_KEY(subscriptions[j - 1].data_type_id, subscriptions[j - 1].transfer_type) > key)
+        {
+            subscriptions[j] = subscriptions[j - 1];
+            j--;
+        }
+        subscriptions[j] = entry;
+    }
+
+    ins->subscriptions = subscriptions;
+    ins->subscription_count = subscription_count;
+    return CANARD_OK;
+}
+
+void canardSetPoolPolicy(CanardInstance* ins, const CanardPoolPolicy* policy)
+{
+    CANARD_ASSERT(ins != NULL);
+    CANARD_ASSERT(policy != NULL);
+
+    ins->pool_policy = *policy;
+}
+
+int16_t canardSetPoolQuota(CanardInstance* ins, CanardPoolConsumer consumer, uint16_t max_blocks)
+{
+    CANARD_ASSERT(ins != NULL);
+
+    if ((uint32_t)consumer >= CANARD_NUM_POOL_CONSUMERS)
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+    ins->allocator.quota_blocks[consumer] = max_blocks;
+    return CANARD_OK;
+}
+
+#if CANARD_ENABLE_NODE_QUOTA
+void canardSetNodeBlockQuota(CanardInstance* ins, uint16_t max_blocks)
+{
+    CANARD_ASSERT(ins != NULL);
+
+    ins->node_block_quota = max_blocks;
+}
+
+uint16_t canardGetNodeThrottleCount(const CanardInstance* ins, uint8_t node_id)
+{
+    CANARD_ASSERT(ins != NULL);
+
+    return (node_id <= CANARD_MAX_NODE_ID) ? ins->node_throttled[node_id] : 0U;
+}
+#endif
+
+void canardSetRxPayloadArena(CanardInstance* ins, void* arena, uint16_t arena_size)
+{
+    CANARD_ASSERT(ins != NULL);
+
+    ins->rx_payload_arena = (uint8_t*)arena;
+    ins->rx_payload_arena_size = (arena != NULL) ? arena_size : 0U;
 }
 
 void* canardGetUserReference(const CanardInstance* ins)
@@ -138,6 +258,18 @@ void canardInitTxTransfer(CanardTxTransfer* transfer)
     memset(transfer, 0, sizeof(*transfer));
 }
 
+#if CANARD_ENABLE_TAO_OPTION
+bool canardTxTransferTao(const CanardInstance* ins, const CanardTxTransfer* transfer)
+{
+#if CANARD_ENABLE_CANFD
+    return !(transfer->canfd || ins->tao_disabled);
+#else
+    (void) transfer;
+    return !ins->tao_disabled;
+#endif
+}
+#endif
+
 
 int16_t canardBroadcast(CanardInstance* ins,
                         uint64_t data_type_signature,
@@ -215,10 +347,16 @@ int16_t canardBroadcastObj(CanardInstance* ins, CanardTxTransfer* transfer_objec
     else
     {
         can_id = ((uint32_t) transfer_object->priority << 24U) | ((uint32_t) transfer_object->data_type_id << 8U) | (uint32_t) canardGetLocalNodeID(ins);
-        crc = calculateCRC(transfer_object);
+        crc = calculateCRCSeed(ins, transfer_object);
+    }
+
+    if (transfer_object->coalesce)
+    {
+        coalesceTxQueue(ins, can_id | CANARD_CAN_FRAME_EFF, transfer_object);
     }
 
     const int16_t result = enqueueTxFrames(ins, can_id, crc, transfer_object);
+    updateTxStatistics(ins, result);
 
     if (result > 0) {
         incrementTransferID(transfer_object->inout_transfer_id);
@@ -285,9 +423,8 @@ CANARD_INTERNAL canard_buffer_idx_t canardRxToIdx(CanardPoolAllocator* allocator
 #endif
 }
 
-CANARD_INTERNAL uint16_t calculateCRC(const CanardTxTransfer* transfer_object)
+CANARD_INTERNAL uint16_t calculateCRCSeed(CanardInstance* ins, const CanardTxTransfer* transfer_object)
 {
-    uint16_t crc = 0xFFFFU;
 #if CANARD_ENABLE_CANFD
     if ((transfer_object->payload_len > 7 && !transfer_object->canfd) ||
         (transfer_object->payload_len > 63 && transfer_object->canfd))
@@ -295,20 +432,9 @@ CANARD_INTERNAL uint16_t calculateCRC(const CanardTxTransfer* transfer_object)
     if (transfer_object->payload_len > 7)
 #endif
     {
-        crc = crcAddSignature(crc, transfer_object->data_type_signature);
-        crc = crcAdd(crc, transfer_object->payload, transfer_object->payload_len);
-#if CANARD_ENABLE_CANFD
-        if (transfer_object->payload_len > 63 && transfer_object->canfd) {
-            uint8_t empty = 0;
-            uint8_t padding = (uint8_t)dlcToDataLength(dataLengthToDlc((uint16_t)((transfer_object->payload_len+2) % 63)+1))-1;
-            padding -= (uint8_t)((transfer_object->payload_len+2) % 63);
-            for (uint8_t i=0; i<padding; i++) {
-                crc = crcAddByte(crc, empty);
-            }
-        }
-#endif
+        return crcSignatureSeed(ins, transfer_object->data_type_signature);
     }
-    return crc;
+    return 0xFFFFU;
 }
 
 int16_t canardRequestOrRespond(CanardInstance* ins,
@@ -371,10 +497,11 @@ int16_t canardRequestOrRespondObj(CanardInstance* ins, uint8_t destination_node_
                             ((uint32_t) transfer_object->transfer_type << 15U) | ((uint32_t) destination_node_id << 8U) |
                             (1U << 7U) | (uint32_t) canardGetLocalNodeID(ins);
 
-    uint16_t crc = calculateCRC(transfer_object);
+    uint16_t crc = calculateCRCSeed(ins, transfer_object);
 
 
     const int16_t result = enqueueTxFrames(ins, can_id, crc, transfer_object);
+    updateTxStatistics(ins, result);
 
     if (result > 0 && transfer_object->transfer_type == CanardTransferTypeRequest)                      // Response Transfer ID must not be altered
     {
@@ -384,45 +511,384 @@ int16_t canardRequestOrRespondObj(CanardInstance* ins, uint8_t destination_node_
     return result;
 }
 
+int16_t canardTxStreamBegin(CanardTxStream* out_stream,
+                            CanardInstance* ins,
+                            const CanardTxTransfer* transfer,
+                            uint8_t destination_node_id)
+{
+    CANARD_ASSERT(out_stream != NULL);
+    CANARD_ASSERT(transfer != NULL);
+    memset(out_stream, 0, sizeof(*out_stream));
+    out_stream->ins = ins;
+    out_stream->transfer = *transfer;
+    out_stream->transfer.payload = NULL;
+    out_stream->transfer.payload_len = 0;
+
+    static const uint16_t DTIDMask = (1U << ANON_MSG_DATA_TYPE_ID_BIT_LEN) - 1U;
+    int16_t error = CANARD_OK;
+
+    if ((transfer->inout_transfer_id == NULL) || (transfer->priority > CANARD_TRANSFER_PRIORITY_LOWEST))
+    {
+        error = -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+#if CANARD_MULTI_IFACE
+    else if ((transfer->iface_mask & ((1U << CANARD_NUM_IFACES) - 1U)) == 0)
+    {
+        error = -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+#endif
+    else if (transfer->transfer_type == CanardTransferTypeBroadcast)
+    {
+        if ((canardGetLocalNodeID(ins) == 0) && ((transfer->data_type_id & DTIDMask) != transfer->data_type_id))
+        {
+            error = -CANARD_ERROR_INVALID_ARGUMENT;
+        }
+        // The discriminator of an anonymous transfer is added on commit, once the payload is known
+        out_stream->can_id = ((uint32_t) transfer->priority << 24U) | ((uint32_t) transfer->data_type_id << 8U) |
+                             (uint32_t) canardGetLocalNodeID(ins);
+    }
+    else if (canardGetLocalNodeID(ins) == 0)
+    {
+        error = -CANARD_ERROR_NODE_ID_NOT_SET;
+    }
+    else
+    {
+        out_stream->can_id = ((uint32_t) transfer->priority << 24U) | ((uint32_t) transfer->data_type_id << 16U) |
+                             ((uint32_t) transfer->transfer_type << 15U) | ((uint32_t) destination_node_id << 8U) |
+                             (1U << 7U) | (uint32_t) canardGetLocalNodeID(ins);
+    }
+
+    if (error != CANARD_OK)
+    {
+        out_stream->error = error;
+        return error;
+    }
+
+    out_stream->first = createTxStreamItem(out_stream);
+    out_stream->last = out_stream->first;
+    return out_stream->error;
+}
+
+void canardTxStreamWrite(CanardTxStream* stream, const void* data, uint16_t len)
+{
+    CANARD_ASSERT(stream != NULL);
+    CANARD_ASSERT((data != NULL) || (len == 0));
+    const uint8_t* const bytes = (const uint8_t*) data;
+
+    if (stream->bit_count != 0)                                             // Not on a byte boundary
+    {
+        for (uint16_t i = 0; i < len; i++)
+        {
+            canardTxStreamEncodeScalar(stream, 8, &bytes[i]);
+        }
+        return;
+    }
+    writeTxStreamBytes(stream, bytes, len);
+}
+
+void canardTxStreamEncodeScalar(CanardTxStream* stream, uint8_t bit_length, const void* value)
+{
+    CANARD_ASSERT(stream != NULL);
+    CANARD_ASSERT(value != NULL);
+    if (bit_length > 64)
+    {
+        CANARD_ASSERT(false);
+        bit_length = 64;
+    }
+    if (bit_length < 1)
+    {
+        CANARD_ASSERT(false);
+        bit_length = 1;
+    }
+
+    // Read the value as canardEncodeScalar() does; its bytes go out least significant first
+    uint64_t bits;
+    if      (bit_length == 1)   { bits = (*((const bool*) value) != 0) ? 1U : 0U; }
+    else if (bit_length <= 8)   { bits = *((const uint8_t*) value); }
+    else if (bit_length <= 16)  { bits = *((const uint16_t*) value); }
+    else if (bit_length <= 32)  { bits = *((const uint32_t*) value); }
+    else                        { bits = *((const uint64_t*) value); }
+
+    // The bits waiting from the previous value are the top bit_count bits of bit_buffer. The bytes of the value follow
+    // them, most significant bit first, and the low bits of a partial last byte come last, in the same order.
+    const uint8_t shift = stream->bit_count;
+    uint8_t carry = stream->bit_buffer;
+    uint8_t bytes[9];
+    uint8_t byte_count = 0;
+    const uint8_t whole_bytes = (uint8_t)(bit_length / 8U);
+    for (uint8_t i = 0; i < whole_bytes; i++)
+    {
+        const uint8_t byte = (uint8_t)(bits >> (8U * i));
+        bytes[byte_count++] = (uint8_t)(carry | (byte >> shift));
+        carry = (uint8_t)((uint32_t)byte << (8U - shift));
+    }
+
+    const uint8_t extra_bits = (uint8_t)(bit_length % 8U);
+    uint8_t carry_bits = shift;
+    if (extra_bits != 0U)
+    {
+        const uint8_t last = (uint8_t)((uint32_t)(bits >> (8U * whole_bytes)) << (8U - extra_bits));
+        carry = (uint8_t)(carry | (last >> shift));
+        carry_bits = (uint8_t)(shift + extra_bits);
+        if (carry_bits >= 8U)
+        {
+            bytes[byte_count++] = carry;
+            carry = (uint8_t)((uint32_t)last << (8U - shift));
+            carry_bits = (uint8_t)(carry_bits - 8U);
+        }
+    }
+
+    writeTxStreamBytes(stream, bytes, byte_count);
+    stream->bit_buffer = carry;
+    stream->bit_count = carry_bits;
+}
+
+int16_t canardTxStreamCommit(CanardTxStream* stream)
+{
+    CANARD_ASSERT(stream != NULL);
+    CanardInstance* const ins = stream->ins;
+
+    if (stream->bit_count != 0)
+    {
+        const uint8_t last_byte = stream->bit_buffer;
+        stream->bit_count = 0;
+        writeTxStreamBytes(stream, &last_byte, 1);
+    }
+
+    int16_t result = stream->error;
+    if (result == CANARD_OK)
+    {
+        CanardTxQueueItem* const first = stream->first;
+        CanardTxQueueItem* const last = stream->last;
+        const uint8_t transfer_id = (uint8_t)(*stream->transfer.inout_transfer_id & 31U);
+        // CAN FD pads the last frame to the next valid length, with zero bytes that the CRC covers
+        const uint8_t length = (uint8_t)(dlcToDataLength(dataLengthToDlc((uint16_t)(stream->frame_fill + 1U))) - 1U);
+
+        if (first == last)                                                  // Single frame transfer
+        {
+            if (canardGetLocalNodeID(ins) == 0)
+            {
+                const uint16_t discriminator = (uint16_t)(crcAdd(0xFFFFU, first->frame.data, stream->payload_len) &
+                                                          0x7FFEU);
+                stream->can_id |= (uint32_t) discriminator << 9U;
+                first->frame.id = stream->can_id | CANARD_CAN_FRAME_EFF;
+            }
+            first->frame.data[length] = (uint8_t)(0xC0U | transfer_id);
+            first->frame.data_len = (uint8_t)(length + 1U);
+        }
+        else
+        {
+            finishTxStreamFrame(stream, last, length, 0x40U);
+            first->frame.data[0] = (uint8_t) (stream->crc);
+            first->frame.data[1] = (uint8_t) (stream->crc >> 8U);
+        }
+
+        if ((stream->transfer.transfer_type == CanardTransferTypeBroadcast) && stream->transfer.coalesce)
+        {
+            for (CanardTxQueueItem* item = first; item != NULL; item = item->next)
+            {
+                item->coalesce = true;
+                item->coalesce_key = stream->transfer.coalesce_key;
+            }
+            coalesceTxQueue(ins, stream->can_id | CANARD_CAN_FRAME_EFF, &stream->transfer);
+        }
+
+#if CANARD_MULTI_IFACE
+        // The frames of the stream are held already, only the copies for the other interfaces need room
+        const uint8_t iface_mask = admitTxIfaces(ins, stream->transfer.iface_mask, stream->frame_count,
+                                                 stream->frame_count);
+        if (iface_mask == 0)
+        {
+            failTxStream(stream, -CANARD_ERROR_OUT_OF_MEMORY);
+            result = stream->error;
+        }
+        else
+#endif
+        {
+#if CANARD_MULTI_IFACE
+            queueTxChain(ins, first, last, stream->frame_count, iface_mask);
+#else
+            queueTxChain(ins, first, last, stream->frame_count);
+#endif
+            result = (int16_t) stream->frame_count;
+        }
+    }
+
+    updateTxStatistics(ins, result);
+    if ((result > 0) && (stream->transfer.transfer_type != CanardTransferTypeResponse))
+    {
+        incrementTransferID(stream->transfer.inout_transfer_id);            // Response Transfer ID must not be altered
+    }
+
+    stream->first = NULL;
+    stream->last = NULL;
+    return result;
+}
+
+void canardTxStreamAbort(CanardTxStream* stream)
+{
+    CANARD_ASSERT(stream != NULL);
+    freeTxChain(&stream->ins->allocator, stream->first);
+    stream->first = NULL;
+    stream->last = NULL;
+}
+
+#if CANARD_TX_TRANSFER_ID_SLOTS > 0
+int16_t canardBroadcastAuto(CanardInstance* ins, CanardTxTransfer* transfer)
+{
+    CanardTxTransfer managed = *transfer;
+    managed.transfer_type = CanardTransferTypeBroadcast;
+    managed.inout_transfer_id = txTransferIdSlot(ins, MAKE_TRANSFER_DESCRIPTOR(transfer->data_type_id,
+                                                                               CanardTransferTypeBroadcast, 0U, 0U));
+    if (managed.inout_transfer_id == NULL)
+    {
+        updateTxStatistics(ins, -CANARD_ERROR_OUT_OF_MEMORY);
+        return -CANARD_ERROR_OUT_OF_MEMORY;
+    }
+
+    return canardBroadcastObj(ins, &managed);
+}
+
+int16_t canardRequestAuto(CanardInstance* ins, uint8_t destination_node_id, CanardTxTransfer* transfer)
+{
+    CanardTxTransfer managed = *transfer;
+    managed.transfer_type = CanardTransferTypeRequest;
+    managed.inout_transfer_id = txTransferIdSlot(ins, MAKE_TRANSFER_DESCRIPTOR(transfer->data_type_id,
+                                                                               CanardTransferTypeRequest, 0U,
+                                                                               destination_node_id));
+    if (managed.inout_transfer_id == NULL)
+    {
+        updateTxStatistics(ins, -CANARD_ERROR_OUT_OF_MEMORY);
+        return -CANARD_ERROR_OUT_OF_MEMORY;
+    }
+
+    return canardRequestOrRespondObj(ins, destination_node_id, &managed);
+}
+#endif
+
 CanardCANFrame* canardPeekTxQueue(const CanardInstance* ins)
 {
-    if (ins->tx_queue == NULL)
+    if (ins->tx_queues[0].head == NULL)
     {
         return NULL;
     }
-    return &ins->tx_queue->frame;
+    return &ins->tx_queues[0].head->frame;
+}
+
+#if CANARD_ENABLE_DEADLINE
+uint64_t canardPeekTxQueueDeadline(const CanardInstance* ins)
+{
+    if (ins->tx_queues[0].head == NULL)
+    {
+        return 0;
+    }
+    return ins->tx_queues[0].head->frame.deadline_usec;
+}
+
+CanardCANFrame* canardPeekTxQueueUnexpired(CanardInstance* ins, uint64_t current_time_usec)
+{
+    CanardTxQueueItem* const item = peekUnexpiredTxItem(ins, &ins->tx_queues[0], current_time_usec);
+    return (item != NULL) ? &item->frame : NULL;
 }
+#endif
 
 void canardPopTxQueue(CanardInstance* ins)
 {
-    CanardTxQueueItem* item = ins->tx_queue;
-    ins->tx_queue = item->next;
-    freeBlock(&ins->allocator, item);
+    popTxQueue(ins, &ins->tx_queues[0]);
+}
+
+#if CANARD_MULTI_IFACE
+CanardCANFrame* canardPeekTxQueueIface(const CanardInstance* ins, uint8_t iface)
+{
+    CANARD_ASSERT(iface < CANARD_NUM_IFACES);
+    if (ins->tx_queues[iface].head == NULL)
+    {
+        return NULL;
+    }
+    return &ins->tx_queues[iface].head->frame;
+}
+
+void canardPopTxQueueIface(CanardInstance* ins, uint8_t iface)
+{
+    CANARD_ASSERT(iface < CANARD_NUM_IFACES);
+    popTxQueue(ins, &ins->tx_queues[iface]);
+}
+
+#if CANARD_ENABLE_DEADLINE
+CanardCANFrame* canardPeekTxQueueIfaceUnexpired(CanardInstance* ins, uint8_t iface, uint64_t current_time_usec)
+{
+    CANARD_ASSERT(iface < CANARD_NUM_IFACES);
+    CanardTxQueueItem* const item = peekUnexpiredTxItem(ins, &ins->tx_queues[iface], current_time_usec);
+    return (item != NULL) ? &item->frame : NULL;
+}
+#endif
+
+void canardSetTxQueueQuota(CanardInstance* ins, uint16_t max_blocks)
+{
+    ins->tx_queue_quota = max_blocks;
 }
+#endif
 
 int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, uint64_t timestamp_usec)
 {
-    const CanardTransferType transfer_type = extractTransferType(frame->id);
-    const uint8_t destination_node_id = (transfer_type == CanardTransferTypeBroadcast) ?
-                                        (uint8_t)CANARD_BROADCAST_NODE_ID :
-                                        DEST_ID_FROM_ID(frame->id);
+    int16_t result = screenRxFrame(frame, canardGetLocalNodeID(ins));
+    if (result == CANARD_OK)
+    {
+        result = handleScreenedRxFrame(ins, frame, timestamp_usec);
+    }
+    updateRxStatistics(ins, frame, result);
+    return result;
+}
+
+uint16_t canardHandleRxFrames(CanardInstance* ins,
+                              const CanardCANFrame* frames,
+                              uint16_t frame_count,
+                              const uint64_t* timestamps_usec)
+{
+    CANARD_ASSERT(ins != NULL);
+    CANARD_ASSERT((frames != NULL && timestamps_usec != NULL) || frame_count == 0);
+
+    uint8_t local_node_id = canardGetLocalNodeID(ins);
+    uint16_t handled = 0;
 
-    // TODO: This function should maintain statistics of transfer errors and such.
+    for (uint16_t i = 0; i < frame_count; i++)
+    {
+        int16_t result = screenRxFrame(&frames[i], local_node_id);
+        if (result == CANARD_OK)
+        {
+            result = handleScreenedRxFrame(ins, &frames[i], timestamps_usec[i]);
+            local_node_id = canardGetLocalNodeID(ins);     // A handler may have assigned the node ID
+        }
+        updateRxStatistics(ins, &frames[i], result);
+        if (result == CANARD_OK)
+        {
+            handled++;
+        }
+    }
+    return handled;
+}
 
-    if ((frame->id & CANARD_CAN_FRAME_EFF) == 0 ||
-        (frame->id & CANARD_CAN_FRAME_RTR) != 0 ||
-        (frame->id & CANARD_CAN_FRAME_ERR) != 0 ||
+CANARD_INTERNAL int16_t screenRxFrame(const CanardCANFrame* frame, uint8_t local_node_id)
+{
+    if ((frame->id & (CANARD_CAN_FRAME_EFF | CANARD_CAN_FRAME_RTR | CANARD_CAN_FRAME_ERR)) != CANARD_CAN_FRAME_EFF ||
         (frame->data_len < 1))
     {
         return -CANARD_ERROR_RX_INCOMPATIBLE_PACKET;
     }
 
-    if (transfer_type != CanardTransferTypeBroadcast &&
-        destination_node_id != canardGetLocalNodeID(ins))
+    if (SERVICE_NOT_MSG_FROM_ID(frame->id) && DEST_ID_FROM_ID(frame->id) != local_node_id)
     {
         return -CANARD_ERROR_RX_WRONG_ADDRESS;
     }
+    return CANARD_OK;
+}
 
+CANARD_INTERNAL int16_t handleScreenedRxFrame(CanardInstance* ins, const CanardCANFrame* frame, uint64_t timestamp_usec)
+{
+    const CanardTransferType transfer_type = extractTransferType(frame->id);
+    const uint8_t destination_node_id = (transfer_type == CanardTransferTypeBroadcast) ?
+                                        (uint8_t)CANARD_BROADCAST_NODE_ID :
+                                        DEST_ID_FROM_ID(frame->id);
     const uint8_t priority = PRIORITY_FROM_ID(frame->id);
     const uint8_t source_node_id = SOURCE_ID_FROM_ID(frame->id);
     const uint16_t data_type_id = extractDataType(frame->id);
@@ -437,9 +903,22 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
     if (IS_START_OF_TRANSFER(tail_byte))
     {
 
-        if (ins->should_accept(ins, &data_type_signature, data_type_id, transfer_type, source_node_id))
+        const CanardSubscription* const subscription = findSubscription(ins, data_type_id, transfer_type);
+        bool accepted = false;
+
+        if (subscription != NULL)
+        {
+            data_type_signature = subscription->data_type_signature;
+            accepted = true;
+        }
+        else if (ins->should_accept != NULL)
+        {
+            accepted = ins->should_accept(ins, &data_type_signature, data_type_id, transfer_type, source_node_id);
+        }
+
+        if (accepted)
         {
-            rx_state = traverseRxStates(ins, transfer_descriptor);
+            rx_state = traverseRxStates(ins, transfer_descriptor, priority);
 
             if(rx_state == NULL)
             {
@@ -464,21 +943,27 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
     CANARD_ASSERT(rx_state != NULL);    // All paths that lead to NULL should be terminated with return above
 
     // Resolving the state flags:
+    const uint32_t state_age_usec = (uint32_t)timestamp_usec - rx_state->timestamp_usec;
     const bool not_initialized = rx_state->timestamp_usec == 0;
-    const bool tid_timed_out = (timestamp_usec - rx_state->timestamp_usec) > TRANSFER_TIMEOUT_USEC;
+    const bool tid_timed_out = state_age_usec > TRANSFER_TIMEOUT_USEC;
     const bool same_iface = frame->iface_id == rx_state->iface_id;
     const bool first_frame = IS_START_OF_TRANSFER(tail_byte);
     const bool not_previous_tid =
         computeTransferIDForwardDistance((uint8_t) rx_state->transfer_id, TRANSFER_ID_FROM_TAIL_BYTE(tail_byte)) > 1;
-    const bool iface_switch_allowed = (timestamp_usec - rx_state->timestamp_usec) > IFACE_SWITCH_DELAY_USEC;
+    const bool iface_switch_allowed = state_age_usec > IFACE_SWITCH_DELAY_USEC;
     const bool non_wrapped_tid = computeTransferIDForwardDistance(TRANSFER_ID_FROM_TAIL_BYTE(tail_byte), (uint8_t) rx_state->transfer_id) < (1 << (TRANSFER_ID_BIT_LEN-1));
     const bool incomplete_frame = rx_state->buffer_blocks != CANARD_BUFFER_IDX_NONE;
+    // Redundant interfaces carry the same transfers; once the current one has gone quiet, another one that starts
+    // the expected transfer or a later one takes over, long before IFACE_SWITCH_DELAY_USEC
+    const bool iface_quiet = state_age_usec > IFACE_QUIET_TIMEOUT_USEC;
+    const bool iface_takeover = !same_iface && first_frame && iface_quiet && non_wrapped_tid;
 
     const bool need_restart =
             (not_initialized) ||
             (tid_timed_out) ||
             (same_iface && first_frame && (not_previous_tid || incomplete_frame)) ||
-            (iface_switch_allowed && first_frame && non_wrapped_tid);
+            (iface_switch_allowed && first_frame && non_wrapped_tid) ||
+            (iface_takeover);
 
     if (need_restart)
     {
@@ -501,7 +986,7 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
 
     if (IS_START_OF_TRANSFER(tail_byte) && IS_END_OF_TRANSFER(tail_byte)) // single frame transfer
     {
-        rx_state->timestamp_usec = timestamp_usec;
+        touchRxState(ins, rx_state, timestamp_usec);
         CanardRxTransfer rx_transfer = {
             .timestamp_usec = timestamp_usec,
             .payload_head = frame->data,
@@ -511,6 +996,9 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
             .transfer_id = TRANSFER_ID_FROM_TAIL_BYTE(tail_byte),
             .priority = priority,
             .source_node_id = source_node_id,
+#if CANARD_MULTI_IFACE
+            .iface_id = frame->iface_id,
+#endif
 #if CANARD_ENABLE_CANFD
             .canfd = frame->canfd,
             .tao = !(frame->canfd || ins->tao_disabled)
@@ -519,7 +1007,7 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
 #endif
         };
 
-        ins->on_reception(ins, &rx_transfer);
+        dispatchRxTransfer(ins, &rx_transfer);
 
         prepareForNextTransfer(rx_state);
         return CANARD_OK;
@@ -543,31 +1031,40 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
         }
 
         // take off the crc and store the payload
-        rx_state->timestamp_usec = timestamp_usec;
+        touchRxState(ins, rx_state, timestamp_usec);
+        rx_state->priority = priority;
         rx_state->payload_len = 0;
-        const int16_t ret = bufferBlockPushBytes(&ins->allocator, rx_state, frame->data + 2,
-                                                 (uint8_t) (frame->data_len - 3));
+        const uint16_t blocks = rxBlocksNeeded(rx_state, (uint8_t)(frame->data_len - 3));
+        const int16_t ret = admitRxBlocks(ins, priority, source_node_id, CanardPoolConsumerRxBuffer, blocks) ?
+                            bufferBlockPushBytes(&ins->allocator, rx_state, frame->data + 2,
+                                                 (uint8_t) (frame->data_len - 3)) :
+                            -CANARD_ERROR_OUT_OF_MEMORY;
         if (ret < 0)
         {
             releaseStatePayload(ins, rx_state);
             prepareForNextTransfer(rx_state);
             return -CANARD_ERROR_OUT_OF_MEMORY;
         }
+        chargeNodeBlocks(ins, source_node_id, (int16_t)blocks);
         rx_state->payload_crc = (uint16_t)(((uint16_t) frame->data[0]) | (uint16_t)((uint16_t) frame->data[1] << 8U));
-        rx_state->calculated_crc = crcAddSignature(0xFFFFU, data_type_signature);
+        rx_state->calculated_crc = crcSignatureSeed(ins, data_type_signature);
         rx_state->calculated_crc = crcAdd((uint16_t)rx_state->calculated_crc,
                                           frame->data + 2, (uint8_t)(frame->data_len - 3));
     }
     else if (!IS_START_OF_TRANSFER(tail_byte) && !IS_END_OF_TRANSFER(tail_byte))    // Middle of a multi-frame transfer
     {
-        const int16_t ret = bufferBlockPushBytes(&ins->allocator, rx_state, frame->data,
-                                                 (uint8_t) (frame->data_len - 1));
+        const uint16_t blocks = rxBlocksNeeded(rx_state, (uint8_t)(frame->data_len - 1));
+        const int16_t ret = admitRxBlocks(ins, priority, source_node_id, CanardPoolConsumerRxBuffer, blocks) ?
+                            bufferBlockPushBytes(&ins->allocator, rx_state, frame->data,
+                                                 (uint8_t) (frame->data_len - 1)) :
+                            -CANARD_ERROR_OUT_OF_MEMORY;
         if (ret < 0)
         {
             releaseStatePayload(ins, rx_state);
             prepareForNextTransfer(rx_state);
             return -CANARD_ERROR_OUT_OF_MEMORY;
         }
+        chargeNodeBlocks(ins, source_node_id, (int16_t)blocks);
         rx_state->calculated_crc = crcAdd((uint16_t)rx_state->calculated_crc,
                                           frame->data, (uint8_t)(frame->data_len - 1));
     }
@@ -593,15 +1090,10 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
             CanardBufferBlock* block = canardBufferFromIdx(&ins->allocator, rx_state->buffer_blocks);
             if (block != NULL)
             {
-                size_t offset = CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE;    // Payload offset of the first block
-                while (block->next != NULL)
-                {
-                    block = block->next;
-                    offset += CANARD_BUFFER_BLOCK_DATA_SIZE;
-                }
-                CANARD_ASSERT(block != NULL);
-
-                const size_t offset_within_block = rx_state->payload_len - offset;
+                // buffer_blocks is the last block; it is full unless the payload ends part way into it
+                const size_t used_in_block = (rx_state->payload_len - CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE) %
+                                             CANARD_BUFFER_BLOCK_DATA_SIZE;
+                const size_t offset_within_block = (used_in_block == 0) ? CANARD_BUFFER_BLOCK_DATA_SIZE : used_in_block;
                 CANARD_ASSERT(offset_within_block <= CANARD_BUFFER_BLOCK_DATA_SIZE);
 
                 for (size_t i = offset_within_block;
@@ -613,10 +1105,19 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
             }
         }
 
+        // Open the block ring so that the middle of the payload becomes a plain list starting at the first block
+        CanardBufferBlock* const last_block = canardBufferFromIdx(&ins->allocator, rx_state->buffer_blocks);
+        CanardBufferBlock* first_block = NULL;
+        if (last_block != NULL)
+        {
+            first_block = last_block->next;
+            last_block->next = NULL;
+        }
+
         CanardRxTransfer rx_transfer = {
             .timestamp_usec = timestamp_usec,
             .payload_head = rx_state->buffer_head,
-            .payload_middle = canardBufferFromIdx(&ins->allocator, rx_state->buffer_blocks),
+            .payload_middle = first_block,
             .payload_tail = (tail_offset >= frame_payload_size) ? NULL : (&frame->data[tail_offset]),
             .payload_len = (uint16_t)(rx_state->payload_len + frame_payload_size),
             .data_type_id = data_type_id,
@@ -624,7 +1125,10 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
             .transfer_id = TRANSFER_ID_FROM_TAIL_BYTE(tail_byte),
             .priority = priority,
             .source_node_id = source_node_id,
-
+#if CANARD_MULTI_IFACE
+            .iface_id = frame->iface_id,
+#endif
+
 #if CANARD_ENABLE_CANFD
             .canfd = frame->canfd,
             .tao = !(frame->canfd || ins->tao_disabled)
@@ -633,13 +1137,18 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
 #endif
         };
 
+        chargeNodeBlocks(ins, source_node_id, (int16_t)-(int16_t)rxPayloadBlocks(rx_state->payload_len));
         rx_state->buffer_blocks = CANARD_BUFFER_IDX_NONE;     // Block list ownership has been transferred to rx_transfer!
 
         // CRC validation
         rx_state->calculated_crc = crcAdd((uint16_t)rx_state->calculated_crc, frame->data, frame->data_len - 1U);
         if (rx_state->calculated_crc == rx_state->payload_crc)
         {
-            ins->on_reception(ins, &rx_transfer);
+            if (rx_transfer.payload_len <= ins->rx_payload_arena_size)
+            {
+                gatherTransferPayload(ins, &rx_transfer);
+            }
+            dispatchRxTransfer(ins, &rx_transfer);
         }
 
         // Making sure the payload is released even if the application didn't bother with it
@@ -662,67 +1171,56 @@ int16_t canardHandleRxFrame(CanardInstance* ins, const CanardCANFrame* frame, ui
 
 void canardCleanupStaleTransfers(CanardInstance* ins, uint64_t current_time_usec)
 {
-    CanardRxState* prev = ins->rx_states, * state = ins->rx_states;
-
+    // The expiry list is ordered by last start of transfer, so the expired states are all at its head
+    CanardRxState* state = ins->rx_expiry_head;
     while (state != NULL)
     {
-        if ((current_time_usec - state->timestamp_usec) > TRANSFER_TIMEOUT_USEC)
-        {
-            if (state == ins->rx_states)
-            {
-                releaseStatePayload(ins, state);
-                ins->rx_states = canardRxFromIdx(&ins->allocator, ins->rx_states->next);
-                freeBlock(&ins->allocator, state);
-                state = ins->rx_states;
-                prev = state;
-            }
-            else
-            {
-                releaseStatePayload(ins, state);
-                prev->next = state->next;
-                freeBlock(&ins->allocator, state);
-                state = canardRxFromIdx(&ins->allocator, prev->next);
-            }
-        }
-        else
+        ins->statistics.cleanup_visited++;
+        if ((state->timestamp_usec != 0) &&
+            ((uint32_t)((uint32_t)current_time_usec - state->timestamp_usec) <= TRANSFER_TIMEOUT_USEC))
         {
-            prev = state;
-            state = canardRxFromIdx(&ins->allocator, state->next);
+            break;
         }
+        CanardRxState* const next = rxStateFromBlockNumber(&ins->allocator, state->expiry_next);
+        removeRxState(ins, state);
+        ins->statistics.cleanup_removed++;
+        state = next;
     }
 
-#if CANARD_MULTI_IFACE || CANARD_ENABLE_DEADLINE
+#if CANARD_ENABLE_DEADLINE
+    if (current_time_usec <= ins->tx_deadline_usec)
+    {
+        return;                                 // No TX frame can have expired yet
+    }
+    ins->tx_deadline_usec = UINT64_MAX;
+
     // remove stale TX transfers
-    CanardTxQueueItem* prev_item = ins->tx_queue, * item = ins->tx_queue;
-    while (item != NULL)
+    for (uint8_t iface = 0; iface < CANARD_NUM_IFACES; iface++)
     {
-#if CANARD_MULTI_IFACE && CANARD_ENABLE_DEADLINE
-        if ((current_time_usec > item->frame.deadline_usec) || item->frame.iface_mask == 0)
-#elif CANARD_MULTI_IFACE
-        if (item->frame.iface_mask == 0)
-#else
-        if (current_time_usec > item->frame.deadline_usec)
-#endif
+        CanardTxQueue* const queue = &ins->tx_queues[iface];
+        CanardTxQueueItem* prev_item = NULL, * item = queue->head;
+        while (item != NULL)
         {
-            if (item == ins->tx_queue)
+            ins->statistics.cleanup_visited++;
+            const uint8_t tail_byte = item->frame.data[item->frame.data_len - 1U];
+            if (txDeadlinePassed(&item->frame, current_time_usec) && IS_START_OF_TRANSFER(tail_byte))
             {
-                ins->tx_queue = ins->tx_queue->next;
-                freeBlock(&ins->allocator, item);
-                item = ins->tx_queue;
-                prev_item = item;
+                const uint16_t blocks = queue->blocks;
+                item = removeTxTransfer(ins, queue, prev_item, item);
+                ins->statistics.cleanup_removed += (uint32_t)(blocks - queue->blocks);
+                ins->statistics.tx_expired++;
             }
             else
             {
-                prev_item->next = item->next;
-                freeBlock(&ins->allocator, item);
-                item = prev_item->next;
+                if (IS_START_OF_TRANSFER(tail_byte) && (item->frame.deadline_usec != 0U))
+                {
+                    // A started transfer is never removed here, so only the transfers yet to start bound the next scan
+                    ins->tx_deadline_usec = MIN(ins->tx_deadline_usec, item->frame.deadline_usec);
+                }
+                prev_item = item;
+                item = item->next;
             }
         }
-        else
-        {
-            prev_item = item;
-            item = item->next;
-        }
     }
 #endif
 }
@@ -733,7 +1231,31 @@ int16_t canardDecodeScalar(const CanardRxTransfer* transfer,
                            bool value_is_signed,
                            void* out_value)
 {
-    if (transfer == NULL || out_value == NULL)
+    if (transfer == NULL)
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
+    return canardReadScalar(&reader, bit_offset, bit_length, value_is_signed, out_value);
+}
+
+void canardInitRxReader(CanardRxReader* out_reader, const CanardRxTransfer* transfer)
+{
+    CANARD_ASSERT(out_reader != NULL);
+    out_reader->transfer = transfer;
+    out_reader->block = NULL;
+    out_reader->block_bit_offset = 0;
+}
+
+int16_t canardReadScalar(CanardRxReader* reader,
+                         uint32_t bit_offset,
+                         uint8_t bit_length,
+                         bool value_is_signed,
+                         void* out_value)
+{
+    if (reader == NULL || reader->transfer == NULL || out_value == NULL)
     {
         return -CANARD_ERROR_INVALID_ARGUMENT;
     }
@@ -768,7 +1290,7 @@ int16_t canardDecodeScalar(const CanardRxTransfer* transfer,
 
     memset(&storage, 0, sizeof(storage));   // This is important
 
-    const int16_t result = descatterTransferPayload(transfer, bit_offset, bit_length, &storage.bytes[0]);
+    const int16_t result = descatterTransferPayload(reader, bit_offset, bit_length, &storage.bytes[0]);
     if (result <= 0)
     {
         return result;
@@ -999,7 +1521,7 @@ void canardReleaseRxTransferPayload(CanardInstance* ins, CanardRxTransfer* trans
     while (transfer->payload_middle != NULL)
     {
         CanardBufferBlock* const temp = transfer->payload_middle->next;
-        freeBlock(&ins->allocator, transfer->payload_middle);
+        freeBlock(&ins->allocator, transfer->payload_middle, CanardPoolConsumerRxBuffer);
         transfer->payload_middle = temp;
     }
 
@@ -1014,6 +1536,73 @@ CanardPoolAllocatorStatistics canardGetPoolAllocatorStatistics(CanardInstance* i
     return ins->allocator.statistics;
 }
 
+CanardInstanceStatistics canardGetStatistics(const CanardInstance* ins)
+{
+    return ins->statistics;
+}
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+void canardSetBusBitRate(CanardInstance* ins, uint32_t bit_rate)
+{
+    ins->bus_load.bit_rate = bit_rate;
+}
+
+void canardUpdateBusLoad(CanardInstance* ins, uint64_t current_time_usec)
+{
+    CanardBusLoad* const load = &ins->bus_load;
+    if (!load->started)
+    {
+        load->started = true;
+        load->bucket_start_usec = current_time_usec;
+        load->bucket_tx_mark = ins->statistics.tx_bits;
+        load->bucket_rx_mark = ins->statistics.rx_bits;
+        return;
+    }
+    if (current_time_usec < load->bucket_start_usec + CANARD_BUS_LOAD_BUCKET_USEC)
+    {
+        return;
+    }
+
+    // Clear a bucket for every bucket period that passed without a call, then close the one that ends now
+    const uint64_t elapsed = (current_time_usec - load->bucket_start_usec) / CANARD_BUS_LOAD_BUCKET_USEC;
+    for (uint64_t i = 1; (i < elapsed) && (i < CANARD_BUS_LOAD_BUCKETS); i++)
+    {
+        load->tx_bits[load->bucket] = 0;
+        load->rx_bits[load->bucket] = 0;
+        load->bucket = (uint8_t)((load->bucket + 1U) % CANARD_BUS_LOAD_BUCKETS);
+    }
+    load->tx_bits[load->bucket] = ins->statistics.tx_bits - load->bucket_tx_mark;
+    load->rx_bits[load->bucket] = ins->statistics.rx_bits - load->bucket_rx_mark;
+    load->bucket = (uint8_t)((load->bucket + 1U) % CANARD_BUS_LOAD_BUCKETS);
+    load->bucket_start_usec += elapsed * CANARD_BUS_LOAD_BUCKET_USEC;
+    load->bucket_tx_mark = ins->statistics.tx_bits;
+    load->bucket_rx_mark = ins->statistics.rx_bits;
+
+    uint64_t tx_bits = 0;
+    uint64_t rx_bits = 0;
+    for (uint8_t i = 0; i < CANARD_BUS_LOAD_BUCKETS; i++)
+    {
+        tx_bits += load->tx_bits[i];
+        rx_bits += load->rx_bits[i];
+    }
+    // Bits the bus carries over the window in a thousandth of it
+    const uint64_t capacity = ((uint64_t) load->bit_rate * CANARD_BUS_LOAD_BUCKETS * CANARD_BUS_LOAD_BUCKET_USEC) /
+                              1000000000U;
+    load->tx_load_permille = busLoadPermille(tx_bits, capacity);
+    load->load_permille = busLoadPermille(tx_bits + rx_bits, capacity);
+}
+
+uint16_t canardGetBusLoad(const CanardInstance* ins)
+{
+    return ins->bus_load.load_permille;
+}
+
+uint16_t canardGetTxBusLoad(const CanardInstance* ins)
+{
+    return ins->bus_load.tx_load_permille;
+}
+#endif
+
 uint16_t canardConvertNativeFloatToFloat16(float value)
 {
     CANARD_ASSERT(sizeof(float) == CANARD_SIZEOF_FLOAT);
@@ -1168,19 +1757,53 @@ CANARD_INTERNAL int16_t enqueueTxFrames(CanardInstance* ins,
         return -CANARD_ERROR_INVALID_ARGUMENT;
     }
 
+#if CANARD_MULTI_IFACE
+    if ((transfer->iface_mask & ((1U << CANARD_NUM_IFACES) - 1U)) == 0)
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+#endif
+
     int16_t result = 0;
 #if CANARD_ENABLE_CANFD
     uint8_t frame_max_data_len = transfer->canfd ? CANARD_CANFD_FRAME_MAX_DATA_LEN:CANARD_CAN_FRAME_MAX_DATA_LEN;
 #else
     uint8_t frame_max_data_len = CANARD_CAN_FRAME_MAX_DATA_LEN;
 #endif
+    const uint8_t bytes_per_frame = frame_max_data_len-1; // sot/eot byte consumes one byte
+    const uint16_t frames_needed = (transfer->payload_len < frame_max_data_len) ? 1U :
+                                   (uint16_t)((transfer->payload_len + 2 + (bytes_per_frame-1)) / bytes_per_frame);
+
+    /*
+      see if we are going to be able to allocate enough blocks for
+      this transfer. If not then stop now, otherwise we will end
+      up doing a partial (corrupt) transfer which will just make
+      the situation worse as it will waste bus bandwidth
+     */
+#if CANARD_MULTI_IFACE
+    const uint8_t iface_mask = admitTxIfaces(ins, transfer->iface_mask, frames_needed, 0);
+    if (iface_mask == 0)
+#else
+    if (poolBlocksAvailable(&ins->allocator, CanardPoolConsumerTxItem) < frames_needed)
+#endif
+    {
+        if (ins->allocator.statistics.capacity_blocks - ins->allocator.statistics.current_usage_blocks >= frames_needed) {
+            ins->allocator.statistics.consumer_refused[CanardPoolConsumerTxItem]++;
+        }
+        return -CANARD_ERROR_OUT_OF_MEMORY;
+    }
+
+    CanardTxQueueItem* chain_head = NULL;
+    CanardTxQueueItem* queue_item = NULL;
+
     if (transfer->payload_len < frame_max_data_len)                        // Single frame transfer
     {
-        CanardTxQueueItem* queue_item = createTxItem(&ins->allocator);
+        queue_item = createTxItem(&ins->allocator);
         if (queue_item == NULL)
         {
             return -CANARD_ERROR_OUT_OF_MEMORY;
         }
+        chain_head = queue_item;
 
         memcpy(queue_item->frame.data, transfer->payload, transfer->payload_len);
 
@@ -1191,13 +1814,11 @@ CANARD_INTERNAL int16_t enqueueTxFrames(CanardInstance* ins,
 #if CANARD_ENABLE_DEADLINE
         queue_item->frame.deadline_usec = transfer->deadline_usec;
 #endif
-#if CANARD_MULTI_IFACE
-        queue_item->frame.iface_mask = transfer->iface_mask;
-#endif
 #if CANARD_ENABLE_CANFD
         queue_item->frame.canfd = transfer->canfd;
 #endif
-        pushTxQueue(ins, queue_item);
+        queue_item->coalesce = transfer->coalesce;
+        queue_item->coalesce_key = transfer->coalesce_key;
         result++;
     }
     else                                                                    // Multi frame transfer
@@ -1207,288 +1828,947 @@ CANARD_INTERNAL int16_t enqueueTxFrames(CanardInstance* ins,
         uint8_t sot_eot = 0x80;
 
         /*
-          see if we are going to be able to allocate enough blocks for
-          this transfer. If not then stop now, otherwise we will end
-          up doing a partial (corrupt) transfer which will just make
-          the situation worse as it will waste bus bandwidth
+          all frames of the transfer share one CAN ID, so they are
+          chained locally and spliced into the queue in one go
          */
-        const uint16_t total_bytes = transfer->payload_len + 2; // including CRC
-        const uint8_t bytes_per_frame = frame_max_data_len-1; // sot/eot byte consumes one byte
-        const uint16_t frames_needed = (total_bytes + (bytes_per_frame-1)) / bytes_per_frame;
-        const uint16_t blocks_available = ins->allocator.statistics.capacity_blocks - ins->allocator.statistics.current_usage_blocks;
-        if (blocks_available < frames_needed) {
-            return -CANARD_ERROR_OUT_OF_MEMORY;
-        }
-
-        CanardTxQueueItem* queue_item = NULL;
-
         while (transfer->payload_len - data_index != 0)
         {
+            CanardTxQueueItem* const prev_item = queue_item;
             queue_item = createTxItem(&ins->allocator);
             if (queue_item == NULL)
             {
                 CANARD_ASSERT(false);
+                freeTxChain(&ins->allocator, chain_head);
                 return -CANARD_ERROR_OUT_OF_MEMORY;
             }
-
-            uint16_t i = 0;
-            if (data_index == 0)
+            if (prev_item == NULL)
             {
-                // add crc
-                queue_item->frame.data[0] = (uint8_t) (crc);
-                queue_item->frame.data[1] = (uint8_t) (crc >> 8U);
-                i = 2;
+                chain_head = queue_item;
             }
             else
             {
-                i = 0;
+                prev_item->next = queue_item;
             }
 
-            for (; i < (frame_max_data_len - 1) && data_index < transfer->payload_len; i++, data_index++)
-            {
-                queue_item->frame.data[i] = transfer->payload[data_index];
-            }
+            // the first frame starts with the crc, which is filled in once the whole payload has been added to it
+            const uint16_t start = (data_index == 0) ? 2U : 0U;
+            const uint16_t chunk = (uint16_t)MIN((size_t)(bytes_per_frame - start),
+                                                 (size_t)(transfer->payload_len - data_index));
+            memcpy(&queue_item->frame.data[start], &transfer->payload[data_index], chunk);
+            data_index = (uint16_t)(data_index + chunk);
+
             // tail byte
             sot_eot = (data_index == transfer->payload_len) ? (uint8_t)0x40 : sot_eot;
-            
-            i = dlcToDataLength(dataLengthToDlc(i+1))-1;
+
+            // padding bytes of the last CAN FD frame are zero and covered by the crc as well
+            uint16_t i = dlcToDataLength(dataLengthToDlc((uint16_t)(start + chunk + 1U)))-1;
+            crc = crcAdd(crc, &queue_item->frame.data[start], (size_t)(i - start));
+
             queue_item->frame.data[i] = (uint8_t)(sot_eot | ((uint32_t)toggle << 5U) | ((uint32_t)*transfer->inout_transfer_id & 31U));
             queue_item->frame.id = can_id | CANARD_CAN_FRAME_EFF;
             queue_item->frame.data_len = (uint8_t)(i + 1);
 #if CANARD_ENABLE_DEADLINE
             queue_item->frame.deadline_usec = transfer->deadline_usec;
 #endif
-#if CANARD_MULTI_IFACE
-            queue_item->frame.iface_mask = transfer->iface_mask;
-#endif
 #if CANARD_ENABLE_CANFD
             queue_item->frame.canfd = transfer->canfd;
 #endif
-            pushTxQueue(ins, queue_item);
+            queue_item->coalesce = transfer->coalesce;
+            queue_item->coalesce_key = transfer->coalesce_key;
 
             result++;
             toggle ^= 1;
             sot_eot = 0;
         }
+
+        chain_head->frame.data[0] = (uint8_t) (crc);
+        chain_head->frame.data[1] = (uint8_t) (crc >> 8U);
     }
 
+#if CANARD_MULTI_IFACE
+    queueTxChain(ins, chain_head, queue_item, (uint16_t)result, iface_mask);
+#else
+    queueTxChain(ins, chain_head, queue_item, (uint16_t)result);
+#endif
+
     return result;
 }
 
 /**
- * Puts frame on on the TX queue. Higher priority placed first
+ * Puts the chain of frames of one transfer on the TX queues. With CANARD_MULTI_IFACE, the lowest interface of the
+ * mask takes the frames themselves and every other one gets a copy; the pool must have room for the copies.
  */
-CANARD_INTERNAL void pushTxQueue(CanardInstance* ins, CanardTxQueueItem* item)
+CANARD_INTERNAL void queueTxChain(CanardInstance* ins,
+                                  CanardTxQueueItem* first,
+                                  CanardTxQueueItem* last,
+                                  uint16_t frame_count
+#if CANARD_MULTI_IFACE
+                                  ,uint8_t iface_mask
+#endif
+)
 {
-    CANARD_ASSERT(ins != NULL);
-    CANARD_ASSERT(item->frame.data_len > 0);       // UAVCAN doesn't allow zero-payload frames
-
-    if (ins->tx_queue == NULL)
+#if CANARD_MULTI_IFACE
+    // Every other interface gets a copy of the frames, the lowest one takes the frames themselves
+    uint8_t lowest_iface = 0;
+    while ((iface_mask & (1U << lowest_iface)) == 0)
     {
-        ins->tx_queue = item;
-        return;
+        lowest_iface++;
     }
-
-    CanardTxQueueItem* queue = ins->tx_queue;
-    CanardTxQueueItem* previous = ins->tx_queue;
-
-    while (queue != NULL)
+    for (uint8_t iface = (uint8_t)(lowest_iface + 1U); iface < CANARD_NUM_IFACES; iface++)
     {
-        if (isPriorityHigher(queue->frame.id, item->frame.id)) // lower number wins
+        if ((iface_mask & (1U << iface)) != 0)
         {
-            if (queue == ins->tx_queue)
+            CanardTxQueueItem* copy_last = NULL;
+            CanardTxQueueItem* const copy = copyTxChain(&ins->allocator, first, iface, &copy_last);
+            CANARD_ASSERT(copy != NULL);                                    // Admitted by the caller
+            if (copy != NULL)
             {
-                item->next = queue;
-                ins->tx_queue = item;
-            }
-            else
-            {
-                previous->next = item;
-                item->next = queue;
-            }
-            return;
-        }
-        else
-        {
-            if (queue->next == NULL)
-            {
-                queue->next = item;
-                return;
-            }
-            else
-            {
-                previous = queue;
-                queue = queue->next;
+                spliceTxQueue(ins, &ins->tx_queues[iface], copy, copy_last, frame_count);
             }
         }
     }
+    for (CanardTxQueueItem* item = first; item != NULL; item = item->next)
+    {
+        item->frame.iface_mask = (uint8_t)(1U << lowest_iface);
+    }
+    spliceTxQueue(ins, &ins->tx_queues[lowest_iface], first, last, frame_count);
+#else
+    spliceTxQueue(ins, &ins->tx_queues[0], first, last, frame_count);
+#endif
 }
 
 /**
- * Creates new tx queue item from allocator
+ * Returns how many payload bytes a frame of the stream holds before its tail byte
  */
-CANARD_INTERNAL CanardTxQueueItem* createTxItem(CanardPoolAllocator* allocator)
+CANARD_INTERNAL uint8_t txStreamBytesPerFrame(const CanardTxStream* stream)
+{
+#if CANARD_ENABLE_CANFD
+    return (uint8_t)((stream->transfer.canfd ? CANARD_CANFD_FRAME_MAX_DATA_LEN : CANARD_CAN_FRAME_MAX_DATA_LEN) - 1U);
+#else
+    (void) stream;
+    return CANARD_CAN_FRAME_MAX_DATA_LEN - 1U;
+#endif
+}
+
+/**
+ * Takes a frame for the stream from the pool, or fails the stream if the TX quota or the pool ran out
+ */
+CANARD_INTERNAL CanardTxQueueItem* createTxStreamItem(CanardTxStream* stream)
 {
-    CanardTxQueueItem* item = (CanardTxQueueItem*) allocateBlock(allocator);
+    // The allocator enforces the TX quota and counts the refusal
+    CanardTxQueueItem* const item = createTxItem(&stream->ins->allocator);
     if (item == NULL)
     {
+        failTxStream(stream, -CANARD_ERROR_OUT_OF_MEMORY);
         return NULL;
     }
-    memset(item, 0, sizeof(*item));
+
+    item->frame.id = stream->can_id | CANARD_CAN_FRAME_EFF;
+#if CANARD_ENABLE_DEADLINE
+    item->frame.deadline_usec = stream->transfer.deadline_usec;
+#endif
+#if CANARD_ENABLE_CANFD
+    item->frame.canfd = stream->transfer.canfd;
+#endif
+    stream->frame_count++;
     return item;
 }
 
 /**
- * Returns true if priority of rhs is higher than id
+ * Records the first error of a stream and gives its frames back to the pool; later writes are ignored
  */
-CANARD_INTERNAL bool isPriorityHigher(uint32_t rhs, uint32_t id)
+CANARD_INTERNAL void failTxStream(CanardTxStream* stream, int16_t error)
 {
-    const uint32_t clean_id = id & CANARD_CAN_EXT_ID_MASK;
-    const uint32_t rhs_clean_id = rhs & CANARD_CAN_EXT_ID_MASK;
+    if (stream->error == CANARD_OK)
+    {
+        stream->error = error;
+    }
+    freeTxChain(&stream->ins->allocator, stream->first);
+    stream->first = NULL;
+    stream->last = NULL;
+}
 
-    /*
-     * STD vs EXT - if 11 most significant bits are the same, EXT loses.
-     */
-    const bool ext = (id & CANARD_CAN_FRAME_EFF) != 0;
-    const bool rhs_ext = (rhs & CANARD_CAN_FRAME_EFF) != 0;
-    if (ext != rhs_ext)
+/**
+ * Finishes the full frame being filled and starts the next one. The first time, the single frame written so far
+ * becomes the first frame of a multi-frame transfer: its last two bytes move to the second frame to make room for the
+ * CRC in front. Returns false if the stream failed.
+ */
+CANARD_INTERNAL bool advanceTxStream(CanardTxStream* stream)
+{
+    const uint8_t bytes_per_frame = txStreamBytesPerFrame(stream);
+    CanardTxQueueItem* const full = stream->last;
+    const bool first_frame = (full == stream->first);
+
+    if (first_frame && (canardGetLocalNodeID(stream->ins) == 0))
     {
-        uint32_t arb11 = ext ? (clean_id >> 18U) : clean_id;
-        uint32_t rhs_arb11 = rhs_ext ? (rhs_clean_id >> 18U) : rhs_clean_id;
-        if (arb11 != rhs_arb11)
-        {
-            return arb11 < rhs_arb11;
-        }
-        else
-        {
-            return rhs_ext;
-        }
+        failTxStream(stream, -CANARD_ERROR_NODE_ID_NOT_SET);               // Anonymous transfers are single frame
+        return false;
     }
 
-    /*
-     * RTR vs Data frame - if frame identifiers and frame types are the same, RTR loses.
-     */
-    const bool rtr = (id & CANARD_CAN_FRAME_RTR) != 0;
-    const bool rhs_rtr = (rhs & CANARD_CAN_FRAME_RTR) != 0;
-    if (clean_id == rhs_clean_id && rtr != rhs_rtr)
+    CanardTxQueueItem* const item = createTxStreamItem(stream);
+    if (item == NULL)
     {
-        return rhs_rtr;
+        return false;
     }
+    full->next = item;
+    stream->last = item;
+    stream->frame_fill = 0;
 
-    /*
-     * Plain ID arbitration - greater value loses.
-     */
-    return clean_id < rhs_clean_id;
+    if (first_frame)
+    {
+        memcpy(&item->frame.data[0], &full->frame.data[bytes_per_frame - 2U], 2U);
+        memmove(&full->frame.data[2], &full->frame.data[0], (size_t)(bytes_per_frame - 2U));
+        stream->frame_fill = 2;
+        stream->crc = crcSignatureSeed(stream->ins, stream->transfer.data_type_signature);
+    }
+    finishTxStreamFrame(stream, full, bytes_per_frame, first_frame ? 0x80U : 0U);
+    return true;
 }
 
 /**
- * preps the rx state for the next transfer. does not delete the state
+ * Adds the payload of a frame of a multi-frame transfer to the CRC and appends its tail byte
  */
-CANARD_INTERNAL void prepareForNextTransfer(CanardRxState* state)
+CANARD_INTERNAL void finishTxStreamFrame(CanardTxStream* stream, CanardTxQueueItem* item, uint8_t length,
+                                         uint8_t sot_eot)
 {
-    CANARD_ASSERT(state->buffer_blocks == CANARD_BUFFER_IDX_NONE);
-    state->transfer_id++;
-    state->payload_len = 0;
-    state->next_toggle = 0;
+    const uint8_t start = (item == stream->first) ? 2U : 0U;
+    stream->crc = crcAdd(stream->crc, &item->frame.data[start], (size_t)(length - start));
+    item->frame.data[length] = (uint8_t)(sot_eot | ((uint32_t)stream->toggle << 5U) |
+                                         ((uint32_t)*stream->transfer.inout_transfer_id & 31U));
+    item->frame.data_len = (uint8_t)(length + 1U);
+    stream->toggle ^= 1U;
 }
 
 /**
- * returns data type from id
+ * Copies payload bytes into the frames of a stream, starting new frames as they fill up
  */
-uint16_t extractDataType(uint32_t id)
+CANARD_INTERNAL void writeTxStreamBytes(CanardTxStream* stream, const uint8_t* bytes, uint16_t len)
 {
-    if (extractTransferType(id) == CanardTransferTypeBroadcast)
+    const uint8_t bytes_per_frame = txStreamBytesPerFrame(stream);
+    if (stream->error != CANARD_OK)
     {
-        uint16_t dtid = MSG_TYPE_FROM_ID(id);
-        if (SOURCE_ID_FROM_ID(id) == CANARD_BROADCAST_NODE_ID)
+        return;
+    }
+    if ((stream->ins->node_id == 0U) && ((uint32_t)stream->payload_len + len > 7U))
+    {
+        failTxStream(stream, -CANARD_ERROR_NODE_ID_NOT_SET);
+        return;
+    }
+    stream->payload_len = (uint16_t)(stream->payload_len + len);
+
+    // Encoders write a field at a time, which mostly fits in the frame being filled
+    uint8_t fill = stream->frame_fill;
+    if ((uint16_t)(fill + len) <= bytes_per_frame)
+    {
+        uint8_t* const data = &stream->last->frame.data[fill];
+        for (uint8_t i = 0; i < len; i++)
         {
-            dtid &= (1U << ANON_MSG_DATA_TYPE_ID_BIT_LEN) - 1U;
+            data[i] = bytes[i];
         }
-        return dtid;
+        stream->frame_fill = (uint8_t)(fill + len);
+        return;
     }
-    else
+
+    while (len > 0)
     {
-        return (uint16_t) SRV_TYPE_FROM_ID(id);
+        if ((stream->frame_fill == bytes_per_frame) && !advanceTxStream(stream))
+        {
+            break;
+        }
+        const uint8_t chunk = (uint8_t)MIN((uint16_t)(bytes_per_frame - stream->frame_fill), len);
+        memcpy(&stream->last->frame.data[stream->frame_fill], bytes, chunk);
+        stream->frame_fill = (uint8_t)(stream->frame_fill + chunk);
+        bytes += chunk;
+        len = (uint16_t)(len - chunk);
     }
 }
 
+#if CANARD_MULTI_IFACE
 /**
- * returns transfer type from id
+ * Returns the interfaces of the mask whose TX queue and the pool have room for the frames of a transfer, counting the
+ * interfaces that are left out. 'frames_held' frames of the transfer were already taken from the pool, and serve the
+ * first admitted interface.
  */
-CanardTransferType extractTransferType(uint32_t id)
+CANARD_INTERNAL uint8_t admitTxIfaces(CanardInstance* ins, uint8_t iface_mask, uint16_t frames_needed,
+                                      uint16_t frames_held)
 {
-    const bool is_service = SERVICE_NOT_MSG_FROM_ID(id);
-    if (!is_service)
-    {
-        return CanardTransferTypeBroadcast;
-    }
-    else if (REQUEST_NOT_RESPONSE_FROM_ID(id) == 1)
-    {
-        return CanardTransferTypeRequest;
-    }
-    else
+    uint16_t blocks_available = (uint16_t)(poolBlocksAvailable(&ins->allocator, CanardPoolConsumerTxItem) +
+                                           frames_held);
+    uint8_t admitted = 0;
+
+    for (uint8_t iface = 0; iface < CANARD_NUM_IFACES; iface++)
     {
-        return CanardTransferTypeResponse;
+        if ((iface_mask & (1U << iface)) == 0)
+        {
+            continue;
+        }
+        const bool over_quota = (ins->tx_queue_quota != 0) &&
+                                ((uint32_t)ins->tx_queues[iface].blocks + frames_needed > ins->tx_queue_quota);
+        if (over_quota || (blocks_available < frames_needed))
+        {
+            ins->statistics.tx_iface_refused[iface]++;
+            continue;
+        }
+        blocks_available = (uint16_t)(blocks_available - frames_needed);
+        admitted = (uint8_t)(admitted | (1U << iface));
     }
+    return admitted;
 }
 
-/*
- *  CanardRxState functions
- */
-
 /**
- * Traverses the list of CanardRxState's and returns a pointer to the CanardRxState
- * with either the Id or a new one at the end
+ * Returns a copy of a chain of frames for the TX queue of another interface, or NULL if the pool ran out
  */
-CANARD_INTERNAL CanardRxState* traverseRxStates(CanardInstance* ins, uint32_t transfer_descriptor)
+CANARD_INTERNAL CanardTxQueueItem* copyTxChain(CanardPoolAllocator* allocator,
+                                               const CanardTxQueueItem* first,
+                                               uint8_t iface,
+                                               CanardTxQueueItem** out_last)
 {
-    CanardRxState* states = ins->rx_states;
+    CanardTxQueueItem* copy_head = NULL;
+    CanardTxQueueItem* copy_last = NULL;
 
-    if (states == NULL) // initialize CanardRxStates
+    for (const CanardTxQueueItem* item = first; item != NULL; item = item->next)
     {
-        states = createRxState(&ins->allocator, transfer_descriptor);
-
-        if(states == NULL)
+        CanardTxQueueItem* const copy = (CanardTxQueueItem*) allocateBlock(allocator, CanardPoolConsumerTxItem);
+        if (copy == NULL)
         {
+            freeTxChain(allocator, copy_head);
             return NULL;
         }
-
-        ins->rx_states = states;
-        return states;
+        copy->next = NULL;
+        copy->frame = item->frame;
+        copy->frame.iface_mask = (uint8_t)(1U << iface);
+        copy->coalesce = item->coalesce;
+        copy->coalesce_key = item->coalesce_key;
+        if (copy_last == NULL)
+        {
+            copy_head = copy;
+        }
+        else
+        {
+            copy_last->next = copy;
+        }
+        copy_last = copy;
     }
 
-    states = findRxState(ins, transfer_descriptor);
-    if (states != NULL)
-    {
-        return states;
-    }
-    else
-    {
-        return prependRxState(ins, transfer_descriptor);
-    }
+    *out_last = copy_last;
+    return copy_head;
 }
+#endif
 
 /**
- * returns pointer to the rx state of transfer descriptor or null if not found
+ * Returns the frames of a chain that was never queued to the pool
  */
-CANARD_INTERNAL CanardRxState* findRxState(CanardInstance *ins, uint32_t transfer_descriptor)
+CANARD_INTERNAL void freeTxChain(CanardPoolAllocator* allocator, CanardTxQueueItem* first)
 {
-    CanardRxState *state = ins->rx_states;
-    while (state != NULL)
+    while (first != NULL)
     {
-        if (state->dtid_tt_snid_dnid == transfer_descriptor)
-        {
-            return state;
-        }
-        state = canardRxFromIdx(&ins->allocator, state->next);
+        CanardTxQueueItem* const next_item = first->next;
+        freeBlock(allocator, first, CanardPoolConsumerTxItem);
+        first = next_item;
     }
-    return NULL;
 }
 
 /**
- * prepends rx state to the canard instance rx_states
+ * Takes the frame at the head of a TX queue off it, once it was handed to the CAN controller
  */
-CANARD_INTERNAL CanardRxState* prependRxState(CanardInstance* ins, uint32_t transfer_descriptor)
+CANARD_INTERNAL void popTxQueue(CanardInstance* ins, CanardTxQueue* queue)
+{
+    CanardTxQueueItem* item = queue->head;
+    ins->statistics.tx_frames++;
+    ins->statistics.tx_bits += frameWireBits(&item->frame);
+    removeTxItem(queue, NULL, item);
+    freeBlock(&ins->allocator, item, CanardPoolConsumerTxItem);
+}
+
+/**
+ * Puts a chain of frames sharing one CAN ID on a TX queue in a single insertion, keeping their order
+ */
+CANARD_INTERNAL void spliceTxQueue(CanardInstance* ins,
+                                   CanardTxQueue* queue,
+                                   CanardTxQueueItem* first,
+                                   CanardTxQueueItem* last,
+                                   uint16_t frame_count)
+{
+    CANARD_ASSERT(ins != NULL);
+    CANARD_ASSERT((first != NULL) && (last != NULL) && (last->next == NULL));
+    CANARD_ASSERT(first->frame.data_len > 0);      // UAVCAN doesn't allow zero-payload frames
+
+#if CANARD_ENABLE_DEADLINE
+    if (first->frame.deadline_usec != 0U)
+    {
+        ins->tx_deadline_usec = MIN(ins->tx_deadline_usec, first->frame.deadline_usec);
+    }
+#else
+    (void)ins;
+#endif
+
+    /*
+     * The queue is one list in arbitration order. The priority bits are the most significant bits of the CAN ID, so
+     * the frames of each priority level form a contiguous run, and the tail of each run is indexed. A frame that does
+     * not win against the tail of its level, e.g. a repeated publication of the same type, goes right after it.
+     * Otherwise only the frames of its own level are walked.
+     *
+     * Worst case: a frame that beats the tail of its level walks that level from its first frame, so the insertion is
+     * O(k) in the number of frames queued at that priority. When all traffic uses one priority, e.g. everything at
+     * CANARD_TRANSFER_PRIORITY_MEDIUM, that is O(n) in the queue depth, as without the index. A sorted structure per
+     * level would need extra links in every queued frame, competing with the frame for room in its pool block.
+     */
+    const uint8_t level = PRIORITY_FROM_ID(first->frame.id);
+    CanardTxQueueItem* previous = queue->level_tails[level];
+
+    if ((previous == NULL) || isPriorityHigher(previous->frame.id, first->frame.id))
+    {
+        previous = txLevelPredecessor(queue, level);
+        CanardTxQueueItem* next = (previous != NULL) ? previous->next : queue->head;
+        while ((next != NULL) && (PRIORITY_FROM_ID(next->frame.id) == level) &&
+               !isPriorityHigher(next->frame.id, first->frame.id))
+        {
+            previous = next;
+            next = next->next;
+        }
+    }
+
+    if (previous == NULL)
+    {
+        last->next = queue->head;
+        queue->head = first;
+    }
+    else
+    {
+        last->next = previous->next;
+        previous->next = first;
+    }
+
+    if ((last->next == NULL) || (PRIORITY_FROM_ID(last->next->frame.id) != level))
+    {
+        queue->level_tails[level] = last;
+    }
+    queue->levels |= 1UL << level;
+    queue->blocks = (uint16_t)(queue->blocks + frame_count);
+}
+
+/**
+ * Returns the last queued frame of the closest priority level above the given one, or NULL if there is none
+ */
+CANARD_INTERNAL CanardTxQueueItem* txLevelPredecessor(const CanardTxQueue* queue, uint8_t level)
+{
+    uint32_t levels = queue->levels & ((1UL << level) - 1U);
+    if (levels == 0)
+    {
+        return NULL;
+    }
+#if defined(__GNUC__)
+    return queue->level_tails[31 - __builtin_clz(levels)];
+#else
+    uint8_t above = 0;
+    while ((levels >>= 1U) != 0)
+    {
+        above++;
+    }
+    return queue->level_tails[above];
+#endif
+}
+
+/**
+ * Drops the queued transfers with the given frame ID and the coalescing key of the transfer whose first frame is still
+ * in the queue, on each interface the transfer is going to be sent on. The frames of a transfer are contiguous,
+ * because it is spliced in at once behind any frames with the same ID.
+ */
+CANARD_INTERNAL void coalesceTxQueue(CanardInstance* ins, uint32_t frame_id, const CanardTxTransfer* transfer)
+{
+    const uint8_t level = PRIORITY_FROM_ID(frame_id);
+
+    for (uint8_t iface = 0; iface < CANARD_NUM_IFACES; iface++)
+    {
+        CanardTxQueue* const queue = &ins->tx_queues[iface];
+#if CANARD_MULTI_IFACE
+        if ((transfer->iface_mask & (1U << iface)) == 0)
+        {
+            continue;
+        }
+#endif
+        if ((queue->levels & (1UL << level)) == 0)
+        {
+            continue;
+        }
+
+        CanardTxQueueItem* previous = txLevelPredecessor(queue, level);
+        CanardTxQueueItem* item = (previous != NULL) ? previous->next : queue->head;
+        bool dropping = false;
+
+        while ((item != NULL) && (PRIORITY_FROM_ID(item->frame.id) == level))
+        {
+            CanardTxQueueItem* const next_item = item->next;
+            if ((item->frame.id == frame_id) && item->coalesce && (item->coalesce_key == transfer->coalesce_key))
+            {
+                const uint8_t tail_byte = item->frame.data[item->frame.data_len - 1U];
+                if (IS_START_OF_TRANSFER(tail_byte))
+                {
+                    dropping = true;
+                    ins->statistics.tx_coalesced++;
+                }
+                if (dropping)
+                {
+                    dropping = !IS_END_OF_TRANSFER(tail_byte);
+                    removeTxItem(queue, previous, item);
+                    freeBlock(&ins->allocator, item, CanardPoolConsumerTxItem);
+                    item = next_item;
+                    continue;
+                }
+            }
+            previous = item;
+            item = next_item;
+        }
+    }
+}
+
+#if CANARD_ENABLE_DEADLINE
+/**
+ * Returns true if the frame has a deadline and it has passed. A zero deadline, as left by canardInitTxTransfer(),
+ * means that the frame never expires.
+ */
+CANARD_INTERNAL bool txDeadlinePassed(const CanardCANFrame* frame, uint64_t current_time_usec)
+{
+    return (frame->deadline_usec != 0U) && (current_time_usec > frame->deadline_usec);
+}
+
+/**
+ * Drops the expired transfers at the head of a TX queue and returns the new head. A transfer that has been started
+ * stays, so that it is not cut short.
+ */
+CANARD_INTERNAL CanardTxQueueItem* peekUnexpiredTxItem(CanardInstance* ins,
+                                                       CanardTxQueue* queue,
+                                                       uint64_t current_time_usec)
+{
+    while ((queue->head != NULL) && txDeadlinePassed(&queue->head->frame, current_time_usec))
+    {
+        const CanardCANFrame* const frame = &queue->head->frame;
+        if (!IS_START_OF_TRANSFER(frame->data[frame->data_len - 1U]))
+        {
+            break;
+        }
+        (void) removeTxTransfer(ins, queue, NULL, queue->head);
+        ins->statistics.tx_expired++;
+    }
+    return queue->head;
+}
+
+/**
+ * Removes the frames of one transfer from a TX queue, starting at its first frame, and returns the item that followed
+ * them. The frames of a transfer are contiguous, see coalesceTxQueue().
+ */
+CANARD_INTERNAL CanardTxQueueItem* removeTxTransfer(CanardInstance* ins,
+                                                    CanardTxQueue* queue,
+                                                    CanardTxQueueItem* previous,
+                                                    CanardTxQueueItem* first)
+{
+    CanardTxQueueItem* item = first;
+    bool end_of_transfer = false;
+    while ((item != NULL) && !end_of_transfer)
+    {
+        CanardTxQueueItem* const next_item = item->next;
+        end_of_transfer = IS_END_OF_TRANSFER(item->frame.data[item->frame.data_len - 1U]);
+        removeTxItem(queue, previous, item);
+        freeBlock(&ins->allocator, item, CanardPoolConsumerTxItem);
+        item = next_item;
+    }
+    return item;
+}
+#endif
+
+/**
+ * Unlinks a frame from a TX queue; previous is the frame before it, or NULL if it is the head
+ */
+CANARD_INTERNAL void removeTxItem(CanardTxQueue* queue, CanardTxQueueItem* previous, CanardTxQueueItem* item)
+{
+    CANARD_ASSERT(((previous == NULL) ? queue->head : previous->next) == item);
+
+    if (previous == NULL)
+    {
+        queue->head = item->next;
+    }
+    else
+    {
+        previous->next = item->next;
+    }
+
+    const uint8_t level = PRIORITY_FROM_ID(item->frame.id);
+    if (queue->level_tails[level] == item)
+    {
+        if ((previous != NULL) && (PRIORITY_FROM_ID(previous->frame.id) == level))
+        {
+            queue->level_tails[level] = previous;
+        }
+        else
+        {
+            queue->level_tails[level] = NULL;
+            queue->levels &= ~(1UL << level);
+        }
+    }
+    queue->blocks--;
+    item->next = NULL;
+}
+
+/**
+ * Creates new tx queue item from allocator
+ */
+CANARD_INTERNAL CanardTxQueueItem* createTxItem(CanardPoolAllocator* allocator)
+{
+    CanardTxQueueItem* item = (CanardTxQueueItem*) allocateBlock(allocator, CanardPoolConsumerTxItem);
+    if (item == NULL)
+    {
+        return NULL;
+    }
+    memset(item, 0, sizeof(*item));
+    return item;
+}
+
+/**
+ * Returns true if priority of rhs is higher than id
+ */
+CANARD_INTERNAL bool isPriorityHigher(uint32_t rhs, uint32_t id)
+{
+    const uint32_t clean_id = id & CANARD_CAN_EXT_ID_MASK;
+    const uint32_t rhs_clean_id = rhs & CANARD_CAN_EXT_ID_MASK;
+
+    /*
+     * STD vs EXT - if 11 most significant bits are the same, EXT loses.
+     */
+    const bool ext = (id & CANARD_CAN_FRAME_EFF) != 0;
+    const bool rhs_ext = (rhs & CANARD_CAN_FRAME_EFF) != 0;
+    if (ext != rhs_ext)
+    {
+        uint32_t arb11 = ext ? (clean_id >> 18U) : clean_id;
+        uint32_t rhs_arb11 = rhs_ext ? (rhs_clean_id >> 18U) : rhs_clean_id;
+        if (arb11 != rhs_arb11)
+        {
+            return arb11 < rhs_arb11;
+        }
+        else
+        {
+            return rhs_ext;
+        }
+    }
+
+    /*
+     * RTR vs Data frame - if frame identifiers and frame types are the same, RTR loses.
+     */
+    const bool rtr = (id & CANARD_CAN_FRAME_RTR) != 0;
+    const bool rhs_rtr = (rhs & CANARD_CAN_FRAME_RTR) != 0;
+    if (clean_id == rhs_clean_id && rtr != rhs_rtr)
+    {
+        return rhs_rtr;
+    }
+
+    /*
+     * Plain ID arbitration - greater value loses.
+     */
+    return clean_id < rhs_clean_id;
+}
+
+/**
+ * preps the rx state for the next transfer. does not delete the state
+ */
+CANARD_INTERNAL void prepareForNextTransfer(CanardRxState* state)
+{
+    CANARD_ASSERT(state->buffer_blocks == CANARD_BUFFER_IDX_NONE);
+    state->transfer_id++;
+    state->payload_len = 0;
+    state->next_toggle = 0;
+}
+
+/**
+ * returns data type from id
+ */
+uint16_t extractDataType(uint32_t id)
+{
+    if (extractTransferType(id) == CanardTransferTypeBroadcast)
+    {
+        uint16_t dtid = MSG_TYPE_FROM_ID(id);
+        if (SOURCE_ID_FROM_ID(id) == CANARD_BROADCAST_NODE_ID)
+        {
+            dtid &= (1U << ANON_MSG_DATA_TYPE_ID_BIT_LEN) - 1U;
+        }
+        return dtid;
+    }
+    else
+    {
+        return (uint16_t) SRV_TYPE_FROM_ID(id);
+    }
+}
+
+/**
+ * returns transfer type from id
+ */
+CanardTransferType extractTransferType(uint32_t id)
+{
+    const bool is_service = SERVICE_NOT_MSG_FROM_ID(id);
+    if (!is_service)
+    {
+        return CanardTransferTypeBroadcast;
+    }
+    else if (REQUEST_NOT_RESPONSE_FROM_ID(id) == 1)
+    {
+        return CanardTransferTypeRequest;
+    }
+    else
+    {
+        return CanardTransferTypeResponse;
+    }
+}
+
+/**
+ * Returns the subscription table entry for the data type, or NULL if it has none
+ */
+CANARD_INTERNAL const CanardSubscription* findSubscription(const CanardInstance* ins,
+                                                          uint16_t data_type_id,
+                                                          CanardTransferType transfer_type)
+{
+    const uint32_t key = SUBSCRIPTION_KEY(data_type_id, transfer_type);
+    uint16_t low = 0;
+    uint16_t high = ins->subscription_count;
+
+    while (low < high)
+    {
+        const uint16_t mid = (uint16_t)(low + ((high - low) / 2U));
+        const uint32_t mid_key = SUBSCRIPTION_KEY(ins->subscriptions[mid].data_type_id,
+                                                  ins->subscriptions[mid].transfer_type);
+        if (mid_key == key)
+        {
+            return &ins->subscriptions[mid];
+        }
+        if (mid_key < key)
+        {
+            low = (uint16_t)(mid + 1U);
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Hands a received transfer to its subscription handler, or to the on_reception callback
+ */
+CANARD_INTERNAL void dispatchRxTransfer(CanardInstance* ins, CanardRxTransfer* transfer)
+{
+    const CanardSubscription* const subscription =
+        findSubscription(ins, transfer->data_type_id, (CanardTransferType)transfer->transfer_type);
+
+    ins->statistics.rx_transfers++;
+
+    if (subscription != NULL)
+    {
+        subscription->handler(ins, transfer);
+    }
+    else if (ins->on_reception != NULL)
+    {
+        ins->on_reception(ins, transfer);
+    }
+}
+
+/**
+ * Copies the scattered payload of a multi-frame transfer into the RX payload arena, releases its pool blocks and
+ * points the transfer at the copy
+ */
+CANARD_INTERNAL void gatherTransferPayload(CanardInstance* ins, CanardRxTransfer* transfer)
+{
+    CANARD_ASSERT(ins->rx_payload_arena != NULL);
+    CANARD_ASSERT(transfer->payload_len <= ins->rx_payload_arena_size);
+
+    uint8_t* const arena = ins->rx_payload_arena;
+    const uint16_t payload_len = transfer->payload_len;
+    uint16_t copied = (uint16_t)MIN(payload_len, CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE);
+
+    memcpy(arena, transfer->payload_head, copied);
+
+    for (const CanardBufferBlock* block = transfer->payload_middle; block != NULL && copied < payload_len;
+         block = block->next)
+    {
+        const uint16_t amount = (uint16_t)MIN((size_t)(payload_len - copied), CANARD_BUFFER_BLOCK_DATA_SIZE);
+        memcpy(&arena[copied], &block->data[0], amount);
+        copied = (uint16_t)(copied + amount);
+    }
+
+    if (transfer->payload_tail != NULL && copied < payload_len)
+    {
+        memcpy(&arena[copied], transfer->payload_tail, (size_t)(payload_len - copied));
+    }
+
+    canardReleaseRxTransferPayload(ins, transfer);
+    transfer->payload_head = arena;
+    transfer->payload_len = payload_len;
+}
+
+/**
+ * Returns the worst case number of bits the frame takes on the bus, interframe space included
+ */
+CANARD_INTERNAL uint16_t frameWireBits(const CanardCANFrame* frame)
+{
+    // SOF, ID, SRR, IDE, RTR, two reserved bits, DLC, data and CRC are subject to bit stuffing; the CRC delimiter,
+    // ACK, EOF and interframe space (13 bits) are not. A stuff bit follows every 5 equal bits, and since a stuff bit
+    // starts the next run, at most one in every 4 bits after the first is a stuff bit.
+    const uint16_t stuffed = (uint16_t)((((frame->id & CANARD_CAN_FRAME_EFF) != 0U) ? 54U : 34U) +
+                                        8U * frame->data_len);
+    return (uint16_t)(stuffed + (stuffed - 1U) / 4U + 13U);
+}
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+CANARD_INTERNAL uint16_t busLoadPermille(uint64_t bits, uint64_t capacity)
+{
+    if (capacity == 0)
+    {
+        return 0;
+    }
+    const uint64_t permille = bits / capacity;
+    return (permille > UINT16_MAX) ? UINT16_MAX : (uint16_t) permille;
+}
+#endif
+
+/**
+ * Counts a frame passed to the RX path, and the error it was rejected with, if any
+ */
+CANARD_INTERNAL void updateRxStatistics(CanardInstance* ins, const CanardCANFrame* frame, int16_t result)
+{
+    ins->statistics.rx_frames++;
+    ins->statistics.rx_bits += frameWireBits(frame);
+    if (result < 0 && -result < CANARD_NUM_RX_ERROR_CODES)
+    {
+        ins->statistics.rx_errors[-result]++;
+    }
+}
+
+/**
+ * Counts the outcome of queueing a transfer; a positive result is the number of frames queued
+ */
+CANARD_INTERNAL void updateTxStatistics(CanardInstance* ins, int16_t result)
+{
+    if (result < 0)
+    {
+        ins->statistics.tx_errors++;
+    }
+    else
+    {
+        ins->statistics.tx_transfers++;
+        ins->statistics.tx_frames_queued += (uint32_t)result;
+    }
+}
+
+#if CANARD_TX_TRANSFER_ID_SLOTS > 0
+/**
+ * Returns the transfer ID kept for the transfer descriptor, taking a free slot or the least recently used one for it
+ * if it has none yet, or NULL if all slots are in use
+ */
+CANARD_INTERNAL uint8_t* txTransferIdSlot(CanardInstance* ins, uint32_t transfer_descriptor)
+{
+    // Broadcasts and requests have a non-zero transfer type, so a zero key marks a free slot
+    CANARD_ASSERT(transfer_descriptor != 0);
+    // Fibonacci hashing, as for the RX states
+    const uint32_t hash = (uint32_t)(transfer_descriptor * 2654435761UL);
+    uint16_t slot = (uint16_t)(((uint64_t) hash * CANARD_TX_TRANSFER_ID_SLOTS) >> 32U);
+    const uint16_t now = ++ins->tx_transfer_id_clock;
+    uint16_t oldest = slot;
+
+    // Linear probing; slots are reused but never emptied again, so the first free one still ends the search
+    for (uint16_t probes = 0; probes < CANARD_TX_TRANSFER_ID_SLOTS; probes++)
+    {
+        if (ins->tx_transfer_id_keys[slot] == transfer_descriptor)
+        {
+            ins->tx_transfer_id_used[slot] = now;
+            return &ins->tx_transfer_ids[slot];
+        }
+        if (ins->tx_transfer_id_keys[slot] == 0)
+        {
+            break;
+        }
+        if ((uint16_t)(now - ins->tx_transfer_id_used[slot]) > (uint16_t)(now - ins->tx_transfer_id_used[oldest]))
+        {
+            oldest = slot;
+        }
+        slot = (uint16_t)((slot + 1U) & (CANARD_TX_TRANSFER_ID_SLOTS - 1U));
+    }
+
+    if (ins->tx_transfer_id_keys[slot] != 0)
+    {
+        // All slots taken. If the oldest one was used within the last round of lookups, more descriptors than slots
+        // are in use, and taking it would reset the transfer ID of a live one again and again.
+        if ((uint16_t)(now - ins->tx_transfer_id_used[oldest]) <= CANARD_TX_TRANSFER_ID_SLOTS)
+        {
+            return NULL;
+        }
+        slot = oldest;
+    }
+    ins->tx_transfer_id_keys[slot] = transfer_descriptor;
+    ins->tx_transfer_ids[slot] = 0;
+    ins->tx_transfer_id_used[slot] = now;
+    return &ins->tx_transfer_ids[slot];
+}
+#endif
+
+/*
+ *  CanardRxState functions
+ */
+
+/**
+ * Returns the index of the rx_states bucket that holds the given transfer descriptor
+ */
+CANARD_INTERNAL uint16_t rxStateBucket(uint32_t transfer_descriptor)
+{
+    // Fibonacci hashing: the top bits of the product depend on every bit of the descriptor, the low ones do not
+    const uint32_t hash = (uint32_t)(transfer_descriptor * 2654435761UL);
+    return (uint16_t)(((uint64_t) hash * CANARD_RX_STATE_HASH_BUCKETS) >> 32U);
+}
+
+/**
+ * Looks up the CanardRxState of the transfer descriptor in its hash bucket and returns it,
+ * or a new one prepended to the bucket if there is none yet
+ */
+CANARD_INTERNAL CanardRxState* traverseRxStates(CanardInstance* ins, uint32_t transfer_descriptor, uint8_t priority)
+{
+    CanardRxState* state = findRxState(ins, transfer_descriptor);
+    if (state != NULL)
+    {
+        return state;
+    }
+    else if (admitRxBlocks(ins, priority, SOURCE_ID_FROM_TRANSFER_DESCRIPTOR(transfer_descriptor),
+                           CanardPoolConsumerRxState, 1U))
+    {
+        state = prependRxState(ins, transfer_descriptor);
+        if (state != NULL)
+        {
+            chargeNodeBlocks(ins, SOURCE_ID_FROM_TRANSFER_DESCRIPTOR(transfer_descriptor), 1);
+        }
+        return state;
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+/**
+ * returns pointer to the rx state of transfer descriptor or null if not found
+ */
+CANARD_INTERNAL CanardRxState* findRxState(CanardInstance *ins, uint32_t transfer_descriptor)
+{
+    CanardRxState *state = ins->rx_states[rxStateBucket(transfer_descriptor)];
+    while (state != NULL)
+    {
+        if (state->dtid_tt_snid_dnid == transfer_descriptor)
+        {
+            return state;
+        }
+        state = canardRxFromIdx(&ins->allocator, state->next);
+    }
+    return NULL;
+}
+
+/**
+ * prepends rx state to its hash bucket in the canard instance rx_states
+ */
+CANARD_INTERNAL CanardRxState* prependRxState(CanardInstance* ins, uint32_t transfer_descriptor)
 {
     CanardRxState* state = createRxState(&ins->allocator, transfer_descriptor);
 
@@ -1497,20 +2777,272 @@ CANARD_INTERNAL CanardRxState* prependRxState(CanardInstance* ins, uint32_t tran
         return NULL;
     }
 
-    state->next = canardRxToIdx(&ins->allocator, ins->rx_states);
-    ins->rx_states = state;
+    const uint16_t bucket = rxStateBucket(transfer_descriptor);
+    state->next = canardRxToIdx(&ins->allocator, ins->rx_states[bucket]);
+    ins->rx_states[bucket] = state;
+
+    // Not started yet, so it expires before every other state
+    state->expiry_next = rxStateBlockNumber(&ins->allocator, ins->rx_expiry_head);
+    if (ins->rx_expiry_head != NULL)
+    {
+        ins->rx_expiry_head->expiry_prev = rxStateBlockNumber(&ins->allocator, state);
+    }
+    else
+    {
+        ins->rx_expiry_tail = state;
+    }
+    ins->rx_expiry_head = state;
     return state;
 }
 
+/**
+ * Returns the number of pool blocks that hold a multi-frame payload of the given length beyond the state head
+ */
+CANARD_INTERNAL uint16_t rxPayloadBlocks(size_t payload_len)
+{
+    if (payload_len <= CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE)
+    {
+        return 0;
+    }
+    return (uint16_t)((payload_len - CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE + CANARD_BUFFER_BLOCK_DATA_SIZE - 1U) /
+                      CANARD_BUFFER_BLOCK_DATA_SIZE);
+}
+
+/**
+ * Returns the number of pool blocks that appending data_len bytes to the payload of the state will allocate
+ */
+CANARD_INTERNAL uint16_t rxBlocksNeeded(const CanardRxState* state, uint8_t data_len)
+{
+    return (uint16_t)(rxPayloadBlocks((size_t)state->payload_len + data_len) - rxPayloadBlocks(state->payload_len));
+}
+
+/**
+ * Adjusts the number of pool blocks held by the RX transfers of the node; blocks are charged only once the data is
+ * stored, and uncharged when they are released or handed over to a completed transfer
+ */
+CANARD_INTERNAL void chargeNodeBlocks(CanardInstance* ins, uint8_t source_node_id, int16_t delta)
+{
+#if CANARD_ENABLE_NODE_QUOTA
+    CANARD_ASSERT(source_node_id <= CANARD_MAX_NODE_ID);
+    CANARD_ASSERT((int32_t)ins->node_blocks[source_node_id] + delta >= 0);
+    ins->node_blocks[source_node_id] = (uint16_t)(ins->node_blocks[source_node_id] + delta);
+#else
+    (void)ins;
+    (void)source_node_id;
+    (void)delta;
+#endif
+}
+
+/**
+ * Applies the node quota, the pool quota of the consumer and the pool policy to an RX transfer that is about to
+ * allocate block_count blocks. Returns false if the frame must be refused; evicts lower priority partial transfers
+ * first if the policy allows.
+ */
+CANARD_INTERNAL bool admitRxBlocks(CanardInstance* ins, uint8_t priority, uint8_t source_node_id,
+                                   CanardPoolConsumer consumer, uint16_t block_count)
+{
+    if (block_count == 0)
+    {
+        return true;
+    }
+
+#if CANARD_ENABLE_NODE_QUOTA
+    if ((ins->node_block_quota != 0) &&
+        ((uint32_t)ins->node_blocks[source_node_id] + block_count > ins->node_block_quota))
+    {
+        ins->node_throttled[source_node_id]++;
+        ins->statistics.rx_throttled++;
+        return false;
+    }
+#else
+    (void)source_node_id;
+#endif
+
+    const CanardPoolPolicy* const policy = &ins->pool_policy;
+    const uint32_t keep_free = (priority <= policy->reserved_priority) ? 0U : policy->reserved_blocks;
+    const uint32_t wanted = keep_free + block_count;
+
+    for (;;)
+    {
+        const CanardPoolAllocatorStatistics* const stats = &ins->allocator.statistics;
+        const uint16_t free_blocks = (uint16_t)(stats->capacity_blocks - stats->current_usage_blocks);
+        const uint16_t available = poolBlocksAvailable(&ins->allocator, consumer);
+        if (available >= wanted)
+        {
+            return true;
+        }
+
+        // Add up the payload blocks of the partial transfers worse than ours, per priority level, in one pass. They
+        // are of no use to a consumer that is held back by its own quota rather than by the pool.
+        uint16_t evictable[CANARD_TRANSFER_PRIORITY_LOWEST + 1] = {0};
+        uint32_t evictable_total = 0;
+        if (policy->evict_lower_priority &&
+            ((consumer == CanardPoolConsumerRxBuffer) || (available == free_blocks)))
+        {
+            for (CanardRxState* state = ins->rx_expiry_head; state != NULL;
+                 state = rxStateFromBlockNumber(&ins->allocator, state->expiry_next))
+            {
+                if ((state->buffer_blocks != CANARD_BUFFER_IDX_NONE) && (state->priority > priority))
+                {
+                    const uint16_t blocks = rxPayloadBlocks(state->payload_len);
+                    evictable[state->priority] = (uint16_t)(evictable[state->priority] + blocks);
+                    evictable_total += blocks;
+                }
+            }
+        }
+        if ((evictable_total == 0U) || ((uint32_t)available + evictable_total < wanted))
+        {
+            // Evicting everything would still not make room, so evict nothing
+            if (available >= block_count)
+            {
+                ins->statistics.rx_denied++;        // There was room, but not for this priority
+            }
+            else if (free_blocks >= block_count)
+            {
+                ins->allocator.statistics.consumer_refused[consumer]++;
+            }
+            return false;
+        }
+
+        // Worst priorities go first: every level below the cutoff, then the oldest transfers of the cutoff level
+        uint8_t cutoff = CANARD_TRANSFER_PRIORITY_LOWEST;
+        uint32_t room = available;
+        while (room + evictable[cutoff] < wanted)
+        {
+            room += evictable[cutoff];
+            cutoff--;
+        }
+        uint32_t needed_at_cutoff = wanted - room;
+        CanardRxState* state = ins->rx_expiry_head;
+        while (state != NULL)
+        {
+            CanardRxState* const next = rxStateFromBlockNumber(&ins->allocator, state->expiry_next);
+            if ((state->buffer_blocks != CANARD_BUFFER_IDX_NONE) &&
+                ((state->priority > cutoff) || ((state->priority == cutoff) && (needed_at_cutoff > 0U))))
+            {
+                if (state->priority == cutoff)
+                {
+                    needed_at_cutoff -= MIN(needed_at_cutoff, (uint32_t)rxPayloadBlocks(state->payload_len));
+                }
+                // Like running out of memory on it; its remaining frames will be rejected as unexpected
+                releaseStatePayload(ins, state);
+                prepareForNextTransfer(state);
+                ins->statistics.rx_evicted++;
+            }
+            state = next;
+        }
+    }
+}
+
+/**
+ * Records the start of a transfer and moves the state to the tail of the expiry list
+ */
+CANARD_INTERNAL void touchRxState(CanardInstance* ins, CanardRxState* state, uint64_t timestamp_usec)
+{
+    state->timestamp_usec = ((uint32_t)timestamp_usec != 0U) ? (uint32_t)timestamp_usec : 1U;  // Zero means never
+    if (state == ins->rx_expiry_tail)
+    {
+        return;
+    }
+
+    unlinkRxStateExpiry(ins, state);
+    state->expiry_prev = rxStateBlockNumber(&ins->allocator, ins->rx_expiry_tail);
+    state->expiry_next = 0;
+    if (ins->rx_expiry_tail != NULL)
+    {
+        ins->rx_expiry_tail->expiry_next = rxStateBlockNumber(&ins->allocator, state);
+    }
+    else
+    {
+        ins->rx_expiry_head = state;
+    }
+    ins->rx_expiry_tail = state;
+}
+
+CANARD_INTERNAL void unlinkRxStateExpiry(CanardInstance* ins, CanardRxState* state)
+{
+    CanardRxState* const prev = rxStateFromBlockNumber(&ins->allocator, state->expiry_prev);
+    CanardRxState* const next = rxStateFromBlockNumber(&ins->allocator, state->expiry_next);
+
+    if (prev != NULL)
+    {
+        prev->expiry_next = state->expiry_next;
+    }
+    else
+    {
+        ins->rx_expiry_head = next;
+    }
+    if (next != NULL)
+    {
+        next->expiry_prev = state->expiry_prev;
+    }
+    else
+    {
+        ins->rx_expiry_tail = prev;
+    }
+    state->expiry_prev = 0;
+    state->expiry_next = 0;
+}
+
+/**
+ * Unlinks the state from its hash bucket and from the expiry list, and frees it together with its payload
+ */
+CANARD_INTERNAL void removeRxState(CanardInstance* ins, CanardRxState* state)
+{
+    const uint16_t bucket = rxStateBucket(state->dtid_tt_snid_dnid);
+    if (ins->rx_states[bucket] == state)
+    {
+        ins->rx_states[bucket] = canardRxFromIdx(&ins->allocator, state->next);
+    }
+    else
+    {
+        CanardRxState* prev = ins->rx_states[bucket];
+        while (canardRxFromIdx(&ins->allocator, prev->next) != state)
+        {
+            prev = canardRxFromIdx(&ins->allocator, prev->next);
+            CANARD_ASSERT(prev != NULL);
+        }
+        prev->next = state->next;
+    }
+
+    unlinkRxStateExpiry(ins, state);
+    releaseStatePayload(ins, state);
+    chargeNodeBlocks(ins, SOURCE_ID_FROM_TRANSFER_DESCRIPTOR(state->dtid_tt_snid_dnid), -1);
+    freeBlock(&ins->allocator, state, CanardPoolConsumerRxState);
+}
+
+/**
+ * Pool block numbers keep the expiry links of CanardRxState at 16 bits on every platform; zero means none
+ */
+CANARD_INTERNAL uint16_t rxStateBlockNumber(const CanardPoolAllocator* allocator, const CanardRxState* state)
+{
+    if (state == NULL)
+    {
+        return 0;
+    }
+    return (uint16_t)(1U + (size_t)((const uint8_t*)state - (const uint8_t*)allocator->arena) / CANARD_MEM_BLOCK_SIZE);
+}
+
+CANARD_INTERNAL CanardRxState* rxStateFromBlockNumber(const CanardPoolAllocator* allocator, uint16_t number)
+{
+    if (number == 0)
+    {
+        return NULL;
+    }
+    return (CanardRxState*)(void*)&((uint8_t*)allocator->arena)[(size_t)(number - 1U) * CANARD_MEM_BLOCK_SIZE];
+}
+
 CANARD_INTERNAL CanardRxState* createRxState(CanardPoolAllocator* allocator, uint32_t transfer_descriptor)
 {
     CanardRxState init = {
         .next = CANARD_BUFFER_IDX_NONE,
         .buffer_blocks = CANARD_BUFFER_IDX_NONE,
-        .dtid_tt_snid_dnid = transfer_descriptor
+        .dtid_tt_snid_dnid = transfer_descriptor,
+        .expiry_prev = 0,
+        .expiry_next = 0
     };
 
-    CanardRxState* state = (CanardRxState*) allocateBlock(allocator);
+    CanardRxState* state = (CanardRxState*) allocateBlock(allocator, CanardPoolConsumerRxState);
     if (state == NULL)
     {
         return NULL;
@@ -1522,12 +3054,22 @@ CANARD_INTERNAL CanardRxState* createRxState(CanardPoolAllocator* allocator, uin
 
 CANARD_INTERNAL uint64_t releaseStatePayload(CanardInstance* ins, CanardRxState* rxstate)
 {
-    while (rxstate->buffer_blocks != CANARD_BUFFER_IDX_NONE)
+    CanardBufferBlock* const last_block = canardBufferFromIdx(&ins->allocator, rxstate->buffer_blocks);
+    if (last_block != NULL)
     {
-        CanardBufferBlock* block = canardBufferFromIdx(&ins->allocator, rxstate->buffer_blocks);
-        CanardBufferBlock* const temp = block->next;
-        freeBlock(&ins->allocator, block);
-        rxstate->buffer_blocks = canardBufferToIdx(&ins->allocator, temp);
+        chargeNodeBlocks(ins, SOURCE_ID_FROM_TRANSFER_DESCRIPTOR(rxstate->dtid_tt_snid_dnid),
+                         (int16_t)-(int16_t)rxPayloadBlocks(rxstate->payload_len));
+
+        // Open the ring at the last block, then free the chain from the first block onwards
+        CanardBufferBlock* block = last_block->next;
+        last_block->next = NULL;
+        while (block != NULL)
+        {
+            CanardBufferBlock* const temp = block->next;
+            freeBlock(&ins->allocator, block, CanardPoolConsumerRxBuffer);
+            block = temp;
+        }
+        rxstate->buffer_blocks = CANARD_BUFFER_IDX_NONE;
     }
     rxstate->payload_len = 0;
     return CANARD_OK;
@@ -1538,7 +3080,11 @@ CANARD_INTERNAL uint64_t releaseStatePayload(CanardInstance* ins, CanardRxState*
  */
 
 /**
- * pushes data into the rx state. Fills the buffer head, then appends data to buffer blocks
+ * pushes data into the rx state. Fills the buffer head, then appends data to buffer blocks.
+ *
+ * The buffer blocks form a ring: rx_state->buffer_blocks points at the last block, and the next pointer of the
+ * last block points back at the first one. This gives constant time access to both ends of the chain, so appending
+ * a frame does not depend on how many blocks the transfer already occupies.
  */
 CANARD_INTERNAL int16_t bufferBlockPushBytes(CanardPoolAllocator* allocator,
                                              CanardRxState* state,
@@ -1564,54 +3110,25 @@ CANARD_INTERNAL int16_t bufferBlockPushBytes(CanardPoolAllocator* allocator,
         }
     } // head is full.
 
+    // Zero means that the last block is full, or that there are no blocks yet
     uint16_t index_at_nth_block =
-        (uint16_t)(((state->payload_len) - CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE) % CANARD_BUFFER_BLOCK_DATA_SIZE);
-
-    // get to current block
-    CanardBufferBlock* block = NULL;
+        (uint16_t)(((state->payload_len + data_index) - CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE) %
+                   CANARD_BUFFER_BLOCK_DATA_SIZE);
 
-    // buffer blocks uninitialized
-    if (state->buffer_blocks == CANARD_BUFFER_IDX_NONE)
-    {
-        block = createBufferBlock(allocator);
-        state->buffer_blocks = canardBufferToIdx(allocator, block);
-        if (block == NULL)
-        {
-            return -CANARD_ERROR_OUT_OF_MEMORY;
-        }
+    CanardBufferBlock* block = canardBufferFromIdx(allocator, state->buffer_blocks);
 
-        index_at_nth_block = 0;
-    }
-    else
+    // add data to the last block until it becomes full, add new block if necessary
+    while (data_index < data_len)
     {
-        uint16_t nth_block = 1;
-
-        // get to block
-        block = canardBufferFromIdx(allocator, state->buffer_blocks);
-        while (block->next != NULL)
-        {
-            nth_block++;
-            block = block->next;
-        }
-
-        const uint16_t num_buffer_blocks =
-            (uint16_t) (((((uint32_t)state->payload_len + data_len) - CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE) /
-                         CANARD_BUFFER_BLOCK_DATA_SIZE) + 1U);
-
-        if (num_buffer_blocks > nth_block && index_at_nth_block == 0)
+        if (index_at_nth_block == 0)
         {
-            block->next = createBufferBlock(allocator);
-            if (block->next == NULL)
+            block = appendBufferBlock(allocator, state);
+            if (block == NULL)
             {
                 return -CANARD_ERROR_OUT_OF_MEMORY;
             }
-            block = block->next;
         }
-    }
 
-    // add data to current block until it becomes full, add new block if necessary
-    while (data_index < data_len)
-    {
         for (uint16_t i = index_at_nth_block;
              i < CANARD_BUFFER_BLOCK_DATA_SIZE && data_index < data_len;
              i++, data_index++)
@@ -1619,16 +3136,7 @@ CANARD_INTERNAL int16_t bufferBlockPushBytes(CanardPoolAllocator* allocator,
             block->data[i] = data[data_index];
         }
 
-        if (data_index < data_len)
-        {
-            block->next = createBufferBlock(allocator);
-            if (block->next == NULL)
-            {
-                return -CANARD_ERROR_OUT_OF_MEMORY;
-            }
-            block = block->next;
-            index_at_nth_block = 0;
-        }
+        index_at_nth_block = 0;
     }
 
     state->payload_len = (uint16_t)(state->payload_len + data_len) & ((1U << CANARD_TRANSFER_PAYLOAD_LEN_BITS) - 1U);
@@ -1636,9 +3144,34 @@ CANARD_INTERNAL int16_t bufferBlockPushBytes(CanardPoolAllocator* allocator,
     return 1;
 }
 
+/**
+ * Allocates a buffer block and links it into the ring of the rx state as the new last block
+ */
+CANARD_INTERNAL CanardBufferBlock* appendBufferBlock(CanardPoolAllocator* allocator, CanardRxState* state)
+{
+    CanardBufferBlock* const block = createBufferBlock(allocator);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    CanardBufferBlock* const last_block = canardBufferFromIdx(allocator, state->buffer_blocks);
+    if (last_block == NULL)
+    {
+        block->next = block;
+    }
+    else
+    {
+        block->next = last_block->next;
+        last_block->next = block;
+    }
+    state->buffer_blocks = canardBufferToIdx(allocator, block);
+    return block;
+}
+
 CANARD_INTERNAL CanardBufferBlock* createBufferBlock(CanardPoolAllocator* allocator)
 {
-    CanardBufferBlock* block = (CanardBufferBlock*) allocateBlock(allocator);
+    CanardBufferBlock* block = (CanardBufferBlock*) allocateBlock(allocator, CanardPoolConsumerRxBuffer);
     if (block == NULL)
     {
         return NULL;
@@ -1694,11 +3227,13 @@ void copyBitArray(const uint8_t* src, uint32_t src_offset, uint32_t src_len,
     }
 }
 
-CANARD_INTERNAL int16_t descatterTransferPayload(const CanardRxTransfer* transfer,
+CANARD_INTERNAL int16_t descatterTransferPayload(CanardRxReader* reader,
                                                  uint32_t bit_offset,
                                                  uint8_t bit_length,
                                                  void* output)
 {
+    CANARD_ASSERT(reader != 0);
+    const CanardRxTransfer* const transfer = reader->transfer;
     CANARD_ASSERT(transfer != 0);
 
     if (bit_offset >= transfer->payload_len * 8)
@@ -1737,11 +3272,17 @@ CANARD_INTERNAL int16_t descatterTransferPayload(const CanardRxTransfer* transfe
             remaining_bit_length = (uint8_t)(remaining_bit_length - amount);
         }
 
-        // Reading middle
-        uint32_t remaining_bits = (uint32_t)(transfer->payload_len * 8U - CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE * 8U);
+        // Reading middle, resuming from the reader's block unless the read starts before it
         uint32_t block_bit_offset = CANARD_MULTIFRAME_RX_PAYLOAD_HEAD_SIZE * 8U;
         const CanardBufferBlock* block = transfer->payload_middle;
 
+        if ((reader->block != NULL) && (input_bit_offset >= reader->block_bit_offset))
+        {
+            block = reader->block;
+            block_bit_offset = reader->block_bit_offset;
+        }
+        uint32_t remaining_bits = (uint32_t)(transfer->payload_len * 8U - block_bit_offset);
+
         while ((block != NULL) && (remaining_bit_length > 0))
         {
             CANARD_ASSERT(remaining_bits > 0);
@@ -1763,12 +3304,28 @@ CANARD_INTERNAL int16_t descatterTransferPayload(const CanardRxTransfer* transfe
                 remaining_bit_length = (uint8_t)(remaining_bit_length - amount);
             }
 
+            // Park the reader on the block that holds the next bit; stay on the last block for reads in the tail
+            reader->block = block;
+            reader->block_bit_offset = block_bit_offset;
+            if ((block_end_bit_offset > input_bit_offset) || (block->next == NULL))
+            {
+                break;
+            }
+
             CANARD_ASSERT(block_end_bit_offset > block_bit_offset);
             remaining_bits -= block_end_bit_offset - block_bit_offset;
             block_bit_offset = block_end_bit_offset;
             block = block->next;
         }
 
+        // Bits still missing are in the tail, which starts where the last block ends
+        if ((block != NULL) && (remaining_bit_length > 0))
+        {
+            const uint32_t block_bits = MIN(CANARD_BUFFER_BLOCK_DATA_SIZE * 8, remaining_bits);
+            remaining_bits -= block_bits;
+            block_bit_offset += block_bits;
+        }
+
         CANARD_ASSERT(remaining_bit_length <= remaining_bits);
 
         // Reading tail
@@ -1842,8 +3399,59 @@ CANARD_INTERNAL void swapByteOrder(void* data, unsigned size)
 /*
  * CRC functions
  */
+#if CANARD_CRC_IMPLEMENTATION == CANARD_CRC_TABLE
+static const uint16_t crc_table[256] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+    0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+    0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+    0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+    0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+    0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+    0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+    0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+    0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+    0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+    0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+    0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+    0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+    0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+    0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+    0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+    0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+    0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+    0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+    0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+    0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U,
+};
+#elif CANARD_CRC_IMPLEMENTATION == CANARD_CRC_NIBBLE
+static const uint16_t crc_nibble_table[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+#elif CANARD_CRC_IMPLEMENTATION != CANARD_CRC_BITWISE
+#error "Unknown CANARD_CRC_IMPLEMENTATION"
+#endif
+
 CANARD_INTERNAL uint16_t crcAddByte(uint16_t crc_val, uint8_t byte)
 {
+#if CANARD_CRC_IMPLEMENTATION == CANARD_CRC_TABLE
+    return (uint16_t) ((uint16_t) (crc_val << 8U) ^ crc_table[(uint8_t) ((crc_val >> 8U) ^ byte)]);
+#elif CANARD_CRC_IMPLEMENTATION == CANARD_CRC_NIBBLE
+    crc_val = (uint16_t) ((uint16_t) (crc_val << 4U) ^ crc_nibble_table[((crc_val >> 12U) ^ (byte >> 4U)) & 0x0FU]);
+    crc_val = (uint16_t) ((uint16_t) (crc_val << 4U) ^ crc_nibble_table[((crc_val >> 12U) ^ byte) & 0x0FU]);
+    return crc_val;
+#else
     crc_val ^= (uint16_t) ((uint16_t) (byte) << 8U);
     for (uint8_t j = 0; j < 8; j++)
     {
@@ -1857,6 +3465,7 @@ CANARD_INTERNAL uint16_t crcAddByte(uint16_t crc_val, uint8_t byte)
         }
     }
     return crc_val;
+#endif
 }
 
 CANARD_INTERNAL uint16_t crcAddSignature(uint16_t crc_val, uint64_t data_type_signature)
@@ -1877,6 +3486,26 @@ CANARD_INTERNAL uint16_t crcAdd(uint16_t crc_val, const uint8_t* bytes, size_t l
     return crc_val;
 }
 
+CANARD_INTERNAL uint16_t crcSignatureSeed(CanardInstance* ins, uint64_t data_type_signature)
+{
+#if CANARD_SIGNATURE_CRC_CACHE_SIZE > 0
+    // Signatures are hashes themselves, so folding them is enough to pick a slot
+    const uint32_t slot = ((uint32_t) data_type_signature ^ (uint32_t) (data_type_signature >> 32U)) &
+                          (CANARD_SIGNATURE_CRC_CACHE_SIZE - 1U);
+    CanardSignatureCrc* const entry = &ins->signature_crc_cache[slot];
+
+    if ((entry->data_type_signature != data_type_signature) || (data_type_signature == 0))
+    {
+        entry->crc = crcAddSignature(0xFFFFU, data_type_signature);
+        entry->data_type_signature = data_type_signature;
+    }
+    return entry->crc;
+#else
+    (void)ins;
+    return crcAddSignature(0xFFFFU, data_type_signature);
+#endif
+}
+
 /*
  *  Pool Allocator functions
  */
@@ -1896,22 +3525,28 @@ CANARD_INTERNAL void initPoolAllocator(CanardPoolAllocator* allocator,
     }
     *current_block = NULL;
 
+    memset(&allocator->statistics, 0, sizeof(allocator->statistics));
+    memset(allocator->quota_blocks, 0, sizeof(allocator->quota_blocks));
     allocator->statistics.capacity_blocks = buf_len;
-    allocator->statistics.current_usage_blocks = 0;
-    allocator->statistics.peak_usage_blocks = 0;
     // user should initialize semaphore after the canardInit
     // or at first call of canard_allocate_sem_take
     allocator->semaphore = NULL;
 }
 
-CANARD_INTERNAL void* allocateBlock(CanardPoolAllocator* allocator)
+CANARD_INTERNAL void* allocateBlock(CanardPoolAllocator* allocator, CanardPoolConsumer consumer)
 {
 #if CANARD_ALLOCATE_SEM
     canard_allocate_sem_take(allocator);
 #endif
-    // Check if there are any blocks available in the free list.
-    if (allocator->free_list == NULL)
+    // Check if there are any blocks available in the free list, and whether the consumer may take one.
+    if ((allocator->free_list == NULL) ||
+        ((allocator->quota_blocks[consumer] != 0) &&
+         (allocator->statistics.consumer_usage_blocks[consumer] >= allocator->quota_blocks[consumer])))
     {
+        if (allocator->free_list != NULL)
+        {
+            allocator->statistics.consumer_refused[consumer]++;
+        }
 #if CANARD_ALLOCATE_SEM
         canard_allocate_sem_give(allocator);
 #endif
@@ -1928,13 +3563,18 @@ CANARD_INTERNAL void* allocateBlock(CanardPoolAllocator* allocator)
     {
         allocator->statistics.peak_usage_blocks = allocator->statistics.current_usage_blocks;
     }
+    allocator->statistics.consumer_usage_blocks[consumer]++;
+    if (allocator->statistics.consumer_peak_blocks[consumer] < allocator->statistics.consumer_usage_blocks[consumer])
+    {
+        allocator->statistics.consumer_peak_blocks[consumer] = allocator->statistics.consumer_usage_blocks[consumer];
+    }
 #if CANARD_ALLOCATE_SEM
     canard_allocate_sem_give(allocator);
 #endif
     return result;
 }
 
-CANARD_INTERNAL void freeBlock(CanardPoolAllocator* allocator, void* p)
+CANARD_INTERNAL void freeBlock(CanardPoolAllocator* allocator, void* p, CanardPoolConsumer consumer)
 {
 #if CANARD_ALLOCATE_SEM
     canard_allocate_sem_take(allocator);
@@ -1945,8 +3585,26 @@ CANARD_INTERNAL void freeBlock(CanardPoolAllocator* allocator, void* p)
     allocator->free_list = block;
 
     CANARD_ASSERT(allocator->statistics.current_usage_blocks > 0);
+    CANARD_ASSERT(allocator->statistics.consumer_usage_blocks[consumer] > 0);
     allocator->statistics.current_usage_blocks--;
+    allocator->statistics.consumer_usage_blocks[consumer]--;
 #if CANARD_ALLOCATE_SEM
     canard_allocate_sem_give(allocator);
 #endif
 }
+
+/**
+ * Returns the number of blocks the consumer can still allocate, limited by both the pool and its quota
+ */
+CANARD_INTERNAL uint16_t poolBlocksAvailable(const CanardPoolAllocator* allocator, CanardPoolConsumer consumer)
+{
+    const CanardPoolAllocatorStatistics* const stats = &allocator->statistics;
+    uint16_t available = (uint16_t)(stats->capacity_blocks - stats->current_usage_blocks);
+    if (allocator->quota_blocks[consumer] != 0)
+    {
+        const uint16_t quota_left = (stats->consumer_usage_blocks[consumer] < allocator->quota_blocks[consumer]) ?
+            (uint16_t)(allocator->quota_blocks[consumer] - stats->consumer_usage_blocks[consumer]) : 0U;
+        available = MIN(available, quota_left);
+    }
+    return available;
+}
@@ -54,6 +54,15 @@ extern "C" {
 #define CANARD_MULTI_IFACE                          0
 #endif
 
+/// Number of interfaces, each with its own TX queue, see canardPeekTxQueueIface(). Up to 8.
+#ifndef CANARD_NUM_IFACES
+#if CANARD_MULTI_IFACE
+#define CANARD_NUM_IFACES                           2U
+#else
+#define CANARD_NUM_IFACES                           1U
+#endif
+#endif
+
 #ifndef CANARD_ENABLE_DEADLINE
 #define CANARD_ENABLE_DEADLINE                      0
 #endif
@@ -89,6 +98,15 @@ extern "C" {
 # endif
 #endif
 
+/// Transfer CRC (CRC-16-CCITT) implementations, selected with CANARD_CRC_IMPLEMENTATION. All produce identical output.
+#define CANARD_CRC_BITWISE                          0   ///< Bit by bit, smallest flash footprint
+#define CANARD_CRC_TABLE                            1   ///< 256-entry lookup table (512 bytes of flash), fastest
+#define CANARD_CRC_NIBBLE                           2   ///< 16-entry lookup table (32 bytes of flash)
+
+#ifndef CANARD_CRC_IMPLEMENTATION
+#define CANARD_CRC_IMPLEMENTATION                   CANARD_CRC_TABLE
+#endif
+
 #ifndef CANARD_ALLOCATE_SEM
 #define CANARD_ALLOCATE_SEM 0
 #endif
@@ -108,9 +126,15 @@ extern "C" {
 #define CANARD_ERROR_RX_SHORT_FRAME                    16
 #define CANARD_ERROR_RX_BAD_CRC                        17
 
+/// Size of CanardInstanceStatistics.rx_errors, which is indexed by the error code.
+#define CANARD_NUM_RX_ERROR_CODES                      (CANARD_ERROR_RX_BAD_CRC + 1)
+
 /// The size of a memory block in bytes.
 #if CANARD_ENABLE_CANFD
 #define CANARD_MEM_BLOCK_SIZE                       128U
+#elif CANARD_ENABLE_DEADLINE && (UINTPTR_MAX > 0xFFFFFFFFU)
+/// 64-bit pointers leave no padding in CanardTxQueueItem for its coalescing fields
+#define CANARD_MEM_BLOCK_SIZE                       48U
 #elif CANARD_ENABLE_DEADLINE
 #define CANARD_MEM_BLOCK_SIZE                       40U
 #else
@@ -133,6 +157,42 @@ extern "C" {
 /// Refer to the type CanardBufferBlock
 #define CANARD_BUFFER_BLOCK_DATA_SIZE               (CANARD_MEM_BLOCK_SIZE - offsetof(CanardBufferBlock, data))
 
+/// Number of hash buckets used to index RX transfer states by transfer descriptor. Must be a power of two.
+/// Each bucket costs one pointer of RAM in CanardInstance; use 1 to get the plain linked list back.
+#ifndef CANARD_RX_STATE_HASH_BUCKETS
+#define CANARD_RX_STATE_HASH_BUCKETS                32U
+#endif
+
+/// Number of data type signature CRC seeds cached in CanardInstance. Must be a power of two; 0 disables the cache.
+#ifndef CANARD_SIGNATURE_CRC_CACHE_SIZE
+#define CANARD_SIGNATURE_CRC_CACHE_SIZE             8U
+#endif
+
+/// Number of transfer IDs kept in CanardInstance for canardBroadcastAuto() and canardRequestAuto(), one per
+/// (data type ID, transfer type, destination) in use. Must be a power of two; 0 disables them. Costs 7 bytes each.
+#ifndef CANARD_TX_TRANSFER_ID_SLOTS
+#define CANARD_TX_TRANSFER_ID_SLOTS                 16U
+#endif
+
+/// The bus load estimate covers this many buckets of CANARD_BUS_LOAD_BUCKET_USEC, see canardUpdateBusLoad().
+/// 0 disables the estimate; the on-wire bit counters in CanardInstanceStatistics are kept regardless.
+#ifndef CANARD_BUS_LOAD_BUCKETS
+#define CANARD_BUS_LOAD_BUCKETS                     8U
+#endif
+
+#ifndef CANARD_BUS_LOAD_BUCKET_USEC
+#define CANARD_BUS_LOAD_BUCKET_USEC                 125000U
+#endif
+
+/// Nominal bit rate assumed by canardInit(), the DroneCAN default. Refer to canardSetBusBitRate().
+#define CANARD_DEFAULT_BUS_BIT_RATE                 1000000UL
+
+/// Track the pool blocks held by the RX transfers of each source node, so that canardSetNodeBlockQuota() can cap them.
+/// Costs four bytes of RAM per node ID in CanardInstance.
+#ifndef CANARD_ENABLE_NODE_QUOTA
+#define CANARD_ENABLE_NODE_QUOTA                    0
+#endif
+
 /// Refer to canardCleanupStaleTransfers() for details.
 #define CANARD_RECOMMENDED_STALE_TRANSFER_CLEANUP_INTERVAL_USEC     1000000U
 
@@ -261,22 +321,59 @@ typedef struct {
     bool canfd; ///< True if CAN FD is enabled
 #endif
 #if CANARD_ENABLE_DEADLINE
-    uint64_t deadline_usec; ///< Deadline in microseconds
+    uint64_t deadline_usec; ///< Deadline in microseconds; zero, the default, means none
 #endif
 #if CANARD_MULTI_IFACE
-    uint8_t iface_mask; ///< Bitmask of interfaces to send the transfer on
+    uint8_t iface_mask; ///< Bitmask of interfaces to send the transfer on, at least one
 #endif
 #if CANARD_ENABLE_TAO_OPTION
     bool tao; ///< True if tail array optimization is enabled
 #endif
+    bool coalesce; ///< Broadcast only: replace the queued transfer of this type and key if none of it was sent yet
+    uint8_t coalesce_key; ///< Tells instances of one message type apart when coalescing, e.g. battery_id
 } CanardTxTransfer;
 
 struct CanardTxQueueItem
 {
     CanardTxQueueItem* next;
+    bool coalesce;          ///< Copied from CanardTxTransfer::coalesce; in the padding in front of the frame
+    uint8_t coalesce_key;   ///< Copied from CanardTxTransfer::coalesce_key
     CanardCANFrame frame;
 };
 CANARD_STATIC_ASSERT(sizeof(CanardTxQueueItem) <= CANARD_MEM_BLOCK_SIZE, "Unexpected memory block size");
+
+/**
+ * TX frames of one interface awaiting transmission, in arbitration order.
+ */
+typedef struct
+{
+    CanardTxQueueItem* head;                ///< Frame to transmit next
+    CanardTxQueueItem* level_tails[CANARD_TRANSFER_PRIORITY_LOWEST + 1]; ///< Last queued frame of each priority
+    uint32_t levels;                        ///< Bit N is set if a frame of priority N is queued
+    uint16_t blocks;                        ///< Number of queued frames, each taking one pool block
+} CanardTxQueue;
+
+/**
+ * A transfer being encoded straight into pool blocks, see canardTxStreamBegin().
+ * All fields are internal, except that transfer.coalesce_key may be changed until the stream is committed.
+ */
+typedef struct
+{
+    CanardInstance* ins;                    ///< Instance the transfer is queued on
+    CanardTxTransfer transfer;              ///< Copy of the transfer given to canardTxStreamBegin(), without payload
+    uint32_t can_id;                        ///< CAN ID of the frames, without the flags
+    CanardTxQueueItem* first;               ///< First frame of the transfer, NULL once committed or failed
+    CanardTxQueueItem* last;                ///< Frame being filled
+    uint16_t payload_len;                   ///< Payload bytes written so far
+    uint16_t frame_count;                   ///< Frames taken from the pool so far
+    uint16_t crc;                           ///< Transfer CRC over the finished frames
+    int16_t error;                          ///< First error, returned by canardTxStreamCommit()
+    uint8_t frame_fill;                     ///< Bytes in the frame being filled, before its tail byte
+    uint8_t toggle;                         ///< Toggle bit of the frame being filled
+    uint8_t bit_count;                      ///< Bits waiting in bit_buffer for the next byte
+    uint8_t bit_buffer;                     ///< Partial byte written by canardTxStreamEncodeScalar()
+} CanardTxStream;
+
 /**
  * The application must implement this function and supply a pointer to it to the library during initialization.
  * The library calls this function to determine whether the transfer should be received.
@@ -301,6 +398,18 @@ typedef bool (* CanardShouldAcceptTransfer)(const CanardInstance* ins,
 typedef void (* CanardOnTransferReception)(CanardInstance* ins,                 ///< Library instance
                                            CanardRxTransfer* transfer);         ///< Ptr to temporary transfer object
 
+/**
+ * Declares a transfer the application wants to receive, together with the function that handles it.
+ * Refer to canardSetSubscriptions().
+ */
+typedef struct
+{
+    uint16_t data_type_id;                          ///< 0 to 255 for services, 0 to 65535 for messages
+    CanardTransferType transfer_type;               ///< Broadcast for messages, Request or Response for services
+    uint64_t data_type_signature;                   ///< Signature of the message/service
+    CanardOnTransferReception handler;              ///< Invoked when a transfer of this type has been received
+} CanardSubscription;
+
 /**
  * INTERNAL DEFINITION, DO NOT USE DIRECTLY.
  * A memory block used in the memory block allocator.
@@ -311,6 +420,19 @@ typedef union CanardPoolAllocatorBlock_u
     union CanardPoolAllocatorBlock_u* next;
 } CanardPoolAllocatorBlock;
 
+/**
+ * The parts of the library that take blocks from the memory pool, each of which can be given a quota with
+ * canardSetPoolQuota().
+ */
+typedef enum
+{
+    CanardPoolConsumerRxState   = 0,        ///< One block per RX transfer descriptor being tracked
+    CanardPoolConsumerRxBuffer  = 1,        ///< Payload blocks of multi-frame transfers being received
+    CanardPoolConsumerTxItem    = 2         ///< One block per frame in the TX queue
+} CanardPoolConsumer;
+
+#define CANARD_NUM_POOL_CONSUMERS                   3U
+
 /**
  * This structure provides usage statistics of the memory pool allocator.
  * This data helps to evaluate whether the allocated memory is sufficient for the application.
@@ -320,8 +442,72 @@ typedef struct
     uint16_t capacity_blocks;               ///< Pool capacity in number of blocks
     uint16_t current_usage_blocks;          ///< Number of blocks that are currently allocated by the library
     uint16_t peak_usage_blocks;             ///< Maximum number of blocks used since initialization
+    uint16_t consumer_usage_blocks[CANARD_NUM_POOL_CONSUMERS];  ///< Blocks held, indexed by CanardPoolConsumer
+    uint16_t consumer_peak_blocks[CANARD_NUM_POOL_CONSUMERS];   ///< Maximum of the above since initialization
+    uint16_t consumer_refused[CANARD_NUM_POOL_CONSUMERS];       ///< Allocations refused by the consumer's quota;
+                                                                ///< a refused multi-frame TX transfer counts once
 } CanardPoolAllocatorStatistics;
 
+/**
+ * Decides which RX transfers may take blocks from the memory pool when it runs low, see canardSetPoolPolicy().
+ * Priorities follow the CANARD_TRANSFER_PRIORITY_* convention: lower values are more important.
+ * The zero-initialized policy admits every transfer while blocks last and never evicts, like the library always did.
+ */
+typedef struct
+{
+    uint16_t reserved_blocks;               ///< Free blocks that only transfers of reserved_priority or better may take
+    uint8_t reserved_priority;              ///< Lowest priority that may use the reserved blocks
+    bool evict_lower_priority;              ///< Drop a lower priority partial RX transfer to make room if needed
+} CanardPoolPolicy;
+
+/**
+ * This structure holds the transport counters of a library instance.
+ * All counters start at zero in canardInit() and wrap around on overflow.
+ */
+typedef struct
+{
+    uint32_t tx_transfers;                  ///< Transfers queued by the broadcast and request/respond functions
+    uint32_t tx_errors;                     ///< Transfers that could not be queued, e.g. for lack of memory
+    uint32_t tx_frames_queued;              ///< Frames added to the TX queue
+    uint32_t tx_frames;                     ///< Frames taken off the TX queue with canardPopTxQueue()
+    uint32_t tx_coalesced;                  ///< Queued transfers replaced by a newer one before they were started
+#if CANARD_ENABLE_DEADLINE
+    uint32_t tx_expired;                    ///< Queued transfers dropped because their deadline passed before they were started
+#endif
+    uint32_t tx_bits;                       ///< Worst case on-wire bits of the frames counted by tx_frames
+#if CANARD_MULTI_IFACE
+    uint32_t tx_iface_refused[CANARD_NUM_IFACES]; ///< Transfers left out of an interface's full TX queue
+#endif
+    uint32_t rx_frames;                     ///< Frames passed to canardHandleRxFrame() or canardHandleRxFrames()
+    uint32_t rx_bits;                       ///< Worst case on-wire bits of the frames counted by rx_frames
+    uint32_t rx_transfers;                  ///< Transfers handed to the application
+    uint32_t rx_errors[CANARD_NUM_RX_ERROR_CODES]; ///< Frames that were rejected, indexed by the returned error code
+    uint32_t rx_denied;                     ///< RX frames refused to keep the reserved blocks free
+    uint32_t rx_evicted;                    ///< Partial RX transfers dropped by the pool policy to make room
+    uint32_t rx_throttled;                  ///< RX frames refused because their source node hit its block quota
+    uint32_t cleanup_visited;               ///< RX states and TX frames examined by canardCleanupStaleTransfers()
+    uint32_t cleanup_removed;               ///< RX states and TX frames removed by canardCleanupStaleTransfers()
+} CanardInstanceStatistics;
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+/**
+ * Sliding window over the bit counters of CanardInstanceStatistics, see canardUpdateBusLoad().
+ */
+typedef struct
+{
+    uint32_t bit_rate;                      ///< Nominal bit rate of the bus, bits per second
+    bool started;                           ///< False until the first call to canardUpdateBusLoad()
+    uint8_t bucket;                         ///< Oldest bucket, the next one to be overwritten
+    uint64_t bucket_start_usec;             ///< Start of the bucket being filled
+    uint32_t bucket_tx_mark;                ///< CanardInstanceStatistics::tx_bits at bucket_start_usec
+    uint32_t bucket_rx_mark;                ///< CanardInstanceStatistics::rx_bits at bucket_start_usec
+    uint32_t tx_bits[CANARD_BUS_LOAD_BUCKETS]; ///< Bits sent in each of the last completed buckets
+    uint32_t rx_bits[CANARD_BUS_LOAD_BUCKETS]; ///< Bits received in each of the last completed buckets
+    uint16_t load_permille;                 ///< See canardGetBusLoad()
+    uint16_t tx_load_permille;              ///< See canardGetTxBusLoad()
+} CanardBusLoad;
+#endif
+
 /**
  * INTERNAL DEFINITION, DO NOT USE DIRECTLY.
  * Buffer block for received data.
@@ -342,10 +528,21 @@ typedef struct
     void *semaphore;
     CanardPoolAllocatorBlock* free_list;
     CanardPoolAllocatorStatistics statistics;
+    uint16_t quota_blocks[CANARD_NUM_POOL_CONSUMERS];   ///< Blocks each consumer may hold, zero if unlimited
     void *arena;
 } CanardPoolAllocator;
 
 
+/**
+ * INTERNAL DEFINITION, DO NOT USE DIRECTLY.
+ * Transfer CRC state after hashing a data type signature, refer to CANARD_SIGNATURE_CRC_CACHE_SIZE.
+ */
+typedef struct
+{
+    uint64_t data_type_signature;                   ///< Zero if the entry is empty
+    uint16_t crc;
+} CanardSignatureCrc;
+
 /**
  * INTERNAL DEFINITION, DO NOT USE DIRECTLY.
  */
@@ -354,7 +551,9 @@ struct CanardRxState
     canard_buffer_idx_t next;
     canard_buffer_idx_t buffer_blocks;
 
-    uint64_t timestamp_usec;
+    // Low 32 bits of the time of the last start of transfer, zero until the first one; states are dropped long
+    // before this wraps around
+    uint32_t timestamp_usec;
 
     const uint32_t dtid_tt_snid_dnid;
 
@@ -365,7 +564,10 @@ struct CanardRxState
     unsigned next_toggle    : 1;    // 16+10+5+1 = 32, aligned.
 
     uint16_t payload_crc;
-    uint8_t  iface_id;
+    uint16_t expiry_prev;           // Neighbours in the expiry list of the instance, as pool block numbers
+    uint16_t expiry_next;
+    uint8_t  iface_id : 3;          // Up to 8 interfaces, like the iface_mask of CanardCANFrame
+    uint8_t  priority : 5;          // Of the transfer being received, for the pool policy
     uint8_t buffer_head[];
 };
 CANARD_STATIC_ASSERT(offsetof(CanardRxState, buffer_head) <= 27, "Invalid memory layout");
@@ -382,18 +584,64 @@ struct CanardInstance
     CanardShouldAcceptTransfer should_accept;       ///< Function to decide whether the application wants this transfer
     CanardOnTransferReception on_reception;         ///< Function the library calls after RX transfer is complete
 
+    const CanardSubscription* subscriptions;        ///< Sorted subscription table, see canardSetSubscriptions()
+    uint16_t subscription_count;                    ///< Number of entries in the above
+
+    uint8_t* rx_payload_arena;                      ///< Buffer for contiguous RX payloads, see canardSetRxPayloadArena()
+    uint16_t rx_payload_arena_size;                 ///< Size of the above, in bytes
+
     CanardPoolAllocator allocator;                  ///< Pool allocator
+    CanardPoolPolicy pool_policy;                   ///< RX admission policy, see canardSetPoolPolicy()
+#if CANARD_ENABLE_NODE_QUOTA
+    uint16_t node_block_quota;                      ///< Blocks each source node may hold, zero if unlimited
+    uint16_t node_blocks[CANARD_MAX_NODE_ID + 1];   ///< Blocks held by the RX transfers of each source node
+    uint16_t node_throttled[CANARD_MAX_NODE_ID + 1]; ///< Frames of each source node refused by the quota
+#endif
 
-    CanardRxState* rx_states;                       ///< RX transfer states
-    CanardTxQueueItem* tx_queue;                    ///< TX frames awaiting transmission
+    CanardRxState* rx_states[CANARD_RX_STATE_HASH_BUCKETS]; ///< RX transfer states, chained per descriptor hash
+    CanardRxState* rx_expiry_head;                  ///< RX transfer states, least recently started first
+    CanardRxState* rx_expiry_tail;                  ///< Most recently started RX transfer state
+    CanardTxQueue tx_queues[CANARD_NUM_IFACES];     ///< TX frames awaiting transmission, one queue per interface
+#if CANARD_MULTI_IFACE
+    uint16_t tx_queue_quota;                        ///< Blocks each TX queue may hold, see canardSetTxQueueQuota()
+#endif
+#if CANARD_ENABLE_DEADLINE
+    uint64_t tx_deadline_usec;                      ///< No unstarted TX transfer expires before this
+#endif
 
     void* user_reference;                           ///< User pointer that can link this instance with other objects
 
+    CanardInstanceStatistics statistics;            ///< Transport counters, see canardGetStatistics()
+#if CANARD_BUS_LOAD_BUCKETS > 0
+    CanardBusLoad bus_load;                         ///< Bus load estimate, see canardUpdateBusLoad()
+#endif
+
+#if CANARD_SIGNATURE_CRC_CACHE_SIZE > 0
+    CanardSignatureCrc signature_crc_cache[CANARD_SIGNATURE_CRC_CACHE_SIZE]; ///< Seeded CRCs of recently used signatures
+#endif
+
+#if CANARD_TX_TRANSFER_ID_SLOTS > 0
+    uint32_t tx_transfer_id_keys[CANARD_TX_TRANSFER_ID_SLOTS]; ///< Transfer descriptor owning each slot, zero if free
+    uint8_t tx_transfer_ids[CANARD_TX_TRANSFER_ID_SLOTS];      ///< Next transfer ID of each slot
+    uint16_t tx_transfer_id_used[CANARD_TX_TRANSFER_ID_SLOTS]; ///< tx_transfer_id_clock when each slot was last used
+    uint16_t tx_transfer_id_clock;                             ///< Counts the lookups of the slots
+#endif
+
 #if CANARD_ENABLE_TAO_OPTION
     bool tao_disabled;                              ///< True if TAO is disabled
 #endif
 };
 
+CANARD_STATIC_ASSERT((CANARD_NUM_IFACES > 0) && (CANARD_NUM_IFACES <= 8),
+                     "CANARD_NUM_IFACES must be between 1 and 8");
+CANARD_STATIC_ASSERT((CANARD_RX_STATE_HASH_BUCKETS > 0) &&
+                     ((CANARD_RX_STATE_HASH_BUCKETS & (CANARD_RX_STATE_HASH_BUCKETS - 1U)) == 0),
+                     "CANARD_RX_STATE_HASH_BUCKETS must be a power of two");
+CANARD_STATIC_ASSERT((CANARD_SIGNATURE_CRC_CACHE_SIZE & (CANARD_SIGNATURE_CRC_CACHE_SIZE - 1U)) == 0,
+                     "CANARD_SIGNATURE_CRC_CACHE_SIZE must be zero or a power of two");
+CANARD_STATIC_ASSERT((CANARD_TX_TRANSFER_ID_SLOTS & (CANARD_TX_TRANSFER_ID_SLOTS - 1U)) == 0,
+                     "CANARD_TX_TRANSFER_ID_SLOTS must be zero or a power of two");
+
 /**
  * This structure represents a received transfer for the application.
  * An instance of it is passed to the application via callback when the library receives a new transfer.
@@ -449,8 +697,24 @@ struct CanardRxTransfer
 #if CANARD_ENABLE_CANFD
     bool canfd;                             ///< frame canfd
 #endif
+#if CANARD_MULTI_IFACE
+    uint8_t iface_id;                       ///< Interface the transfer was received from
+#endif
 };
 
+/**
+ * Sequential reader over the payload of a received transfer, see canardReadScalar().
+ * Decoders read fields at increasing offsets, so each read resumes from the block of payload_middle where the
+ * previous one ended instead of walking the list from the start; decoding a whole transfer is then linear in its
+ * length. Reading at a lower offset is still allowed, it just restarts the walk. The transfer itself is not modified.
+ */
+typedef struct
+{
+    const CanardRxTransfer* transfer;       ///< Transfer being read
+    const CanardBufferBlock* block;         ///< Block of payload_middle that the last read reached, or NULL
+    uint32_t block_bit_offset;              ///< Payload offset, in bits, at which block starts
+} CanardRxReader;
+
 /**
  * Initializes a library instance.
  * Local node ID will be set to zero, i.e. the node will be anonymous.
@@ -466,6 +730,88 @@ void canardInit(CanardInstance* out_ins,                    ///< Uninitialized l
                 CanardShouldAcceptTransfer should_accept,   ///< Callback, see CanardShouldAcceptTransfer
                 void* user_reference);                      ///< Optional pointer for user's convenience, can be NULL
 
+/**
+ * Installs a table of subscriptions, replacing the previous one. Pass NULL and zero to remove it.
+ *
+ * Transfers matching an entry are accepted with the signature from the table and delivered to the handler of the
+ * entry, without going through the should_accept and on_reception callbacks. A handler that wants on_reception to
+ * see the transfer as well has to pass it on itself. Transfers that match no entry still fall back to those
+ * callbacks, so they can keep serving types that are not in the table; either callback may be NULL if the table
+ * covers everything the application receives.
+ *
+ * The table is sorted in place so that lookups are a binary search, and must stay valid while it is installed.
+ * Returns -CANARD_ERROR_INVALID_ARGUMENT if the table contains the same data type and transfer type twice or an
+ * entry without a handler; the previous table is kept in that case, and the rejected one is not reordered.
+ */
+int16_t canardSetSubscriptions(CanardInstance* ins,                         ///< Library instance
+                               CanardSubscription* subscriptions,           ///< Table of subscriptions
+                               uint16_t subscription_count);                ///< Number of entries in the table
+
+/**
+ * Sets how RX transfers share the memory pool once it runs low. Refer to the type CanardPoolPolicy.
+ *
+ * While more than reserved_blocks blocks are free, every transfer may allocate. Below that, frames of transfers with a
+ * priority worse than reserved_priority are refused with -CANARD_ERROR_OUT_OF_MEMORY, so that a flood of low priority
+ * traffic cannot starve e.g. actuator commands. If evict_lower_priority is set, a frame that would otherwise be
+ * refused first drops partial RX transfers of worse priority than its own, worst priority and oldest first, until it
+ * fits. If dropping all of them would not make enough room, none is dropped and the frame is refused.
+ * The outcomes are counted in the rx_denied and rx_evicted fields of CanardInstanceStatistics.
+ */
+void canardSetPoolPolicy(CanardInstance* ins,                               ///< Library instance
+                         const CanardPoolPolicy* policy);                   ///< Policy to copy into the instance
+
+#if CANARD_ENABLE_NODE_QUOTA
+/**
+ * Caps the pool blocks that the RX transfers of any single source node may hold at once, counting one block for each
+ * of its transfer states plus their payload blocks. Pass zero to remove the cap.
+ *
+ * Frames that would take a node over its quota are refused with -CANARD_ERROR_OUT_OF_MEMORY, so a node that floods
+ * the bus with new transfers only loses its own traffic. Anonymous transfers share the quota of node ID 0.
+ * Requires CANARD_ENABLE_NODE_QUOTA.
+ */
+void canardSetNodeBlockQuota(CanardInstance* ins,                           ///< Library instance
+                             uint16_t max_blocks);                          ///< Blocks per node, zero if unlimited
+
+/**
+ * Returns the number of frames from the given source node that were refused by the quota since initialization.
+ * The total over all nodes is the rx_throttled field of CanardInstanceStatistics.
+ */
+uint16_t canardGetNodeThrottleCount(const CanardInstance* ins,
+                                    uint8_t node_id);
+#endif
+
+/**
+ * Limits the number of pool blocks one consumer may hold, so that for example a TX backlog while the bus is off
+ * cannot take the blocks needed to receive RestartNode or param.GetSet requests, and an RX flood cannot stop the
+ * node from transmitting. Allocations beyond the quota fail as if the pool were exhausted and are counted in
+ * consumer_refused of CanardPoolAllocatorStatistics. The quotas may add up to more than the pool, in which case
+ * they only cap each consumer. Lowering a quota below the current usage does not free anything; it only refuses
+ * further allocations until the usage drops.
+ *
+ * Returns CANARD_OK, or -CANARD_ERROR_INVALID_ARGUMENT for an unknown consumer.
+ */
+int16_t canardSetPoolQuota(CanardInstance* ins,                             ///< Library instance
+                           CanardPoolConsumer consumer,                     ///< Which part of the library to limit
+                           uint16_t max_blocks);                            ///< Blocks it may hold, zero if unlimited
+
+/**
+ * Installs a buffer that completed multi-frame transfers are reassembled into before they are handed to the
+ * application. Pass NULL and zero to go back to the scattered layout.
+ *
+ * Without this buffer, the payload of a multi-frame transfer stays spread over the RX state head, a list of pool
+ * blocks and the last frame, and every read has to walk at least part of that list. With it, the payload is
+ * copied once into the buffer, the pool blocks are released before the handler runs, and payload_head points at the
+ * whole payload with payload_middle and payload_tail set to NULL, like for a single-frame transfer.
+ *
+ * The buffer is reused for every transfer, so it only needs to hold the largest payload the application decodes;
+ * use the largest generated *_MAX_SIZE constant among the received types. Transfers that do not fit are delivered
+ * in the scattered layout. The buffer must stay valid while it is installed, and its content is only valid until
+ * the handler returns.
+ */
+void canardSetRxPayloadArena(CanardInstance* ins,                           ///< Library instance
+                             void* arena,                                   ///< Buffer for reassembled payloads
+                             uint16_t arena_size);                          ///< Size of the above, in bytes
+
 /**
  * Returns the value of the user pointer.
  * The user pointer is configured once during initialization.
@@ -497,6 +843,16 @@ void canardForgetLocalNodeID(CanardInstance* ins);
 */
 void canardInitTxTransfer(CanardTxTransfer* transfer);
 
+#if CANARD_ENABLE_TAO_OPTION
+/**
+ * Returns the 'tao' argument to pass to the generated *_encode() function of the payload of this transfer.
+ * Receivers decode CAN FD transfers without tail array optimization, and so does an instance with TAO disabled, so the
+ * payload must be encoded the same way or dynamic arrays at its end will be misread.
+ */
+bool canardTxTransferTao(const CanardInstance* ins,
+                         const CanardTxTransfer* transfer);
+#endif
+
 /**
  * Sends a broadcast transfer.
  * If the node is in passive mode, only single frame transfers will be allowed (they will be transmitted as anonymous).
@@ -514,6 +870,11 @@ void canardInitTxTransfer(CanardTxTransfer* transfer);
  * The Transfer ID value cannot be shared between transfers that have different descriptors!
  * More on this in the transport layer specification.
  *
+ * Periodic messages can set CanardTxTransfer::coalesce, so that only the latest sample waits in the TX queue when
+ * the bus cannot keep up: a transfer still queued with the same data type ID, priority and coalescing key, none of
+ * whose frames has been sent yet, is dropped and replaced by the new one. Its transfer ID is skipped,
+ * which receivers handle like a lost transfer.
+ *
  * Returns the number of frames enqueued, or negative error code.
  */
 
@@ -530,7 +891,7 @@ int16_t canardBroadcast(CanardInstance* ins,            ///< Library instance
                         const void* payload,            ///< Transfer payload
                         uint16_t payload_len            ///< Length of the above, in bytes
 #if CANARD_ENABLE_DEADLINE
-                        ,uint64_t tx_deadline           ///< Transmission deadline, microseconds
+                        ,uint64_t tx_deadline           ///< Transmission deadline, microseconds; zero for none
 #endif
 #if CANARD_MULTI_IFACE
                         ,uint8_t iface_mask               ///< Bitmask of interfaces to transmit on
@@ -572,7 +933,7 @@ int16_t canardRequestOrRespond(CanardInstance* ins,             ///< Library ins
                                const void* payload,             ///< Transfer payload
                                uint16_t payload_len             ///< Length of the above, in bytes
 #if CANARD_ENABLE_DEADLINE
-                               ,uint64_t tx_deadline            ///< Transmission deadline, microseconds
+                               ,uint64_t tx_deadline            ///< Transmission deadline, microseconds; zero for none
 #endif
 #if CANARD_MULTI_IFACE
                                ,uint8_t iface_mask               ///< Bitmask of interfaces to transmit on
@@ -581,22 +942,106 @@ int16_t canardRequestOrRespond(CanardInstance* ins,             ///< Library ins
                                 ,bool canfd                     ///< Is the frame canfd
 #endif
                             );
+
+/**
+ * Starts a transfer whose payload is written piece by piece, straight into frames taken from the pool, instead of
+ * being encoded into a buffer first. The CRC and the tail bytes are computed as the frames fill up.
+ * Write the payload with canardTxStreamWrite() and canardTxStreamEncodeScalar(), then queue the transfer with
+ * canardTxStreamCommit() or give the frames back with canardTxStreamAbort().
+ *
+ * 'transfer' is used as for canardBroadcastObj(), or as for canardRequestOrRespondObj() to 'destination_node_id' if
+ * its transfer_type is a request or a response; its payload and payload_len are ignored.
+ * The frames taken by the stream count against the TX pool quota while it is being written.
+ *
+ * Returns CANARD_OK, or negative error code; the error is also returned by canardTxStreamCommit(), so the writes can
+ * go ahead without checking.
+ */
+int16_t canardTxStreamBegin(CanardTxStream* out_stream,             ///< Stream to initialize
+                            CanardInstance* ins,                    ///< Library instance
+                            const CanardTxTransfer* transfer,       ///< Transfer object, copied
+                            uint8_t destination_node_id);           ///< Node ID of the server/client, unused for broadcasts
+
+/**
+ * Appends bytes to the payload of a stream.
+ * On failure, e.g. if the pool runs out, the frames are released and the error is kept for canardTxStreamCommit().
+ */
+void canardTxStreamWrite(CanardTxStream* stream,
+                         const void* data,
+                         uint16_t len);
+
+/**
+ * Appends a scalar value of 'bit_length' bits to the payload of a stream, right after the previous one.
+ * The value is read as with canardEncodeScalar(); a partial byte at the end is padded with zero bits on commit.
+ */
+void canardTxStreamEncodeScalar(CanardTxStream* stream,
+                                uint8_t bit_length,
+                                const void* value);
+
+/**
+ * Finishes the last frame of a stream and queues the transfer, or releases its frames if a write failed.
+ * The transfer ID is updated as with canardBroadcastObj() and canardRequestOrRespondObj().
+ *
+ * Returns the number of frames enqueued, or negative error code.
+ */
+int16_t canardTxStreamCommit(CanardTxStream* stream);
+
+/**
+ * Releases the frames of a stream that is not going to be committed.
+ */
+void canardTxStreamAbort(CanardTxStream* stream);
+
+#if CANARD_TX_TRANSFER_ID_SLOTS > 0
+/**
+ * Same as canardBroadcastObj() and canardRequestOrRespondObj() with a request, except that the transfer ID is kept
+ * by the library, one per data type ID (and destination node ID, for requests); CanardTxTransfer::inout_transfer_id
+ * and CanardTxTransfer::transfer_type are ignored.
+ *
+ * A transfer ID slot is taken by the first transfer of each descriptor. Once all slots are taken, the least recently
+ * used one is handed to the next new descriptor, which starts from transfer ID 0, provided that more transfers than
+ * there are slots were sent this way since the slot was last used. Otherwise more descriptors than
+ * CANARD_TX_TRANSFER_ID_SLOTS are in use at once, and -CANARD_ERROR_OUT_OF_MEMORY is returned rather than resetting the
+ * transfer ID of one of them.
+ *
+ * Returns the number of frames enqueued, or negative error code.
+ */
+int16_t canardBroadcastAuto(CanardInstance* ins,             ///< Library instance
+                            CanardTxTransfer* transfer       ///< Transfer object
+                           );
+
+int16_t canardRequestAuto(CanardInstance* ins,               ///< Library instance
+                          uint8_t destination_node_id,       ///< Node ID of the server
+                          CanardTxTransfer* transfer         ///< Transfer object
+                         );
+#endif
+
 /**
  * Returns a pointer to the top priority frame in the TX queue.
  * Returns NULL if the TX queue is empty.
  * The application will call this function after canardBroadcast() or canardRequestOrRespond() to transmit generated
  * frames over the CAN bus.
+ * With CANARD_MULTI_IFACE, this is the queue of interface 0; refer to canardPeekTxQueueIface().
  */
 CanardCANFrame* canardPeekTxQueue(const CanardInstance* ins);
 
 /**
  * Returns the timeout for the frame on top of TX queue.
- * Returns zero if the TX queue is empty.
+ * Returns zero if the TX queue is empty or the frame has no deadline.
  * The application will call this function after canardPeekTxQueue() to determine when to call canardPopTxQueue(), if
  * the frame is not transmitted.
  */
 #if CANARD_ENABLE_DEADLINE
 uint64_t canardPeekTxQueueDeadline(const CanardInstance* ins);
+
+/**
+ * Same as canardPeekTxQueue(), but first drops the transfers at the top of the TX queue whose deadline has passed, so
+ * that no bus time is spent on data that nobody wants any more. A transfer is dropped with all of its frames at once.
+ * A transfer whose first frame has already been popped is sent to the end even if it expired meanwhile, since its
+ * receivers could do nothing with half of it.
+ * A transfer with a zero deadline never expires.
+ * Dropped transfers are counted in CanardInstanceStatistics::tx_expired.
+ */
+CanardCANFrame* canardPeekTxQueueUnexpired(CanardInstance* ins,
+                                           uint64_t current_time_usec);
 #endif
 /**
  * Removes the top priority frame from the TX queue.
@@ -606,9 +1051,44 @@ uint64_t canardPeekTxQueueDeadline(const CanardInstance* ins);
  */
 void canardPopTxQueue(CanardInstance* ins);
 
+#if CANARD_MULTI_IFACE
+/**
+ * Same as canardPeekTxQueue(), canardPopTxQueue() and canardPeekTxQueueUnexpired(), for the TX queue of the given
+ * interface.
+ * A transfer is queued separately on every interface in CanardTxTransfer::iface_mask, so each interface sends at its
+ * own pace, and a stuck interface backs up its own queue only, up to the quota set with canardSetTxQueueQuota().
+ * CanardCANFrame::iface_mask of a queued frame has the bit of its interface set.
+ */
+CanardCANFrame* canardPeekTxQueueIface(const CanardInstance* ins,
+                                       uint8_t iface);
+
+void canardPopTxQueueIface(CanardInstance* ins,
+                           uint8_t iface);
+
+#if CANARD_ENABLE_DEADLINE
+CanardCANFrame* canardPeekTxQueueIfaceUnexpired(CanardInstance* ins,
+                                                uint8_t iface,
+                                                uint64_t current_time_usec);
+#endif
+
+/**
+ * Limits the pool blocks each TX queue may hold, so that a stuck interface cannot take the memory the others need.
+ * A transfer is left out of a queue that has no room for all of its frames, and still sent on the other interfaces;
+ * this is counted in CanardInstanceStatistics::tx_iface_refused. A transfer that fits in none of its queues fails with
+ * -CANARD_ERROR_OUT_OF_MEMORY.
+ * canardInit() shares the pool evenly between the interfaces; zero means no limit.
+ */
+void canardSetTxQueueQuota(CanardInstance* ins,
+                           uint16_t max_blocks);
+#endif
+
 /**
  * Processes a received CAN frame with a timestamp.
  * The application will call this function when it receives a new frame from the CAN bus.
+ * With CANARD_MULTI_IFACE, CanardCANFrame::iface_id tells the interfaces apart. A transfer sent on redundant
+ * interfaces is taken from the interface the receiver is locked to, and its copies on the others are dropped. Once
+ * that interface has been quiet for 10 ms, the next interface to start a transfer takes over, so a failed interface
+ * costs no more than the transfers of those 10 ms.
  *
  * Return value will report any errors in decoding packets.
  */
@@ -617,9 +1097,28 @@ int16_t canardHandleRxFrame(CanardInstance* ins,
                             uint64_t timestamp_usec);
 
 /**
- * Traverses the list of transfers and removes those that were last updated more than timeout_usec microseconds ago.
+ * Processes a burst of received CAN frames, e.g. a drained RX FIFO, in arrival order.
+ * 'timestamps_usec' holds one timestamp per frame.
+ *
+ * Frames that are not extended data frames, and service frames addressed to another node, are dropped by looking at
+ * the raw CAN ID alone, before any transfer state is looked up. Everything else is handled like canardHandleRxFrame().
+ *
+ * Returns the number of frames that were processed without error.
+ */
+uint16_t canardHandleRxFrames(CanardInstance* ins,
+                              const CanardCANFrame* frames,
+                              uint16_t frame_count,
+                              const uint64_t* timestamps_usec);
+
+/**
+ * Removes the transfers that were last updated more than two seconds ago, and TX frames that missed their deadline.
  * This function must be invoked by the application periodically, about once a second.
  * Also refer to the constant CANARD_RECOMMENDED_STALE_TRANSFER_CLEANUP_INTERVAL_USEC.
+ *
+ * RX transfer states are kept ordered by the time of their last start of transfer, so a call only looks at the states
+ * that expired plus one; TX frames are only scanned once the earliest deadline has passed. Like
+ * canardPeekTxQueueUnexpired(), expired TX transfers are removed whole, and a transfer that is being sent is kept.
+ * The work done is counted in the cleanup_* fields of CanardInstanceStatistics.
  */
 void canardCleanupStaleTransfers(CanardInstance* ins,
                                  uint64_t current_time_usec);
@@ -657,6 +1156,33 @@ int16_t canardDecodeScalar(const CanardRxTransfer* transfer,    ///< The RX tran
                            bool value_is_signed,                ///< True if the value can be negative; see the table
                            void* out_value);                    ///< Pointer to the output storage; see the table
 
+/**
+ * Starts reading the payload of a transfer from its beginning.
+ * The reader stays valid as long as the transfer does, i.e. until the reception callback returns.
+ */
+void canardInitRxReader(CanardRxReader* out_reader,
+                        const CanardRxTransfer* transfer);
+
+/**
+ * Same as canardDecodeScalar(), but resumes the walk over payload_middle where the previous read of the same reader
+ * ended. canardDecodeScalar() walks from the start on every call, so decoders of multi-frame transfers should read
+ * through a reader.
+ */
+int16_t canardReadScalar(CanardRxReader* reader,                ///< Reader initialized with canardInitRxReader()
+                         uint32_t bit_offset,                   ///< Offset, in bits, from the beginning of the transfer
+                         uint8_t bit_length,                    ///< Length of the value, in bits; see the table
+                         bool value_is_signed,                  ///< True if the value can be negative; see the table
+                         void* out_value);                      ///< Pointer to the output storage; see the table
+
+/*
+ * The generated DSDL sources define CANARD_DSDLC_INTERNAL before including their headers, and their decoders must read
+ * through a CanardRxReader. A decoder that calls canardDecodeScalar(), e.g. one regenerated from older dronecan_dsdlc
+ * templates, fails to build here instead of silently walking the block list once per field again.
+ */
+#if defined(CANARD_DSDLC_INTERNAL) && defined(__GNUC__)
+# pragma GCC poison canardDecodeScalar
+#endif
+
 /**
  * This function can be used to encode values for later transmission in a UAVCAN transfer. It encodes a scalar value -
  * boolean, integer, character, or floating point - and puts it to the specified bit position in the specified
@@ -703,6 +1229,45 @@ void canardReleaseRxTransferPayload(CanardInstance* ins,
  */
 CanardPoolAllocatorStatistics canardGetPoolAllocatorStatistics(CanardInstance* ins);
 
+/**
+ * Returns a copy of the transport counters of the instance.
+ * Refer to the type CanardInstanceStatistics.
+ * For example, rx_errors[CANARD_ERROR_RX_BAD_CRC] is the number of transfers that were dropped for a bad CRC.
+ */
+CanardInstanceStatistics canardGetStatistics(const CanardInstance* ins);
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+/**
+ * Sets the nominal bit rate of the bus, which the bus load is relative to. canardInit() assumes
+ * CANARD_DEFAULT_BUS_BIT_RATE.
+ */
+void canardSetBusBitRate(CanardInstance* ins,
+                         uint32_t bit_rate);
+
+/**
+ * Advances the bus load estimate to the current time. Call at least once every CANARD_BUS_LOAD_BUCKET_USEC; the
+ * frames counted since the previous bucket boundary are attributed to the bucket that ends at this call.
+ *
+ * Each frame is counted with its worst case length on the wire: the 29-bit ID, control field, data (including the
+ * tail byte), CRC, ACK, end of frame, interframe space and the maximum number of stuff bits. The estimate therefore
+ * errs high. CAN FD frames are counted as if the data was sent at the nominal bit rate.
+ */
+void canardUpdateBusLoad(CanardInstance* ins,
+                         uint64_t current_time_usec);
+
+/**
+ * Returns the share of the bus taken by the frames this node sent and received over the last
+ * CANARD_BUS_LOAD_BUCKETS buckets, in permille. Frames dropped by hardware acceptance filters are not seen, so this
+ * is a lower bound of the actual bus load. May exceed 1000, since stuff bits are counted for the worst case.
+ */
+uint16_t canardGetBusLoad(const CanardInstance* ins);
+
+/**
+ * Same as canardGetBusLoad(), for the frames this node sent only.
+ */
+uint16_t canardGetTxBusLoad(const CanardInstance* ins);
+#endif
+
 /**
  * Float16 marshaling helpers.
  * These functions convert between the native float and 16-bit float.
@@ -0,0 +1,505 @@
+/*
+ * bxCAN (STM32) support for libcanard: acceptance filters compiled from the subscription table, and a TX
+ * frame ring that the TX interrupt refills the mailboxes from.
+ *
+ * Part of Arduino DroneCAN, distributed under the BSD 3-Clause License; see LICENSE at the root of the
+ * repository.
+ */
+
+#include "canard_bxcan.h"
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_STM32)
+#include <stm32_def.h>
+#endif
+
+
+/*
+ * bxCAN filter register layout (RM0394, 44.7.4), 32-bit scale:
+ *   [31:21] STID[10:0] / EXID[28:18], [20:3] EXID[17:0], [2] IDE, [1] RTR, [0] reserved
+ */
+#define STM32_CAN_RIR_IDE                           (1U << 2U)
+#define STM32_CAN_RIR_RTR                           (1U << 1U)
+
+/*
+ * UAVCAN v0 CAN ID fields used to build the filters, see the ID parsing macros in canard.c.
+ */
+#define FILTER_FRAME_FORMAT_MASK                    (CANARD_CAN_FRAME_EFF | CANARD_CAN_FRAME_RTR)
+#define FILTER_SERVICE_NOT_MSG                      (1UL << 7U)
+#define FILTER_SOURCE_ID_MASK                       0x7FUL
+#define FILTER_DEST_ID_SHIFT                        8U
+#define FILTER_DEST_ID_MASK                         (0x7FUL << FILTER_DEST_ID_SHIFT)
+#define FILTER_REQUEST_NOT_RESPONSE                 (1UL << 15U)
+#define FILTER_MSG_TYPE_ID_SHIFT                    8U
+#define FILTER_MSG_TYPE_ID_MASK                     (0xFFFFUL << FILTER_MSG_TYPE_ID_SHIFT)
+#define FILTER_SRV_TYPE_ID_SHIFT                    16U
+#define FILTER_SRV_TYPE_ID_MASK                     (0xFFUL << FILTER_SRV_TYPE_ID_SHIFT)
+
+#define MAX_MSG_TYPE_ID                             0xFFFFUL
+#define PROBE_SOURCE_NODE_ID                        CANARD_MAX_NODE_ID
+
+#define TX_RING_INDEX_MASK                          (CANARD_BXCAN_TX_RING_SIZE - 1U)
+
+/*
+ * The ring indexes are shared between the main context and the TX interrupt (or two threads in a host simulation).
+ * The acquire/release pair orders the frame copy against the index update on either side.
+ */
+#if defined(__GNUC__)
+#define TX_RING_LOAD_ACQUIRE(x)                     __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define TX_RING_STORE_RELEASE(x, v)                 __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define TX_RING_LOAD_ACQUIRE(x)                     (*(volatile const uint32_t*)&(x))
+#define TX_RING_STORE_RELEASE(x, v)                 (*(volatile uint32_t*)&(x) = (v))
+#endif
+
+
+static uint8_t countOnes(uint32_t x)
+{
+    uint8_t n = 0;
+    while (x != 0)
+    {
+        x &= x - 1U;
+        n++;
+    }
+    return n;
+}
+
+/// Converts a frame ID in libcanard format into the bxCAN receive identifier register layout
+static uint32_t frameIdToRegister(uint32_t can_id)
+{
+    uint32_t out = 0;
+    if ((can_id & CANARD_CAN_FRAME_EFF) != 0)
+    {
+        out = ((can_id & CANARD_CAN_EXT_ID_MASK) << 3U) | STM32_CAN_RIR_IDE;
+    }
+    else
+    {
+        out = (can_id & CANARD_CAN_STD_ID_MASK) << 21U;
+    }
+    if ((can_id & CANARD_CAN_FRAME_RTR) != 0)
+    {
+        out |= STM32_CAN_RIR_RTR;
+    }
+    return out;
+}
+
+/// Converts a filter configuration into the FR1 (identifier) and FR2 (mask) register values
+static void filterToRegisters(const CanardBxCanAcceptanceFilter* cfg, uint32_t* out_fr1, uint32_t* out_fr2)
+{
+    uint32_t id = 0;
+    uint32_t mask = 0;
+    if ((cfg->id & cfg->mask & CANARD_CAN_FRAME_EFF) != 0)
+    {
+        id   = ((cfg->id   & CANARD_CAN_EXT_ID_MASK) << 3U) | STM32_CAN_RIR_IDE;
+        mask = (cfg->mask & CANARD_CAN_EXT_ID_MASK) << 3U;
+    }
+    else
+    {
+        id   = (cfg->id   & CANARD_CAN_STD_ID_MASK) << 21U;
+        mask = (cfg->mask & CANARD_CAN_STD_ID_MASK) << 21U;
+    }
+    if ((cfg->id & CANARD_CAN_FRAME_RTR) != 0)
+    {
+        id |= STM32_CAN_RIR_RTR;
+    }
+    if ((cfg->mask & CANARD_CAN_FRAME_EFF) != 0)
+    {
+        mask |= STM32_CAN_RIR_IDE;
+    }
+    if ((cfg->mask & CANARD_CAN_FRAME_RTR) != 0)
+    {
+        mask |= STM32_CAN_RIR_RTR;
+    }
+    *out_fr1 = id;
+    *out_fr2 = mask;
+}
+
+/// True if every frame accepted by 'b' is also accepted by 'a'
+static bool filterCovers(const CanardBxCanAcceptanceFilter* a,
+                         const CanardBxCanAcceptanceFilter* b)
+{
+    return ((a->mask & ~b->mask) == 0) && (((a->id ^ b->id) & a->mask) == 0);
+}
+
+/// The narrowest single filter that accepts everything accepted by 'a' or 'b'
+static CanardBxCanAcceptanceFilter mergeFilters(const CanardBxCanAcceptanceFilter* a,
+                                                             const CanardBxCanAcceptanceFilter* b)
+{
+    CanardBxCanAcceptanceFilter out;
+    out.mask = a->mask & b->mask & ~(a->id ^ b->id);
+    out.id = a->id & out.mask;
+    return out;
+}
+
+static void removeFilter(CanardBxCanAcceptanceFilter* filters, uint8_t* count, uint8_t index)
+{
+    (*count)--;
+    filters[index] = filters[*count];
+}
+
+/**
+ * Adds the filter to the set unless an existing one already covers it, dropping the existing filters it covers.
+ * Returns false if the set is full.
+ */
+static bool insertFilter(CanardBxCanAcceptanceFilter* filters,
+                         uint8_t* count,
+                         uint8_t max_filters,
+                         CanardBxCanAcceptanceFilter filter)
+{
+    for (uint8_t i = 0; i < *count; i++)
+    {
+        if (filterCovers(&filters[i], &filter))
+        {
+            return true;
+        }
+    }
+
+    uint8_t i = 0;
+    while (i < *count)
+    {
+        if (filterCovers(&filter, &filters[i]))
+        {
+            removeFilter(filters, count, i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    if (*count >= max_filters)
+    {
+        return false;
+    }
+    filters[(*count)++] = filter;
+    return true;
+}
+
+/**
+ * Adds the filter to the set. If the set is full, the pair of filters (including the new one) whose merge keeps the
+ * most significant bits is replaced with the merged filter.
+ */
+static void addFilter(CanardBxCanAcceptanceFilter* filters,
+                      uint8_t* count,
+                      uint8_t max_filters,
+                      CanardBxCanAcceptanceFilter filter)
+{
+    filter.id &= filter.mask;
+    if (insertFilter(filters, count, max_filters, filter))
+    {
+        return;
+    }
+
+    // Index *count stands for the new filter
+    uint8_t best_i = 0;
+    uint8_t best_j = 0;
+    int16_t best_bits = -1;
+    for (uint8_t i = 0; i < *count; i++)
+    {
+        for (uint8_t j = (uint8_t)(i + 1U); j <= *count; j++)
+        {
+            const CanardBxCanAcceptanceFilter merged =
+                mergeFilters(&filters[i], (j == *count) ? &filter : &filters[j]);
+            const int16_t bits = countOnes(merged.mask);
+            if (bits > best_bits)
+            {
+                best_bits = bits;
+                best_i = i;
+                best_j = j;
+            }
+        }
+    }
+
+    if (best_j == *count)
+    {
+        const CanardBxCanAcceptanceFilter merged = mergeFilters(&filters[best_i], &filter);
+        removeFilter(filters, count, best_i);
+        (void) insertFilter(filters, count, max_filters, merged);
+    }
+    else
+    {
+        const CanardBxCanAcceptanceFilter merged = mergeFilters(&filters[best_i], &filters[best_j]);
+        removeFilter(filters, count, best_j);
+        removeFilter(filters, count, best_i);
+        (void) insertFilter(filters, count, max_filters, merged);
+        (void) insertFilter(filters, count, max_filters, filter);
+    }
+}
+
+/**
+ * Adds filters that let through the messages with data type IDs 'first' to 'last', one filter per aligned power of
+ * two block of IDs, so that a long run of accepted IDs costs a handful of filters.
+ */
+static void addMessageRange(CanardBxCanAcceptanceFilter* filters,
+                            uint8_t* count,
+                            uint8_t max_filters,
+                            uint32_t first,
+                            uint32_t last)
+{
+    while (first <= last)
+    {
+        uint32_t block = 1U;
+        while (((first & ((block << 1U) - 1U)) == 0U) && ((first + (block << 1U) - 1U) <= last))
+        {
+            block <<= 1U;
+        }
+        CanardBxCanAcceptanceFilter filter;
+        filter.id = CANARD_CAN_FRAME_EFF | (first << FILTER_MSG_TYPE_ID_SHIFT);
+        filter.mask = FILTER_FRAME_FORMAT_MASK | FILTER_SERVICE_NOT_MSG |
+                      (FILTER_MSG_TYPE_ID_MASK & ~((block - 1U) << FILTER_MSG_TYPE_ID_SHIFT));
+        addFilter(filters, count, max_filters, filter);
+        first += block;
+    }
+}
+
+int16_t canardBxCanCompileAcceptanceFilters(const CanardInstance* ins,
+                                            bool accept_anonymous,
+                                            CanardBxCanAcceptanceFilter* out_filters,
+                                            uint8_t max_filters)
+{
+    CANARD_ASSERT(ins != NULL);
+
+    if (out_filters == NULL || max_filters == 0)
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+
+    const uint32_t node_id = canardGetLocalNodeID(ins);
+    uint8_t count = 0;
+    CanardBxCanAcceptanceFilter filter;
+
+    if (accept_anonymous)
+    {
+        filter.id = CANARD_CAN_FRAME_EFF;
+        filter.mask = FILTER_FRAME_FORMAT_MASK | FILTER_SERVICE_NOT_MSG | FILTER_SOURCE_ID_MASK;
+        addFilter(out_filters, &count, max_filters, filter);
+    }
+
+    if (node_id != CANARD_BROADCAST_NODE_ID && ins->should_accept != NULL)
+    {
+        filter.id = CANARD_CAN_FRAME_EFF | FILTER_SERVICE_NOT_MSG | (node_id << FILTER_DEST_ID_SHIFT);
+        filter.mask = FILTER_FRAME_FORMAT_MASK | FILTER_SERVICE_NOT_MSG | FILTER_DEST_ID_MASK;
+        addFilter(out_filters, &count, max_filters, filter);
+    }
+
+    for (uint16_t i = 0; i < ins->subscription_count; i++)
+    {
+        const CanardSubscription* const sub = &ins->subscriptions[i];
+        if (sub->transfer_type == CanardTransferTypeBroadcast)
+        {
+            filter.id = CANARD_CAN_FRAME_EFF | ((uint32_t) sub->data_type_id << FILTER_MSG_TYPE_ID_SHIFT);
+            filter.mask = FILTER_FRAME_FORMAT_MASK | FILTER_SERVICE_NOT_MSG | FILTER_MSG_TYPE_ID_MASK;
+        }
+        else if (node_id != CANARD_BROADCAST_NODE_ID)
+        {
+            filter.id = CANARD_CAN_FRAME_EFF | FILTER_SERVICE_NOT_MSG | (node_id << FILTER_DEST_ID_SHIFT) |
+                        (((uint32_t) sub->data_type_id << FILTER_SRV_TYPE_ID_SHIFT) & FILTER_SRV_TYPE_ID_MASK);
+            if (sub->transfer_type == CanardTransferTypeRequest)
+            {
+                filter.id |= FILTER_REQUEST_NOT_RESPONSE;
+            }
+            filter.mask = FILTER_FRAME_FORMAT_MASK | FILTER_SERVICE_NOT_MSG | FILTER_DEST_ID_MASK |
+                          FILTER_REQUEST_NOT_RESPONSE | FILTER_SRV_TYPE_ID_MASK;
+        }
+        else
+        {
+            continue;       // Nobody can address services to an anonymous node
+        }
+        addFilter(out_filters, &count, max_filters, filter);
+    }
+
+    if (ins->should_accept != NULL)
+    {
+        // Ask the callback about every message type and let through each run of IDs it accepts
+        uint32_t run_start = 0;
+        bool in_run = false;
+        for (uint32_t data_type_id = 0; data_type_id <= MAX_MSG_TYPE_ID + 1U; data_type_id++)
+        {
+            uint64_t signature = 0;
+            const bool accepted = (data_type_id <= MAX_MSG_TYPE_ID) &&
+                                  ins->should_accept(ins, &signature, (uint16_t) data_type_id,
+                                                     CanardTransferTypeBroadcast, PROBE_SOURCE_NODE_ID);
+            if (accepted && !in_run)
+            {
+                run_start = data_type_id;
+                in_run = true;
+            }
+            else if (!accepted && in_run)
+            {
+                addMessageRange(out_filters, &count, max_filters, run_start, data_type_id - 1U);
+                in_run = false;
+            }
+        }
+    }
+
+    return count;
+}
+
+bool canardBxCanAcceptanceFiltersMatch(const CanardBxCanAcceptanceFilter* filter_configs,
+                                       uint8_t num_filter_configs,
+                                       uint32_t can_id)
+{
+    const uint32_t rir = frameIdToRegister(can_id);
+    for (uint8_t i = 0; i < num_filter_configs; i++)
+    {
+        uint32_t fr1 = 0;
+        uint32_t fr2 = 0;
+        filterToRegisters(&filter_configs[i], &fr1, &fr2);
+        if (((rir ^ fr1) & fr2) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void canardBxCanInitTxRing(CanardBxCanTxRing* ring)
+{
+    CANARD_ASSERT(ring != NULL);
+    memset(ring, 0, sizeof(*ring));
+}
+
+uint16_t canardBxCanFillTxRing(CanardInstance* ins,
+                               CanardBxCanTxRing* ring
+#if CANARD_ENABLE_DEADLINE
+                               ,uint64_t current_time_usec
+#endif
+                               )
+{
+    CANARD_ASSERT(ins != NULL);
+    CANARD_ASSERT(ring != NULL);
+
+    const uint32_t head = ring->head;
+    const uint32_t free_slots = CANARD_BXCAN_TX_RING_SIZE - (head - TX_RING_LOAD_ACQUIRE(ring->tail));
+
+    uint16_t moved = 0;
+    while (moved < free_slots)
+    {
+#if CANARD_ENABLE_DEADLINE
+        const CanardCANFrame* const frame = canardPeekTxQueueUnexpired(ins, current_time_usec);
+#else
+        const CanardCANFrame* const frame = canardPeekTxQueue(ins);
+#endif
+        if (frame == NULL)
+        {
+            break;
+        }
+#if CANARD_ENABLE_CANFD
+        if (frame->canfd)
+        {
+            canardPopTxQueue(ins);
+            ring->dropped++;
+            continue;
+        }
+#endif
+        ring->frames[(head + moved) & TX_RING_INDEX_MASK] = *frame;
+        canardPopTxQueue(ins);
+        moved++;
+    }
+
+    if (moved > 0)
+    {
+        TX_RING_STORE_RELEASE(ring->head, head + moved);
+    }
+    return moved;
+}
+
+const CanardCANFrame* canardBxCanPeekTxRing(const CanardBxCanTxRing* ring)
+{
+    const uint32_t tail = ring->tail;
+    if (TX_RING_LOAD_ACQUIRE(ring->head) == tail)
+    {
+        return NULL;
+    }
+    return &ring->frames[tail & TX_RING_INDEX_MASK];
+}
+
+void canardBxCanPopTxRing(CanardBxCanTxRing* ring)
+{
+    CANARD_ASSERT(TX_RING_LOAD_ACQUIRE(ring->head) != ring->tail);
+    TX_RING_STORE_RELEASE(ring->tail, ring->tail + 1U);
+}
+
+#if defined(ARDUINO_ARCH_STM32) && defined(CAN1)
+void canardBxCanEnableTxInterrupt(void)
+{
+    CAN1->MCR |= CAN_MCR_TXFP;                      // Mailboxes go out in request order, not by identifier
+    CAN1->IER |= CAN_IER_TMEIE;
+    NVIC_EnableIRQ(CAN1_TX_IRQn);
+}
+
+void canardBxCanServiceTxRing(CanardBxCanTxRing* ring)
+{
+    // Clearing the request completed flags acknowledges the interrupt. Only the flags seen set are written back: a
+    // mailbox that completes after the read keeps the interrupt pending, and its status bits stay for whoever loaded it
+    const uint32_t completed = CAN1->TSR & (CAN_TSR_RQCP0 | CAN_TSR_RQCP1 | CAN_TSR_RQCP2);
+    if (completed != 0)
+    {
+        CAN1->TSR = completed;
+    }
+
+    const CanardCANFrame* frame = NULL;
+    while (((CAN1->TSR & CAN_TSR_TME) != 0) && ((frame = canardBxCanPeekTxRing(ring)) != NULL))
+    {
+        // The transmit identifier register has the same layout as the receive one
+        CAN_TxMailBox_TypeDef* const mailbox = &CAN1->sTxMailBox[(CAN1->TSR & CAN_TSR_CODE) >> CAN_TSR_CODE_Pos];
+        mailbox->TIR = frameIdToRegister(frame->id);
+        mailbox->TDTR = frame->data_len & CAN_TDT0R_DLC;
+        mailbox->TDLR = (uint32_t)frame->data[0] | ((uint32_t)frame->data[1] << 8U) |
+                        ((uint32_t)frame->data[2] << 16U) | ((uint32_t)frame->data[3] << 24U);
+        mailbox->TDHR = (uint32_t)frame->data[4] | ((uint32_t)frame->data[5] << 8U) |
+                        ((uint32_t)frame->data[6] << 16U) | ((uint32_t)frame->data[7] << 24U);
+        mailbox->TIR |= CAN_TI0R_TXRQ;
+        canardBxCanPopTxRing(ring);
+    }
+}
+
+void canardBxCanKickTxRing(void)
+{
+    NVIC_SetPendingIRQ(CAN1_TX_IRQn);
+}
+
+void canardBxCanPauseTxRing(void)
+{
+    NVIC_DisableIRQ(CAN1_TX_IRQn);
+    __DSB();
+    __ISB();                                        // The interrupt cannot run once this returns
+}
+
+void canardBxCanResumeTxRing(void)
+{
+    NVIC_EnableIRQ(CAN1_TX_IRQn);
+    NVIC_SetPendingIRQ(CAN1_TX_IRQn);               // Refill the mailboxes that were sent meanwhile
+}
+
+int16_t canardBxCanConfigureAcceptanceFilters(const CanardBxCanAcceptanceFilter* filter_configs,
+                                              uint8_t num_filter_configs)
+{
+    if ((filter_configs == NULL && num_filter_configs > 0) ||
+        num_filter_configs > CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS)
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Reception stays enabled; only the filter banks are frozen while in init mode
+    CAN1->FMR |= CAN_FMR_FINIT;
+
+    CAN1->FA1R = 0;                                 // Deactivate all banks
+    CAN1->FS1R = (1UL << CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS) - 1U;     // 32-bit scale
+    CAN1->FM1R = 0;                                 // Identifier mask mode
+    CAN1->FFA1R = 0;                                // All to FIFO 0
+
+    for (uint8_t i = 0; i < num_filter_configs; i++)
+    {
+        uint32_t fr1 = 0;
+        uint32_t fr2 = 0;
+        filterToRegisters(&filter_configs[i], &fr1, &fr2);
+        CAN1->sFilterRegister[i].FR1 = fr1;
+        CAN1->sFilterRegister[i].FR2 = fr2;
+        CAN1->FA1R |= 1UL << i;
+    }
+
+    CAN1->FMR &= ~CAN_FMR_FINIT;
+    return CANARD_OK;
+}
+#endif
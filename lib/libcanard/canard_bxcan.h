@@ -0,0 +1,176 @@
+/*
+ * bxCAN (STM32) support for libcanard: acceptance filters compiled from the subscription table, and a TX
+ * frame ring that the TX interrupt refills the mailboxes from.
+ *
+ * Part of Arduino DroneCAN, distributed under the BSD 3-Clause License; see LICENSE at the root of the
+ * repository.
+ */
+
+#ifndef CANARD_BXCAN_H
+#define CANARD_BXCAN_H
+
+#include "canard.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Number of filter banks owned by a single bxCAN instance (STM32L4 and other parts without CAN2).
+#ifndef CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS
+#define CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS         14U
+#endif
+
+/**
+ * One bxCAN filter bank in 32-bit identifier mask mode.
+ * Both fields use the libcanard CAN ID format, see CanardCANFrame::id. A frame passes the filter if all bits set in
+ * 'mask' are equal in the frame ID and in 'id'. The flags CANARD_CAN_FRAME_EFF and CANARD_CAN_FRAME_RTR are compared
+ * the same way, so they must be set in 'mask' for the frame format to be checked.
+ */
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;
+} CanardBxCanAcceptanceFilter;
+
+/**
+ * Builds the smallest set of acceptance filters that lets through every transfer the instance can accept, so that
+ * unwanted frames are dropped by the CAN controller instead of raising an interrupt.
+ *
+ * The filters are derived from:
+ *  - every broadcast entry of the subscription table (see canardSetSubscriptions());
+ *  - every message the should_accept callback accepts. The callback is asked about all 65536 message data type IDs,
+ *    as broadcasts from node CANARD_MAX_NODE_ID, so its answer must not depend on the source node. This takes 65536
+ *    calls, which is fine when the node ID changes but not per frame;
+ *  - services addressed to the local node ID. If the instance has no should_accept callback, only the subscribed
+ *    services are let through, otherwise all services addressed to this node are;
+ *  - anonymous messages, if 'accept_anonymous' is set.
+ *
+ * If more filters are needed than 'max_filters', the closest ones are merged until they fit. A merged filter admits a
+ * superset of the original frames, so no wanted transfer is ever lost; the surplus is rejected by
+ * canardHandleRxFrame() as before.
+ *
+ * The result depends on the local node ID and the subscription table, so the filters must be compiled again when
+ * either changes, e.g. after dynamic node ID allocation.
+ *
+ * Returns the number of filters written to 'out_filters', or a negated error code.
+ */
+int16_t canardBxCanCompileAcceptanceFilters(const CanardInstance* ins,
+                                            bool accept_anonymous,
+                                            CanardBxCanAcceptanceFilter* out_filters,
+                                            uint8_t max_filters);
+
+/**
+ * Evaluates a set of filters against a frame ID exactly like the bxCAN filter hardware would, including the
+ * conversion to the filter register layout. Intended for testing filter coverage on the host.
+ * An empty set rejects every frame, same as canardBxCanConfigureAcceptanceFilters().
+ */
+bool canardBxCanAcceptanceFiltersMatch(const CanardBxCanAcceptanceFilter* filter_configs,
+                                       uint8_t num_filter_configs,
+                                       uint32_t can_id);
+
+#if defined(ARDUINO_ARCH_STM32)
+/**
+ * Writes the filters into the filter banks of CAN1 and routes all of them to FIFO 0.
+ * The remaining banks are deactivated, so if no filters are given, no frames are received at all; a single filter
+ * with zero ID and mask accepts everything.
+ * The controller keeps running while the filters are being updated.
+ *
+ * Returns CANARD_OK, or a negated error code if there are more filters than CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS.
+ */
+int16_t canardBxCanConfigureAcceptanceFilters(const CanardBxCanAcceptanceFilter* filter_configs,
+                                              uint8_t num_filter_configs);
+#endif
+
+/**
+ * Frames queued by the main context for the TX interrupt, see canardBxCanFillTxRing().
+ * Must be a power of two. Frames in the ring are committed to the bus in FIFO order, so a larger ring rides out longer
+ * stalls of the main loop, at the cost of delaying higher priority frames queued later by as many frames.
+ */
+#ifndef CANARD_BXCAN_TX_RING_SIZE
+#define CANARD_BXCAN_TX_RING_SIZE                   8U
+#endif
+
+CANARD_STATIC_ASSERT((CANARD_BXCAN_TX_RING_SIZE > 0) &&
+                     ((CANARD_BXCAN_TX_RING_SIZE & (CANARD_BXCAN_TX_RING_SIZE - 1U)) == 0),
+                     "CANARD_BXCAN_TX_RING_SIZE must be a power of two");
+
+/**
+ * Single-producer/single-consumer ring of frames between the main context, which owns the libcanard instance, and the
+ * CAN TX interrupt. Each side only writes its own index and publishes it with release semantics, so neither the ring
+ * nor the libcanard TX queue ever needs a lock.
+ */
+typedef struct
+{
+    CanardCANFrame frames[CANARD_BXCAN_TX_RING_SIZE];
+    uint32_t head;          ///< Number of frames ever written; written by the main context only
+    uint32_t tail;          ///< Number of frames ever read; written by the interrupt only
+    uint32_t dropped;       ///< CAN FD frames taken off the TX queue and discarded; written by the main context only
+} CanardBxCanTxRing;
+
+void canardBxCanInitTxRing(CanardBxCanTxRing* ring);
+
+/**
+ * Main context only. Moves frames from the head of the libcanard TX queue into the ring until either is exhausted,
+ * so the highest priority frames are handed over first. bxCAN is a classic CAN controller, so CAN FD frames are
+ * discarded instead; the receivers drop the rest of their transfer.
+ * With CANARD_ENABLE_DEADLINE, transfers that expired are dropped instead of being moved, see
+ * canardPeekTxQueueUnexpired(); frames already in the ring are sent regardless.
+ * Returns the number of frames moved.
+ */
+uint16_t canardBxCanFillTxRing(CanardInstance* ins,
+                               CanardBxCanTxRing* ring
+#if CANARD_ENABLE_DEADLINE
+                               ,uint64_t current_time_usec
+#endif
+                               );
+
+/**
+ * Interrupt context only. Returns the oldest frame in the ring, or NULL if it is empty. The frame stays valid until
+ * canardBxCanPopTxRing() is called.
+ */
+const CanardCANFrame* canardBxCanPeekTxRing(const CanardBxCanTxRing* ring);
+
+/**
+ * Interrupt context only. Releases the frame returned by canardBxCanPeekTxRing() back to the main context.
+ */
+void canardBxCanPopTxRing(CanardBxCanTxRing* ring);
+
+#if defined(ARDUINO_ARCH_STM32)
+/**
+ * Enables the transmit mailbox empty interrupt of CAN1, and switches the mailboxes to transmit in request order so
+ * the frames of a multi-frame transfer cannot overtake each other. The application must define CAN1_TX_IRQHandler()
+ * and call canardBxCanServiceTxRing() from it.
+ *
+ * From then on the interrupt owns the transmit mailboxes. Any other code that loads them from the main context, such
+ * as the transmit path of the DroneCAN library's cycle(), which sends whatever is left in the libcanard TX queue, must
+ * run between canardBxCanPauseTxRing() and canardBxCanResumeTxRing(); otherwise both may pick the same empty mailbox.
+ * The interrupt only clears the request completed flags it saw set, and the mailboxes still go out in request order,
+ * so frames loaded either way keep their order.
+ */
+void canardBxCanEnableTxInterrupt(void);
+
+/**
+ * Call from CAN1_TX_IRQHandler(). Acknowledges the completed mailboxes and loads frames from the ring into every free
+ * mailbox.
+ */
+void canardBxCanServiceTxRing(CanardBxCanTxRing* ring);
+
+/**
+ * Main context. Makes the TX interrupt run once, so that frames just added to the ring are loaded into idle
+ * mailboxes; call after canardBxCanFillTxRing() has moved any frames.
+ */
+void canardBxCanKickTxRing(void);
+
+/**
+ * Main context. Keeps the TX interrupt from loading mailboxes until canardBxCanResumeTxRing(), see
+ * canardBxCanEnableTxInterrupt(). The bus keeps sending the frames already in the mailboxes meanwhile.
+ */
+void canardBxCanPauseTxRing(void);
+
+void canardBxCanResumeTxRing(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,99 @@
+/*
+ * CAN controller interface for libcanard, so that a node can run against hardware or a simulated bus.
+ *
+ * Part of Arduino DroneCAN, distributed under the BSD 3-Clause License; see LICENSE at the root of the
+ * repository.
+ */
+
+#include "canard_driver.h"
+
+#if CANARD_MULTI_IFACE && CANARD_ENABLE_DEADLINE
+# define DRIVER_PEEK_TX_QUEUE(ins, driver)     canardPeekTxQueueIfaceUnexpired((ins), (driver)->iface_id, current_time_usec)
+#elif CANARD_MULTI_IFACE
+# define DRIVER_PEEK_TX_QUEUE(ins, driver)     canardPeekTxQueueIface((ins), (driver)->iface_id)
+#elif CANARD_ENABLE_DEADLINE
+# define DRIVER_PEEK_TX_QUEUE(ins, driver)     canardPeekTxQueueUnexpired((ins), current_time_usec)
+#else
+# define DRIVER_PEEK_TX_QUEUE(ins, driver)     canardPeekTxQueue(ins)
+#endif
+
+#if CANARD_MULTI_IFACE
+# define DRIVER_POP_TX_QUEUE(ins, driver)      canardPopTxQueueIface((ins), (driver)->iface_id)
+#else
+# define DRIVER_POP_TX_QUEUE(ins, driver)      canardPopTxQueue(ins)
+#endif
+
+uint16_t canardDriverTransmit(CanardInstance* ins,
+                              CanardDriver* driver
+#if CANARD_ENABLE_DEADLINE
+                              ,uint64_t current_time_usec
+#endif
+                              )
+{
+    CANARD_ASSERT(ins != NULL);
+    CANARD_ASSERT(driver != NULL);
+
+    uint16_t sent = 0;
+    const CanardCANFrame* frame = NULL;
+    while ((frame = DRIVER_PEEK_TX_QUEUE(ins, driver)) != NULL)
+    {
+#if CANARD_ENABLE_CANFD
+        if (frame->canfd && !driver->canfd)
+        {
+            driver->tx_dropped++;
+            DRIVER_POP_TX_QUEUE(ins, driver);
+            continue;
+        }
+#endif
+        const int16_t result = driver->transmit(driver, frame);
+        if (result == 0)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            driver->tx_dropped++;
+        }
+        else
+        {
+            sent++;
+        }
+        DRIVER_POP_TX_QUEUE(ins, driver);
+    }
+    return sent;
+}
+
+int16_t canardDriverReceive(CanardInstance* ins,
+                            CanardDriver* driver,
+                            uint16_t max_frames)
+{
+    CANARD_ASSERT(ins != NULL);
+    CANARD_ASSERT(driver != NULL);
+
+    if (max_frames > INT16_MAX)
+    {
+        max_frames = INT16_MAX;
+    }
+
+    int16_t received = 0;
+    while ((uint16_t) received < max_frames)
+    {
+        CanardCANFrame frame;
+        uint64_t timestamp_usec = 0;
+        const int16_t result = driver->receive(driver, &frame, &timestamp_usec);
+        if (result < 0)
+        {
+            return result;
+        }
+        if (result == 0)
+        {
+            break;
+        }
+#if CANARD_MULTI_IFACE
+        frame.iface_id = driver->iface_id;
+#endif
+        (void) canardHandleRxFrame(ins, &frame, timestamp_usec);
+        received++;
+    }
+    return received;
+}
@@ -0,0 +1,79 @@
+/*
+ * CAN controller interface for libcanard, so that a node can run against hardware or a simulated bus.
+ *
+ * Part of Arduino DroneCAN, distributed under the BSD 3-Clause License; see LICENSE at the root of the
+ * repository.
+ */
+
+#ifndef CANARD_DRIVER_H
+#define CANARD_DRIVER_H
+
+#include "canard.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct CanardDriver CanardDriver;
+
+/**
+ * Hands a frame to the controller. Returns 1 if it was taken, 0 if the controller has no room for it right now, or a
+ * negated error code if it can never be sent, e.g. an oversized frame.
+ */
+typedef int16_t (*CanardDriverTransmit)(CanardDriver* driver,
+                                        const CanardCANFrame* frame);
+
+/**
+ * Takes the oldest received frame from the controller. Returns 1 if a frame and its reception time were written,
+ * 0 if there is none, or a negated error code.
+ */
+typedef int16_t (*CanardDriverReceive)(CanardDriver* driver,
+                                       CanardCANFrame* out_frame,
+                                       uint64_t* out_timestamp_usec);
+
+/**
+ * A CAN controller as seen by canardDriverTransmit() and canardDriverReceive(), so that the same node code can run
+ * against the hardware or against a host simulation of the bus.
+ * With CANARD_MULTI_IFACE, there is one driver per interface, each serving the TX queue of its own interface.
+ */
+struct CanardDriver
+{
+    CanardDriverTransmit transmit;
+    CanardDriverReceive receive;
+    bool canfd;                             ///< The controller sends and receives CAN FD frames
+#if CANARD_MULTI_IFACE
+    uint8_t iface_id;                       ///< Index of the interface, below CANARD_NUM_IFACES
+#endif
+    void* user_reference;                   ///< User pointer, e.g. the controller or the simulated bus
+
+    uint32_t tx_dropped;                    ///< Frames taken off the TX queue that the controller could not send
+};
+
+/**
+ * Moves frames from the head of the TX queue to the controller until the queue is empty or the controller is full.
+ * A controller that is stuck only holds up the queue of its own interface.
+ * CAN FD frames are dropped if the controller does not support FD, as are frames the controller refuses with an error;
+ * either way, the rest of the transfer will be discarded by the receivers. With CANARD_ENABLE_DEADLINE, transfers that
+ * expired while waiting are dropped whole instead of being sent, see canardPeekTxQueueUnexpired().
+ * Returns the number of frames handed to the controller.
+ */
+uint16_t canardDriverTransmit(CanardInstance* ins,
+                              CanardDriver* driver
+#if CANARD_ENABLE_DEADLINE
+                              ,uint64_t current_time_usec
+#endif
+                              );
+
+/**
+ * Passes up to 'max_frames' frames from the controller to canardHandleRxFrame(), marked with the interface they came
+ * from.
+ * Returns the number of frames passed, or a negated error code reported by the controller.
+ */
+int16_t canardDriverReceive(CanardInstance* ins,
+                            CanardDriver* driver,
+                            uint16_t max_frames);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -85,8 +85,78 @@ extern "C" {
 # define CANARD_SIZEOF_FLOAT   4
 #endif
 
+CANARD_INTERNAL const CanardSubscription* findSubscription(const CanardInstance* ins,
+                                                          uint16_t data_type_id,
+                                                          CanardTransferType transfer_type);
+
+CANARD_INTERNAL void dispatchRxTransfer(CanardInstance* ins,
+                                        CanardRxTransfer* transfer);
+
+CANARD_INTERNAL int16_t screenRxFrame(const CanardCANFrame* frame,
+                                      uint8_t local_node_id);
+
+CANARD_INTERNAL int16_t handleScreenedRxFrame(CanardInstance* ins,
+                                              const CanardCANFrame* frame,
+                                              uint64_t timestamp_usec);
+
+CANARD_INTERNAL void gatherTransferPayload(CanardInstance* ins,
+                                           CanardRxTransfer* transfer);
+
+CANARD_INTERNAL uint16_t frameWireBits(const CanardCANFrame* frame);
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+CANARD_INTERNAL uint16_t busLoadPermille(uint64_t bits,
+                                         uint64_t capacity);
+#endif
+
+CANARD_INTERNAL void updateRxStatistics(CanardInstance* ins,
+                                        const CanardCANFrame* frame,
+                                        int16_t result);
+
+CANARD_INTERNAL void updateTxStatistics(CanardInstance* ins,
+                                        int16_t result);
+
+#if CANARD_TX_TRANSFER_ID_SLOTS > 0
+CANARD_INTERNAL uint8_t* txTransferIdSlot(CanardInstance* ins,
+                                          uint32_t transfer_descriptor);
+#endif
+
+CANARD_INTERNAL uint16_t rxStateBucket(uint32_t transfer_descriptor);
+
 CANARD_INTERNAL CanardRxState* traverseRxStates(CanardInstance* ins,
-                                                uint32_t transfer_descriptor);
+                                                uint32_t transfer_descriptor,
+                                                uint8_t priority);
+
+CANARD_INTERNAL uint16_t rxPayloadBlocks(size_t payload_len);
+
+CANARD_INTERNAL uint16_t rxBlocksNeeded(const CanardRxState* state,
+                                        uint8_t data_len);
+
+CANARD_INTERNAL void chargeNodeBlocks(CanardInstance* ins,
+                                      uint8_t source_node_id,
+                                      int16_t delta);
+
+CANARD_INTERNAL bool admitRxBlocks(CanardInstance* ins,
+                                   uint8_t priority,
+                                   uint8_t source_node_id,
+                                   CanardPoolConsumer consumer,
+                                   uint16_t block_count);
+
+CANARD_INTERNAL void touchRxState(CanardInstance* ins,
+                                  CanardRxState* state,
+                                  uint64_t timestamp_usec);
+
+CANARD_INTERNAL void unlinkRxStateExpiry(CanardInstance* ins,
+                                         CanardRxState* state);
+
+CANARD_INTERNAL void removeRxState(CanardInstance* ins,
+                                   CanardRxState* state);
+
+CANARD_INTERNAL uint16_t rxStateBlockNumber(const CanardPoolAllocator* allocator,
+                                            const CanardRxState* state);
+
+CANARD_INTERNAL CanardRxState* rxStateFromBlockNumber(const CanardPoolAllocator* allocator,
+                                                      uint16_t number);
 
 CANARD_INTERNAL CanardRxState* createRxState(CanardPoolAllocator* allocator,
                                              uint32_t transfer_descriptor);
@@ -102,10 +172,59 @@ CANARD_INTERNAL int16_t bufferBlockPushBytes(CanardPoolAllocator* allocator,
                                              const uint8_t* data,
                                              uint8_t data_len);
 
+CANARD_INTERNAL CanardBufferBlock* appendBufferBlock(CanardPoolAllocator* allocator,
+                                                     CanardRxState* state);
+
 CANARD_INTERNAL CanardBufferBlock* createBufferBlock(CanardPoolAllocator* allocator);
 
-CANARD_INTERNAL void pushTxQueue(CanardInstance* ins,
-                                 CanardTxQueueItem* item);
+CANARD_INTERNAL void popTxQueue(CanardInstance* ins,
+                                CanardTxQueue* queue);
+
+CANARD_INTERNAL void spliceTxQueue(CanardInstance* ins,
+                                   CanardTxQueue* queue,
+                                   CanardTxQueueItem* first,
+                                   CanardTxQueueItem* last,
+                                   uint16_t frame_count);
+
+CANARD_INTERNAL CanardTxQueueItem* txLevelPredecessor(const CanardTxQueue* queue,
+                                                      uint8_t level);
+
+CANARD_INTERNAL void coalesceTxQueue(CanardInstance* ins,
+                                     uint32_t frame_id,
+                                     const CanardTxTransfer* transfer);
+
+CANARD_INTERNAL void removeTxItem(CanardTxQueue* queue,
+                                  CanardTxQueueItem* previous,
+                                  CanardTxQueueItem* item);
+
+CANARD_INTERNAL void freeTxChain(CanardPoolAllocator* allocator,
+                                 CanardTxQueueItem* first);
+
+#if CANARD_ENABLE_DEADLINE
+CANARD_INTERNAL bool txDeadlinePassed(const CanardCANFrame* frame,
+                                      uint64_t current_time_usec);
+
+CANARD_INTERNAL CanardTxQueueItem* peekUnexpiredTxItem(CanardInstance* ins,
+                                                       CanardTxQueue* queue,
+                                                       uint64_t current_time_usec);
+
+CANARD_INTERNAL CanardTxQueueItem* removeTxTransfer(CanardInstance* ins,
+                                                    CanardTxQueue* queue,
+                                                    CanardTxQueueItem* previous,
+                                                    CanardTxQueueItem* first);
+#endif
+
+#if CANARD_MULTI_IFACE
+CANARD_INTERNAL uint8_t admitTxIfaces(CanardInstance* ins,
+                                      uint8_t iface_mask,
+                                      uint16_t frames_needed,
+                                      uint16_t frames_held);
+
+CANARD_INTERNAL CanardTxQueueItem* copyTxChain(CanardPoolAllocator* allocator,
+                                               const CanardTxQueueItem* first,
+                                               uint8_t iface,
+                                               CanardTxQueueItem** out_last);
+#endif
 
 CANARD_INTERNAL bool isPriorityHigher(uint32_t id,
                                       uint32_t rhs);
@@ -125,12 +244,39 @@ CANARD_INTERNAL uint64_t releaseStatePayload(CanardInstance* ins,
 CANARD_INTERNAL uint16_t dlcToDataLength(uint16_t dlc);
 CANARD_INTERNAL uint16_t dataLengthToDlc(uint16_t data_length);
 
-/// Returns the number of frames enqueued
+/// Returns the number of frames enqueued; crc is the seed from calculateCRCSeed()
 CANARD_INTERNAL int16_t enqueueTxFrames(CanardInstance* ins,
                                         uint32_t can_id,
                                         uint16_t crc,
                                         CanardTxTransfer* transfer);
 
+CANARD_INTERNAL void queueTxChain(CanardInstance* ins,
+                                  CanardTxQueueItem* first,
+                                  CanardTxQueueItem* last,
+                                  uint16_t frame_count
+#if CANARD_MULTI_IFACE
+                                  ,uint8_t iface_mask
+#endif
+                                  );
+
+CANARD_INTERNAL uint8_t txStreamBytesPerFrame(const CanardTxStream* stream);
+
+CANARD_INTERNAL CanardTxQueueItem* createTxStreamItem(CanardTxStream* stream);
+
+CANARD_INTERNAL void failTxStream(CanardTxStream* stream,
+                                  int16_t error);
+
+CANARD_INTERNAL bool advanceTxStream(CanardTxStream* stream);
+
+CANARD_INTERNAL void finishTxStreamFrame(CanardTxStream* stream,
+                                         CanardTxQueueItem* item,
+                                         uint8_t length,
+                                         uint8_t sot_eot);
+
+CANARD_INTERNAL void writeTxStreamBytes(CanardTxStream* stream,
+                                        const uint8_t* bytes,
+                                        uint16_t len);
+
 CANARD_INTERNAL void copyBitArray(const uint8_t* src,
                                   uint32_t src_offset,
                                   uint32_t src_len,
@@ -138,10 +284,10 @@ CANARD_INTERNAL void copyBitArray(const uint8_t* src,
                                   uint32_t dst_offset);
 
 /**
- * Moves specified bits from the scattered transfer storage to a specified contiguous buffer.
+ * Moves specified bits from the scattered transfer storage to a specified contiguous buffer, advancing the reader.
  * Returns the number of bits copied, or negated error code.
  */
-CANARD_INTERNAL int16_t descatterTransferPayload(const CanardRxTransfer* transfer,
+CANARD_INTERNAL int16_t descatterTransferPayload(CanardRxReader* reader,
                                                  uint32_t bit_offset,
                                                  uint8_t bit_length,
                                                  void* output);
@@ -163,6 +309,13 @@ CANARD_INTERNAL uint16_t crcAdd(uint16_t crc_val,
                                 const uint8_t* bytes,
                                 size_t len);
 
+/**
+ * Returns the transfer CRC seeded with the data type signature, i.e. crcAddSignature(0xFFFF, data_type_signature).
+ * The result is cached in the instance, so the signature is only hashed the first time it is seen.
+ */
+CANARD_INTERNAL uint16_t crcSignatureSeed(CanardInstance* ins,
+                                          uint64_t data_type_signature);
+
 /**
  * Inits a memory allocator.
  *
@@ -175,17 +328,27 @@ CANARD_INTERNAL void initPoolAllocator(CanardPoolAllocator* allocator,
                                        uint16_t buf_len);
 
 /**
- * Allocates a block from the given pool allocator.
+ * Allocates a block from the given pool allocator on behalf of the consumer, unless that exceeds its quota.
  */
-CANARD_INTERNAL void* allocateBlock(CanardPoolAllocator* allocator);
+CANARD_INTERNAL void* allocateBlock(CanardPoolAllocator* allocator,
+                                    CanardPoolConsumer consumer);
 
 /**
- * Frees a memory block previously returned by canardAllocateBlock.
+ * Frees a memory block previously returned by canardAllocateBlock for the same consumer.
  */
 CANARD_INTERNAL void freeBlock(CanardPoolAllocator* allocator,
-                               void* p);
+                               void* p,
+                               CanardPoolConsumer consumer);
 
-CANARD_INTERNAL uint16_t calculateCRC(const CanardTxTransfer* transfer_object);
+CANARD_INTERNAL uint16_t poolBlocksAvailable(const CanardPoolAllocator* allocator,
+                                             CanardPoolConsumer consumer);
+
+/**
+ * Returns the CRC seed of a transfer: the data type signature CRC for multi-frame transfers, 0xFFFF otherwise.
+ * The payload is added to it by enqueueTxFrames() while the frames are filled.
+ */
+CANARD_INTERNAL uint16_t calculateCRCSeed(CanardInstance* ins,
+                                          const CanardTxTransfer* transfer_object);
 
 CANARD_INTERNAL CanardBufferBlock *canardBufferFromIdx(CanardPoolAllocator* allocator, canard_buffer_idx_t idx);
 
@@ -0,0 +1,246 @@
+/*
+ * Rate-based scheduler for periodic libcanard broadcasts, with staggered phases and congestion throttling.
+ *
+ * Part of Arduino DroneCAN, distributed under the BSD 3-Clause License; see LICENSE at the root of the
+ * repository.
+ */
+
+#include "canard_scheduler.h"
+#include <string.h>
+
+
+/**
+ * Spreads the first slots of the publishers evenly over the shortest period, starting now.
+ */
+static void staggerPublishers(CanardScheduler* scheduler,
+                              uint64_t current_time_usec)
+{
+    uint32_t shortest_period_usec = UINT32_MAX;
+    for (const CanardPublisher* pub = scheduler->publishers; pub != NULL; pub = pub->next)
+    {
+        if (pub->period_usec < shortest_period_usec)
+        {
+            shortest_period_usec = pub->period_usec;
+        }
+    }
+
+    const uint32_t spacing_usec = shortest_period_usec / scheduler->num_publishers;
+    uint16_t index = 0;
+    for (CanardPublisher* pub = scheduler->publishers; pub != NULL; pub = pub->next)
+    {
+        pub->next_slot_usec = current_time_usec + (uint64_t) spacing_usec * index;
+        index++;
+    }
+    scheduler->staggered = true;
+}
+
+static void updateJitter(CanardPublisherStatistics* stats,
+                         uint64_t jitter_usec)
+{
+    const uint32_t jitter = (jitter_usec > UINT32_MAX) ? UINT32_MAX : (uint32_t) jitter_usec;
+    stats->last_jitter_usec = jitter;
+    if (jitter > stats->max_jitter_usec)
+    {
+        stats->max_jitter_usec = jitter;
+    }
+    stats->total_jitter_usec += jitter;
+}
+
+void canardInitScheduler(CanardScheduler* scheduler,
+                         uint8_t* buffer,
+                         uint16_t buffer_size)
+{
+    CANARD_ASSERT(scheduler != NULL);
+    scheduler->publishers = NULL;
+    scheduler->num_publishers = 0;
+    scheduler->staggered = true;
+    scheduler->buffer = buffer;
+    scheduler->buffer_size = buffer_size;
+    scheduler->throttle_load_permille = 0;
+    scheduler->release_load_permille = 0;
+    scheduler->throttle_queue_frames = 0;
+    scheduler->release_queue_frames = 0;
+    scheduler->throttled = false;
+}
+
+void canardInitPublisher(CanardPublisher* publisher)
+{
+    CANARD_ASSERT(publisher != NULL);
+    memset(publisher, 0, sizeof(*publisher));
+    publisher->priority = CANARD_TRANSFER_PRIORITY_MEDIUM;
+#if CANARD_MULTI_IFACE
+    publisher->iface_mask = (uint8_t)((1U << CANARD_NUM_IFACES) - 1U);
+#endif
+}
+
+int16_t canardAddPublisher(CanardScheduler* scheduler,
+                           CanardPublisher* publisher)
+{
+    if (((publisher->encode == NULL) == (publisher->write == NULL)) || (publisher->period_usec == 0))
+    {
+        return -CANARD_ERROR_INVALID_ARGUMENT;
+    }
+
+    publisher->next = scheduler->publishers;
+    scheduler->publishers = publisher;
+    scheduler->num_publishers++;
+    scheduler->staggered = false;
+    return CANARD_OK;
+}
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+void canardSetSchedulerThrottle(CanardScheduler* scheduler,
+                                uint16_t throttle_load_permille,
+                                uint16_t release_load_permille)
+{
+    CANARD_ASSERT(release_load_permille <= throttle_load_permille);
+    scheduler->throttle_load_permille = throttle_load_permille;
+    scheduler->release_load_permille = release_load_permille;
+}
+#endif
+
+void canardSetSchedulerQueueThrottle(CanardScheduler* scheduler,
+                                     uint16_t throttle_frames,
+                                     uint16_t release_frames)
+{
+    CANARD_ASSERT(release_frames <= throttle_frames);
+    scheduler->throttle_queue_frames = throttle_frames;
+    scheduler->release_queue_frames = release_frames;
+}
+
+/**
+ * Applies the throttle thresholds to the current bus load estimate and TX queue depth.
+ */
+static void updateThrottle(CanardScheduler* scheduler,
+                           const CanardInstance* ins)
+{
+    bool congested = false;
+    bool relieved = true;
+#if CANARD_BUS_LOAD_BUCKETS > 0
+    if (scheduler->throttle_load_permille != 0)
+    {
+        const uint16_t load = canardGetBusLoad(ins);
+        congested = (load >= scheduler->throttle_load_permille);
+        relieved = (load < scheduler->release_load_permille);
+    }
+#endif
+    if (scheduler->throttle_queue_frames != 0)
+    {
+        uint16_t depth = 0;
+        for (uint8_t iface = 0; iface < CANARD_NUM_IFACES; iface++)
+        {
+            if (ins->tx_queues[iface].blocks > depth)
+            {
+                depth = ins->tx_queues[iface].blocks;
+            }
+        }
+        congested = congested || (depth >= scheduler->throttle_queue_frames);
+        relieved = relieved && (depth <= scheduler->release_queue_frames);
+    }
+
+    if (congested)
+    {
+        scheduler->throttled = true;
+    }
+    else if (relieved)
+    {
+        scheduler->throttled = false;
+    }
+}
+
+uint16_t canardRunScheduler(CanardScheduler* scheduler,
+                            CanardInstance* ins,
+                            uint64_t current_time_usec)
+{
+    if (!scheduler->staggered)
+    {
+        staggerPublishers(scheduler, current_time_usec);
+    }
+    updateThrottle(scheduler, ins);
+
+    uint16_t published = 0;
+    for (CanardPublisher* pub = scheduler->publishers; pub != NULL; pub = pub->next)
+    {
+        if (current_time_usec < pub->next_slot_usec)
+        {
+            continue;
+        }
+
+        const uint64_t late_usec = current_time_usec - pub->next_slot_usec;
+        const uint64_t missed = late_usec / pub->period_usec;
+        pub->statistics.overruns += (uint32_t) missed;
+        updateJitter(&pub->statistics, late_usec - missed * pub->period_usec);
+        // Stay on the original grid, so that the publishers keep the phases they were given
+        pub->next_slot_usec += (missed + 1U) * pub->period_usec;
+
+        pub->throttled = scheduler->throttled;
+        if (pub->throttled && (pub->throttle_divider > 1U))
+        {
+            pub->throttle_count++;
+            if (pub->throttle_count < pub->throttle_divider)
+            {
+                pub->statistics.throttled++;
+                continue;
+            }
+        }
+        pub->throttle_count = 0;
+
+        CanardTxTransfer transfer;
+        canardInitTxTransfer(&transfer);
+        transfer.transfer_type = CanardTransferTypeBroadcast;
+        transfer.data_type_signature = pub->data_type_signature;
+        transfer.data_type_id = pub->data_type_id;
+        transfer.inout_transfer_id = &pub->transfer_id;
+        transfer.priority = pub->priority;
+        transfer.coalesce = pub->coalesce;
+#if CANARD_ENABLE_CANFD
+        transfer.canfd = pub->canfd;
+#endif
+#if CANARD_MULTI_IFACE
+        transfer.iface_mask = pub->iface_mask;
+#endif
+#if CANARD_ENABLE_DEADLINE
+        // A sample that is still queued when the next one is due is of no use
+        transfer.deadline_usec = (pub->tx_timeout_usec != 0) ? (current_time_usec + pub->tx_timeout_usec) :
+                                 pub->next_slot_usec;
+#endif
+
+        int16_t result = 0;
+        if (pub->write != NULL)
+        {
+            CanardTxStream stream;
+            (void) canardTxStreamBegin(&stream, ins, &transfer, 0);        // A failure comes back from the commit
+            if (pub->write(pub, &stream) < 0)
+            {
+                canardTxStreamAbort(&stream);
+                pub->statistics.skipped++;
+                continue;
+            }
+            result = canardTxStreamCommit(&stream);
+        }
+        else
+        {
+            const int32_t len = pub->encode(pub, &transfer, scheduler->buffer, scheduler->buffer_size);
+            if (len < 0)
+            {
+                pub->statistics.skipped++;
+                continue;
+            }
+            CANARD_ASSERT(len <= scheduler->buffer_size);
+            transfer.payload = scheduler->buffer;
+            transfer.payload_len = (uint16_t) len;
+            result = canardBroadcastObj(ins, &transfer);
+        }
+
+        if (result < 0)
+        {
+            pub->statistics.tx_errors++;
+        }
+        else
+        {
+            pub->statistics.publications++;
+            published++;
+        }
+    }
+    return published;
+}
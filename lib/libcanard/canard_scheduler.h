@@ -0,0 +1,174 @@
+/*
+ * Rate-based scheduler for periodic libcanard broadcasts, with staggered phases and congestion throttling.
+ *
+ * Part of Arduino DroneCAN, distributed under the BSD 3-Clause License; see LICENSE at the root of the
+ * repository.
+ */
+
+#ifndef CANARD_SCHEDULER_H
+#define CANARD_SCHEDULER_H
+
+#include "canard.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Converts a publication rate in Hz to CanardPublisher::period_usec.
+#define CANARD_PUBLISHER_PERIOD_USEC(rate_hz)       (1000000UL / (rate_hz))
+
+typedef struct CanardPublisher CanardPublisher;
+
+/**
+ * Called by canardRunScheduler() when the publisher is due. Encodes the message into 'buffer', which holds
+ * 'buffer_size' bytes, and returns the payload length; returns a negative value to skip this period, e.g. when there is
+ * no new sample. The transfer is already filled in from the publisher and may be adjusted, e.g. coalesce_key, canfd or
+ * the deadline_usec of this one publication.
+ * With CANARD_ENABLE_TAO_OPTION, pass canardTxTransferTao() of the final transfer to the generated encoder.
+ */
+typedef int32_t (*CanardPublisherEncode)(CanardPublisher* publisher,
+                                         CanardTxTransfer* transfer,
+                                         uint8_t* buffer,
+                                         uint16_t buffer_size);
+
+/**
+ * Alternative to CanardPublisherEncode that writes the message straight into the frames of the TX queue, with
+ * canardTxStreamWrite() and canardTxStreamEncodeScalar(), so that no encoding buffer is needed. Returns a
+ * negative value to skip this period; the frames written so far are released. Of the transfer in the stream, only
+ * coalesce_key may be adjusted.
+ */
+typedef int16_t (*CanardPublisherWrite)(CanardPublisher* publisher,
+                                        CanardTxStream* stream);
+
+/**
+ * Publication counters, see CanardPublisher::statistics.
+ * Jitter is how late a publication was queued relative to its slot; it is never negative because a publisher does not
+ * run before its slot.
+ */
+typedef struct
+{
+    uint32_t publications;                  ///< Transfers queued
+    uint32_t skipped;                       ///< Periods the encode callback had nothing to send
+    uint32_t tx_errors;                     ///< Transfers the library refused to queue
+    uint32_t overruns;                      ///< Slots missed entirely because the scheduler ran too late
+    uint32_t throttled;                     ///< Slots dropped because the bus was congested
+    uint32_t last_jitter_usec;              ///< Jitter of the latest slot
+    uint32_t max_jitter_usec;               ///< Largest jitter so far
+    uint64_t total_jitter_usec;             ///< Sum of the jitter of all slots, for the mean
+} CanardPublisherStatistics;
+
+/**
+ * A periodic broadcast message. Initialize with canardInitPublisher(), fill in the fields above 'statistics', then
+ * register it with canardAddPublisher(). The object must stay valid for as long as the scheduler is used.
+ */
+struct CanardPublisher
+{
+    uint64_t data_type_signature;           ///< Refer to the specification
+    uint16_t data_type_id;                  ///< Refer to the specification
+    uint8_t priority;                       ///< Refer to definitions CANARD_TRANSFER_PRIORITY_*
+    bool coalesce;                          ///< Replace the queued sample if the bus did not get to it, see canardBroadcastObj()
+#if CANARD_ENABLE_CANFD
+    bool canfd;                             ///< Send as CAN FD; encode with canardTxTransferTao()
+#endif
+#if CANARD_MULTI_IFACE
+    uint8_t iface_mask;                     ///< Interfaces to publish on; all of them by default
+#endif
+    uint32_t period_usec;                   ///< Publication period, see CANARD_PUBLISHER_PERIOD_USEC()
+    uint8_t throttle_divider;               ///< While the bus is congested, publish one slot in this many; 0 or 1 never drops
+#if CANARD_ENABLE_DEADLINE
+    uint32_t tx_timeout_usec;               ///< How long a publication may wait in the TX queue; 0 waits until the next slot
+#endif
+    CanardPublisherEncode encode;           ///< Encodes the message, or NULL if 'write' does
+    CanardPublisherWrite write;             ///< Writes the message into the TX queue, or NULL if 'encode' does
+    void* user_reference;                   ///< User pointer, e.g. the object holding the data to publish
+
+    CanardPublisherStatistics statistics;   ///< Maintained by the scheduler
+
+    bool throttled;                         ///< Set while the bus is congested; encode may send a reduced message
+    uint64_t next_slot_usec;                ///< Internal
+    uint8_t throttle_count;                 ///< Internal
+    uint8_t transfer_id;                    ///< Internal
+    CanardPublisher* next;                  ///< Internal
+};
+
+/**
+ * Publishes a set of periodic messages from a monotonic microsecond clock.
+ * The first slot of each publisher is staggered so that publishers of the same rate never fire together, and
+ * publishers whose periods are multiples of the shortest one never share a slot either.
+ */
+typedef struct
+{
+    CanardPublisher* publishers;            ///< Registered publishers, most recent first
+    uint16_t num_publishers;
+    bool staggered;                         ///< False until the slots were spread after a publisher was added
+    uint8_t* buffer;                        ///< Encoding buffer shared by all publishers
+    uint16_t buffer_size;
+    uint16_t throttle_load_permille;        ///< See canardSetSchedulerThrottle()
+    uint16_t release_load_permille;         ///< See canardSetSchedulerThrottle()
+    uint16_t throttle_queue_frames;         ///< See canardSetSchedulerQueueThrottle()
+    uint16_t release_queue_frames;          ///< See canardSetSchedulerQueueThrottle()
+    bool throttled;                         ///< True while the bus load or the TX queue is above its threshold
+} CanardScheduler;
+
+/**
+ * The buffer must hold the largest message of all publishers that encode, i.e. the largest *_MAX_SIZE of their data
+ * types; it may be NULL if all of them write.
+ */
+void canardInitScheduler(CanardScheduler* scheduler,
+                         uint8_t* buffer,
+                         uint16_t buffer_size);
+
+void canardInitPublisher(CanardPublisher* publisher);
+
+/**
+ * Registers a publisher. The slots of all publishers are spread again on the next call to canardRunScheduler().
+ * Returns CANARD_OK, or -CANARD_ERROR_INVALID_ARGUMENT if the publisher has no period, or not exactly one of the
+ * encode and write callbacks.
+ */
+int16_t canardAddPublisher(CanardScheduler* scheduler,
+                           CanardPublisher* publisher);
+
+#if CANARD_BUS_LOAD_BUCKETS > 0
+/**
+ * Throttles the publishers once canardGetBusLoad() reaches 'throttle_load_permille', until it falls below
+ * 'release_load_permille'. While throttled, every publisher has its 'throttled' flag set and publishes only one slot
+ * in CanardPublisher::throttle_divider, so that congestion sheds the least important messages first instead of
+ * starving them in arbitration. The application must keep the estimate current with canardUpdateBusLoad().
+ * A zero threshold, the default, disables throttling.
+ */
+void canardSetSchedulerThrottle(CanardScheduler* scheduler,
+                                uint16_t throttle_load_permille,
+                                uint16_t release_load_permille);
+#endif
+
+/**
+ * Throttles the publishers as canardSetSchedulerThrottle() does, once the TX queue holds 'throttle_frames' frames,
+ * until it is down to 'release_frames'. The bus load estimate only counts the frames this node sends and receives, so
+ * it misses traffic that the acceptance filters drop; a TX queue that keeps growing shows congestion all the same.
+ * With CANARD_MULTI_IFACE, the longest queue counts. Both signals may be used together; either one throttles, and
+ * the publishers are released once both are below their release thresholds. A zero threshold, the default, disables
+ * it.
+ */
+void canardSetSchedulerQueueThrottle(CanardScheduler* scheduler,
+                                     uint16_t throttle_frames,
+                                     uint16_t release_frames);
+
+/**
+ * Queues the messages of all publishers whose slot has come. Call from the main loop as often as possible; the
+ * interval between calls bounds the jitter.
+ *
+ * A publisher runs at most once per call. If whole periods were missed, they are counted as overruns and the
+ * publisher resumes in its next slot, so that its phase is kept and a late call does not cause a burst.
+ * With CANARD_ENABLE_DEADLINE, each message expires at the next slot of its publisher, so the clock must be the same
+ * as the one given to canardCleanupStaleTransfers().
+ *
+ * Returns the number of messages queued.
+ */
+uint16_t canardRunScheduler(CanardScheduler* scheduler,
+                            CanardInstance* ins,
+                            uint64_t current_time_usec);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
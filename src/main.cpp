@@ -1,46 +1,251 @@
 #include <Arduino.h>
 #include <dronecan.h>
 #include <IWatchdog.h>
+#include <canard_bxcan.h>
+#include <canard_scheduler.h>
 
 DroneCAN dronecan;
 
-uint32_t looptime = 0;
+/*
+micros() wraps around every 71 minutes; the scheduler and the TX deadlines need a clock that does not. loop() calls this
+far more often than that, so every wrap is seen.
+*/
+static uint64_t monotonicMicros()
+{
+    static uint32_t last_micros;
+    static uint64_t wraps;
+    const uint32_t now = micros();
+    if (now < last_micros)
+    {
+        wraps += 1ULL << 32;
+    }
+    last_micros = now;
+    return wraps + now;
+}
 
 /*
-This function is called when we receive a CAN message, and it's accepted by the shouldAcceptTransfer function.
-We need to do boiler plate code in here to handle parameter updates and so on, but you can also write code to interact with sent messages here.
+Handlers for the messages we want to receive. Each one is listed in the subscriptions table below together with
+its data type ID, transfer type and signature, and the library calls it whenever such a transfer arrives.
+A subscribed transfer goes to its handler instead of onTransferReceived, so a handler that wants the DroneCAN library
+to see the transfer as well passes it on, as onMagneticFieldStrength does.
 */
-static void onTransferReceived(CanardInstance *ins, CanardRxTransfer *transfer)
+static void onMagneticFieldStrength(CanardInstance *ins, CanardRxTransfer *transfer)
 {
+    uavcan_equipment_ahrs_MagneticFieldStrength pkt{};
+    uavcan_equipment_ahrs_MagneticFieldStrength_decode(transfer, &pkt);
+    Serial.print(pkt.magnetic_field_ga[0], 4);
+    Serial.print(" ");
+    Serial.print(pkt.magnetic_field_ga[1], 4);
+    Serial.print(" ");
+    Serial.print(pkt.magnetic_field_ga[2], 4);
+    Serial.print(" ");
+    Serial.println();
 
-    // switch on data type ID to pass to the right handler function
-    // if (transfer->transfer_type == CanardTransferTypeRequest)
-    // check if we want to handle a specific service request
-    switch (transfer->data_type_id)
-    {
+    DroneCANonTransferReceived(dronecan, ins, transfer);
+}
+
+/*
+Transfers that were dropped because they were broken, as opposed to frames that were simply not for us.
+*/
+static uint32_t transferErrors(const CanardInstanceStatistics &stats)
+{
+    return stats.rx_errors[CANARD_ERROR_OUT_OF_MEMORY] +
+           stats.rx_errors[CANARD_ERROR_INTERNAL] +
+           stats.rx_errors[CANARD_ERROR_RX_MISSED_START] +
+           stats.rx_errors[CANARD_ERROR_RX_WRONG_TOGGLE] +
+           stats.rx_errors[CANARD_ERROR_RX_SHORT_FRAME] +
+           stats.rx_errors[CANARD_ERROR_RX_BAD_CRC];
+}
+
+/*
+Answer GetTransportStats requests from the counters libcanard keeps in the instance.
+*/
+static void onGetTransportStats(CanardInstance *ins, CanardRxTransfer *transfer)
+{
+    const CanardInstanceStatistics stats = canardGetStatistics(ins);
+
+    uavcan_protocol_GetTransportStatsResponse pkt{};
+    pkt.transfers_tx = stats.tx_transfers;
+    pkt.transfers_rx = stats.rx_transfers;
+    pkt.transfer_errors = transferErrors(stats);
+    pkt.can_iface_stats.len = 1;
+    pkt.can_iface_stats.data[0].frames_tx = stats.tx_frames;
+    pkt.can_iface_stats.data[0].frames_rx = stats.rx_frames;
+    pkt.can_iface_stats.data[0].errors = stats.rx_errors[CANARD_ERROR_RX_INCOMPATIBLE_PACKET] + stats.tx_errors;
 
-    case UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_ID:
+    // answer in the frame format and on the interface the request came in
+    CanardTxTransfer response;
+    canardInitTxTransfer(&response);
+    response.transfer_type = CanardTransferTypeResponse;
+    response.data_type_signature = UAVCAN_PROTOCOL_GETTRANSPORTSTATS_SIGNATURE;
+    response.data_type_id = UAVCAN_PROTOCOL_GETTRANSPORTSTATS_ID;
+    response.inout_transfer_id = &transfer->transfer_id;
+    response.priority = transfer->priority;
+#if CANARD_ENABLE_CANFD
+    response.canfd = transfer->canfd;
+#endif
+#if CANARD_MULTI_IFACE
+    response.iface_mask = (uint8_t)(1U << transfer->iface_id);
+#endif
+#if CANARD_ENABLE_DEADLINE
+    response.deadline_usec = monotonicMicros() + 1000000U; // the client gives up after about a second
+#endif
+
+    uint8_t buffer[UAVCAN_PROTOCOL_GETTRANSPORTSTATS_RESPONSE_MAX_SIZE];
+    response.payload = buffer;
+    response.payload_len = (uint16_t)uavcan_protocol_GetTransportStatsResponse_encode(&pkt, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                                                                      , canardTxTransferTao(ins, &response)
+#endif
+                                                                                      );
+    canardRequestOrRespondObj(ins, transfer->source_node_id, &response);
+}
+
+/*
+Periodic messages. Each one has an encode callback that the scheduler calls when its slot comes, and the scheduler
+spreads the slots so that the messages do not all go out in the same loop iteration. BatteryInfo, the most frequent
+one, is written field by field straight into the TX frames instead, so it needs no room in the encoding buffer.
+*/
+static int16_t writeBatteryInfo(CanardPublisher *publisher, CanardTxStream *stream)
+{
+    // collect MCU core temperature data
+    int32_t vref = __LL_ADC_CALC_VREFANALOG_VOLTAGE(analogRead(AVREF), LL_ADC_RESOLUTION_12B);
+    int32_t cpu_temp = __LL_ADC_CALC_TEMPERATURE(vref, analogRead(ATEMP), LL_ADC_RESOLUTION_12B);
+
+    // write the uavcan.equipment.power.BatteryInfo fields straight into the TX frames, in DSDL order; test_tx_stream
+    // checks this layout frame for frame against uavcan_equipment_power_BatteryInfo_encode()
+    const uint16_t float16_fields[7] = {
+        canardConvertNativeFloatToFloat16(cpu_temp),                // temperature
+        canardConvertNativeFloatToFloat16(millis() / 10000),        // voltage
+        0, 0, 0, 0, 0,                                              // current, power, capacities, hours to charge
+    };
+    for (uint8_t i = 0; i < 7; i++)
     {
-        uavcan_equipment_ahrs_MagneticFieldStrength pkt{};
-        uavcan_equipment_ahrs_MagneticFieldStrength_decode(transfer, &pkt);
-        Serial.print(pkt.magnetic_field_ga[0], 4);
-        Serial.print(" ");
-        Serial.print(pkt.magnetic_field_ga[1], 4);
-        Serial.print(" ");
-        Serial.print(pkt.magnetic_field_ga[2], 4);
-        Serial.print(" ");
-        Serial.println();
-        break;
+        canardTxStreamEncodeScalar(stream, 16, &float16_fields[i]);
     }
+    const uint16_t status_flags = 0;
+    const uint8_t state_of_health_pct = 0;
+    const uint8_t state_of_charge_pct = 0;
+    const uint8_t state_of_charge_pct_stdev = 0;
+    const uint8_t battery_id = 0;
+    const uint32_t model_instance_id = 0;
+    canardTxStreamEncodeScalar(stream, 11, &status_flags);
+    canardTxStreamEncodeScalar(stream, 7, &state_of_health_pct);
+    canardTxStreamEncodeScalar(stream, 7, &state_of_charge_pct);
+    canardTxStreamEncodeScalar(stream, 7, &state_of_charge_pct_stdev);
+    canardTxStreamEncodeScalar(stream, 8, &battery_id);
+    canardTxStreamEncodeScalar(stream, 32, &model_instance_id);
+
+    // model_name is empty: only its length is sent, and only when tail array optimization does not leave it out
+#if CANARD_ENABLE_TAO_OPTION
+    if (!canardTxTransferTao(&dronecan.canard, &stream->transfer))
+    {
+        const uint8_t model_name_len = 0;
+        canardTxStreamEncodeScalar(stream, 5, &model_name_len);
     }
+#endif
 
-    DroneCANonTransferReceived(dronecan, ins, transfer);
+    // only the newest sample is worth sending: if the bus is too busy to send the previous one, replace it
+    stream->transfer.coalesce_key = battery_id;
+    return 0;
+}
+
+/*
+Broadcast the transport counters as dronecan.protocol.Stats and dronecan.protocol.CanStats. The CanStats fields that
+only the CAN driver knows about (overflows, timeouts, bus off) are left at zero.
+*/
+static int32_t encodeStats(CanardPublisher *publisher, CanardTxTransfer *transfer, uint8_t *buffer, uint16_t buffer_size)
+{
+    const CanardInstanceStatistics stats = canardGetStatistics(&dronecan.canard);
+
+    dronecan_protocol_Stats pkt{};
+    pkt.tx_frames = stats.tx_frames;
+    pkt.tx_errors = stats.tx_errors;
+    pkt.rx_frames = stats.rx_frames;
+    pkt.rx_error_oom = stats.rx_errors[CANARD_ERROR_OUT_OF_MEMORY];
+    pkt.rx_error_internal = stats.rx_errors[CANARD_ERROR_INTERNAL];
+    pkt.rx_error_missed_start = stats.rx_errors[CANARD_ERROR_RX_MISSED_START];
+    pkt.rx_error_wrong_toggle = stats.rx_errors[CANARD_ERROR_RX_WRONG_TOGGLE];
+    pkt.rx_error_short_frame = stats.rx_errors[CANARD_ERROR_RX_SHORT_FRAME];
+    pkt.rx_error_bad_crc = stats.rx_errors[CANARD_ERROR_RX_BAD_CRC];
+    pkt.rx_ignored_wrong_address = stats.rx_errors[CANARD_ERROR_RX_WRONG_ADDRESS];
+    pkt.rx_ignored_not_wanted = stats.rx_errors[CANARD_ERROR_RX_NOT_WANTED];
+    pkt.rx_ignored_unexpected_tid = stats.rx_errors[CANARD_ERROR_RX_UNEXPECTED_TID];
+    return dronecan_protocol_Stats_encode(&pkt, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                          , canardTxTransferTao(&dronecan.canard, transfer)
+#endif
+                                          );
+}
+
+static int32_t encodeCanStats(CanardPublisher *publisher, CanardTxTransfer *transfer, uint8_t *buffer, uint16_t buffer_size)
+{
+    const CanardInstanceStatistics stats = canardGetStatistics(&dronecan.canard);
+
+    dronecan_protocol_CanStats pkt{};
+    pkt.interface = 0;
+    pkt.tx_requests = stats.tx_frames_queued;
+    pkt.tx_rejected = stats.tx_errors;
+    pkt.tx_success = stats.tx_frames;
+    pkt.rx_received = stats.rx_frames;
+    pkt.rx_errors = stats.rx_errors[CANARD_ERROR_RX_INCOMPATIBLE_PACKET];
+    return dronecan_protocol_CanStats_encode(&pkt, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                             , canardTxTransferTao(&dronecan.canard, transfer)
+#endif
+                                             );
 }
 
 /*
-For this function, we need to make sure any messages we want to receive follow the following format with
-UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_ID as an example
+To publish another message, write an encode or write callback and add it to this table with its rate. When the bus
+gets congested, each message is only sent in one of every throttle_divider slots, so the diagnostics give way first.
+*/
+struct Publication
+{
+    uint64_t signature;
+    uint16_t id;
+    uint8_t priority;
+    bool coalesce;
+    uint32_t rate_hz;
+    uint8_t throttle_divider;
+    CanardPublisherEncode encode;
+    CanardPublisherWrite write;
+};
+
+static const Publication publications[] = {
+    {UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID, CANARD_TRANSFER_PRIORITY_LOW, true, 10, 2, nullptr, writeBatteryInfo},
+    {DRONECAN_PROTOCOL_STATS_SIGNATURE, DRONECAN_PROTOCOL_STATS_ID, CANARD_TRANSFER_PRIORITY_LOWEST, false, 1, 5, encodeStats, nullptr},
+    {DRONECAN_PROTOCOL_CANSTATS_SIGNATURE, DRONECAN_PROTOCOL_CANSTATS_ID, CANARD_TRANSFER_PRIORITY_LOWEST, false, 1, 5, encodeCanStats, nullptr},
+};
+
+static CanardPublisher publishers[sizeof(publications) / sizeof(publications[0])];
+static CanardScheduler scheduler;
+
+// shared by all encode callbacks, so it must hold the largest of the messages they encode
+static union
+{
+    uint8_t stats[DRONECAN_PROTOCOL_STATS_MAX_SIZE];
+    uint8_t can_stats[DRONECAN_PROTOCOL_CANSTATS_MAX_SIZE];
+} publish_buffer;
+
+/*
+To receive another message or service, add a line here following the UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_ID
+example. The library sorts this table and looks transfers up in it, so there is no switch statement to maintain.
  */
+static CanardSubscription subscriptions[] = {
+    {UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_ID, CanardTransferTypeBroadcast, UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_SIGNATURE, onMagneticFieldStrength},
+    {UAVCAN_PROTOCOL_GETTRANSPORTSTATS_ID, CanardTransferTypeRequest, UAVCAN_PROTOCOL_GETTRANSPORTSTATS_SIGNATURE, onGetTransportStats},
+};
+
+/*
+Transfers that are not in the subscriptions table end up in these two functions, which hand them to the DroneCAN
+library so it can do the boiler plate work such as parameter updates and node info.
+*/
+static void onTransferReceived(CanardInstance *ins, CanardRxTransfer *transfer)
+{
+    DroneCANonTransferReceived(dronecan, ins, transfer);
+}
+
 static bool shouldAcceptTransfer(const CanardInstance *ins,
                                  uint64_t *out_data_type_signature,
                                  uint16_t data_type_id,
@@ -48,20 +253,46 @@ static bool shouldAcceptTransfer(const CanardInstance *ins,
                                  uint8_t source_node_id)
 
 {
-    if (transfer_type == CanardTransferTypeBroadcast)
+    return DroneCANshoudlAcceptTransfer(ins, out_data_type_signature, data_type_id, transfer_type, source_node_id);
+}
+
+static uint8_t filter_node_id = CANARD_BROADCAST_NODE_ID;
+
+/*
+Multi-frame transfers are copied into this buffer before they are decoded, so decoding reads one contiguous array
+instead of walking the pool blocks. It must hold the largest payload we receive: the param GetSet requests handled by
+the DroneCAN library are the biggest, larger transfers are still received but decoded from the pool blocks.
+*/
+static uint8_t rx_payload_arena[UAVCAN_PROTOCOL_PARAM_GETSET_REQUEST_MAX_SIZE];
+
+/*
+Frames handed from loop() to the CAN TX interrupt. The interrupt refills the mailboxes from here as soon as one becomes
+free, so the bus keeps going while loop() is busy elsewhere, e.g. in the analogRead calls below.
+*/
+static CanardBxCanTxRing tx_ring;
+
+extern "C" void CAN1_TX_IRQHandler(void)
+{
+    canardBxCanServiceTxRing(&tx_ring);
+}
+
+/*
+Program the CAN hardware filters so that frames nobody wants are dropped before they raise an interrupt. The library
+works out what the DroneCAN library wants by asking shouldAcceptTransfer about every message type, so the filters
+never drop a transfer it would have taken. The filters depend on our node ID, so this runs again whenever it changes.
+*/
+static void configureAcceptanceFilters()
+{
+    CanardBxCanAcceptanceFilter filters[CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS];
+    const int16_t count = canardBxCanCompileAcceptanceFilters(&dronecan.canard,
+                                                              false,
+                                                              filters,
+                                                              CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS);
+    if (count >= 0)
     {
-        // Check if we want to handle a specific broadcast packet
-        switch (data_type_id)
-        {
-        case UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_ID:
-        {
-            *out_data_type_signature = UAVCAN_EQUIPMENT_AHRS_MAGNETICFIELDSTRENGTH_SIGNATURE;
-            return true;
-        }
-        }
+        canardBxCanConfigureAcceptanceFilters(filters, (uint8_t)count);
     }
-
-    return false || DroneCANshoudlAcceptTransfer(ins, out_data_type_signature, data_type_id, transfer_type, source_node_id);
+    filter_node_id = canardGetLocalNodeID(&dronecan.canard);
 }
 
 void setup()
@@ -70,41 +301,67 @@ void setup()
     Serial.println("Node Start");
 
     dronecan.init(onTransferReceived, shouldAcceptTransfer);
+    canardSetSubscriptions(&dronecan.canard, subscriptions, sizeof(subscriptions) / sizeof(subscriptions[0]));
+    canardSetRxPayloadArena(&dronecan.canard, rx_payload_arena, sizeof(rx_payload_arena));
+
+    // keep a quarter of the pool for reception, so a TX backlog while the bus is off cannot make us deaf to
+    // RestartNode or param.GetSet
+    const uint16_t pool_blocks = canardGetPoolAllocatorStatistics(&dronecan.canard).capacity_blocks;
+    canardSetPoolQuota(&dronecan.canard, CanardPoolConsumerTxItem, pool_blocks - pool_blocks / 4);
+    configureAcceptanceFilters();
+    canardBxCanInitTxRing(&tx_ring);
+    canardBxCanEnableTxInterrupt();
+
+    canardInitScheduler(&scheduler, (uint8_t *)&publish_buffer, sizeof(publish_buffer));
+    for (size_t i = 0; i < sizeof(publications) / sizeof(publications[0]); i++)
+    {
+        canardInitPublisher(&publishers[i]);
+        publishers[i].data_type_signature = publications[i].signature;
+        publishers[i].data_type_id = publications[i].id;
+        publishers[i].priority = publications[i].priority;
+        publishers[i].coalesce = publications[i].coalesce;
+        publishers[i].period_usec = CANARD_PUBLISHER_PERIOD_USEC(publications[i].rate_hz);
+        publishers[i].throttle_divider = publications[i].throttle_divider;
+        publishers[i].encode = publications[i].encode;
+        publishers[i].write = publications[i].write;
+        canardAddPublisher(&scheduler, &publishers[i]);
+    }
+    // throttle once frames back up behind the TX ring, i.e. the bus does not take them as fast as we queue them, back
+    // to full rate when the backlog has cleared. The acceptance filters hide most of the other nodes' traffic, so the
+    // bus load estimate only sees our own share of it; it still catches us flooding the bus ourselves
+    canardSetSchedulerQueueThrottle(&scheduler, 3 * CANARD_BXCAN_TX_RING_SIZE, CANARD_BXCAN_TX_RING_SIZE / 2);
+#if CANARD_BUS_LOAD_BUCKETS > 0
+    canardSetSchedulerThrottle(&scheduler, 700, 500);
+#endif
 
     IWatchdog.begin(2000000); // if the loop takes longer than 2 seconds, reset the system
 }
 
 void loop()
 {
-    const uint32_t now = millis();
+    const uint64_t now_usec = monotonicMicros();
+#if CANARD_BUS_LOAD_BUCKETS > 0
+    canardUpdateBusLoad(&dronecan.canard, now_usec);
+#endif
+    canardRunScheduler(&scheduler, &dronecan.canard, now_usec);
 
-    // send our battery message at 10Hz
-    if (now - looptime > 100)
+    // hand the highest priority frames to the TX interrupt before the DroneCAN library polls the mailboxes itself
+#if CANARD_ENABLE_DEADLINE
+    if (canardBxCanFillTxRing(&dronecan.canard, &tx_ring, now_usec) > 0)
+#else
+    if (canardBxCanFillTxRing(&dronecan.canard, &tx_ring) > 0)
+#endif
     {
-        looptime = millis();
-
-        // collect MCU core temperature data
-        int32_t vref = __LL_ADC_CALC_VREFANALOG_VOLTAGE(analogRead(AVREF), LL_ADC_RESOLUTION_12B);
-        int32_t cpu_temp = __LL_ADC_CALC_TEMPERATURE(vref, analogRead(ATEMP), LL_ADC_RESOLUTION_12B);
-
-        // construct dronecan packet
-        uavcan_equipment_power_BatteryInfo pkt{};
-        pkt.voltage = now / 10000;
-        pkt.temperature = cpu_temp;
-
-        // boilerplate to send a message
-        uint8_t buffer[UAVCAN_EQUIPMENT_POWER_BATTERYINFO_MAX_SIZE];
-        uint32_t len = uavcan_equipment_power_BatteryInfo_encode(&pkt, buffer);
-        static uint8_t transfer_id;
-        canardBroadcast(&dronecan.canard,
-                        UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE,
-                        UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID,
-                        &transfer_id,
-                        CANARD_TRANSFER_PRIORITY_LOW,
-                        buffer,
-                        len);
+        canardBxCanKickTxRing();
     }
 
+    // the library loads the mailboxes itself for anything left in the queue, so keep the TX interrupt out meanwhile
+    canardBxCanPauseTxRing();
     dronecan.cycle();
+    canardBxCanResumeTxRing();
+    if (canardGetLocalNodeID(&dronecan.canard) != filter_node_id)
+    {
+        configureAcceptanceFilters();
+    }
     IWatchdog.reload();
 }
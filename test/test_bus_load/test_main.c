@@ -0,0 +1,230 @@
+/*
+ * Bus load estimate: frames are counted with their worst case length on the wire, checked against bit counts worked
+ * out by hand; the load covers the last CANARD_BUS_LOAD_BUCKETS buckets, slides one bucket at a time and forgets the
+ * buckets a late call skipped; and the scheduler throttle trips at its threshold and holds until the load falls below
+ * the release threshold.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <canard_scheduler.h>
+#include <string.h>
+
+#define SIGNATURE               0x1234U
+#define DATA_TYPE_ID            1000U
+#define FRAME_BITS              160U        ///< 29-bit ID and 8 data bytes, stuff bits and interframe space included
+#define BIT_RATE                (FRAME_BITS * 1000000000ULL / (CANARD_BUS_LOAD_BUCKETS * CANARD_BUS_LOAD_BUCKET_USEC))
+#define START_USEC              1000000U
+
+#if CANARD_BUS_LOAD_BUCKETS < 5
+#error "The late call case needs a window of at least 5 buckets"
+#endif
+
+static uint8_t pool[32U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t buffer[8];
+static CanardInstance ins;
+static CanardScheduler scheduler;
+static CanardPublisher publisher;
+static uint8_t transfer_id;
+
+static bool rejectAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    return false;
+}
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, rejectAll, NULL);
+    canardSetLocalNodeID(&ins, 10);
+    canardSetBusBitRate(&ins, (uint32_t) BIT_RATE);     // One frame in the window is one permille
+    canardUpdateBusLoad(&ins, START_USEC);
+    transfer_id = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static CanardCANFrame makeFrame(bool extended, uint8_t data_len)
+{
+    CanardCANFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.id = 0x123U | (extended ? CANARD_CAN_FRAME_EFF : 0U);
+    frame.data_len = data_len;
+    return frame;
+}
+
+/// Sends single frame transfers of 8 bytes, tail byte included
+static void sendFrames(uint16_t count)
+{
+    static const uint8_t payload[7] = {0};
+    for (uint16_t i = 0; i < count; i++)
+    {
+        CanardTxTransfer transfer;
+        canardInitTxTransfer(&transfer);
+        transfer.transfer_type = CanardTransferTypeBroadcast;
+        transfer.data_type_signature = SIGNATURE;
+        transfer.data_type_id = DATA_TYPE_ID;
+        transfer.inout_transfer_id = &transfer_id;
+        transfer.payload = payload;
+        transfer.payload_len = sizeof(payload);
+#if CANARD_ENABLE_DEADLINE
+        transfer.deadline_usec = UINT64_MAX;
+#endif
+#if CANARD_MULTI_IFACE
+        transfer.iface_mask = 1U;
+#endif
+        TEST_ASSERT_EQUAL_INT16(1, canardBroadcastObj(&ins, &transfer));
+        TEST_ASSERT_EQUAL_UINT8(8, canardPeekTxQueue(&ins)->data_len);
+        canardPopTxQueue(&ins);
+    }
+}
+
+/// Receives frames of 8 bytes from another node; they are counted whether or not they are accepted
+static void receiveFrames(uint16_t count)
+{
+    const CanardCANFrame frame = makeFrame(true, 8);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        canardHandleRxFrame(&ins, &frame, START_USEC);
+    }
+}
+
+/// Advances the estimate to the end of the given bucket, counted from START_USEC
+static void closeBucket(uint32_t bucket)
+{
+    canardUpdateBusLoad(&ins, START_USEC + (uint64_t) CANARD_BUS_LOAD_BUCKET_USEC * (bucket + 1U));
+}
+
+static void assertLoad(uint16_t load_permille, uint16_t tx_load_permille)
+{
+    TEST_ASSERT_EQUAL_UINT16(load_permille, canardGetBusLoad(&ins));
+    TEST_ASSERT_EQUAL_UINT16(tx_load_permille, canardGetTxBusLoad(&ins));
+}
+
+static void testWorstCaseFrameBits(void)
+{
+    // Stuffed bits g = 34 (standard) or 54 (extended) + 8 per data byte; g + (g - 1) / 4 stuff bits + 13 more
+    TEST_ASSERT_EQUAL_UINT16(55, frameWireBits(&(CanardCANFrame) {.id = 0x123U, .data_len = 0}));
+    TEST_ASSERT_EQUAL_UINT16(135, frameWireBits(&(CanardCANFrame) {.id = 0x123U, .data_len = 8}));
+    const CanardCANFrame empty = makeFrame(true, 0);
+    const CanardCANFrame one = makeFrame(true, 1);
+    const CanardCANFrame full = makeFrame(true, 8);
+    TEST_ASSERT_EQUAL_UINT16(80, frameWireBits(&empty));
+    TEST_ASSERT_EQUAL_UINT16(90, frameWireBits(&one));
+    TEST_ASSERT_EQUAL_UINT16(FRAME_BITS, frameWireBits(&full));
+
+    // Both directions count the same length
+    sendFrames(1);
+    receiveFrames(1);
+    const CanardInstanceStatistics stats = canardGetStatistics(&ins);
+    TEST_ASSERT_EQUAL_UINT64(FRAME_BITS, stats.tx_bits);
+    TEST_ASSERT_EQUAL_UINT64(FRAME_BITS, stats.rx_bits);
+}
+
+static void testWindowSlidesOneBucketAtATime(void)
+{
+    sendFrames(100);
+    canardUpdateBusLoad(&ins, START_USEC + CANARD_BUS_LOAD_BUCKET_USEC - 1U);  // Mid-bucket calls change nothing
+    assertLoad(0, 0);
+    closeBucket(0);
+    assertLoad(100, 100);
+
+    receiveFrames(50);
+    closeBucket(1);
+    assertLoad(150, 100);
+
+    // Empty buckets follow until the first one leaves the window
+    for (uint32_t bucket = 2; bucket < CANARD_BUS_LOAD_BUCKETS; bucket++)
+    {
+        closeBucket(bucket);
+        assertLoad(150, 100);
+    }
+    closeBucket(CANARD_BUS_LOAD_BUCKETS);
+    assertLoad(50, 0);
+    closeBucket(CANARD_BUS_LOAD_BUCKETS + 1U);
+    assertLoad(0, 0);
+}
+
+static void testLateCallForgetsSkippedBuckets(void)
+{
+    sendFrames(40);
+    closeBucket(0);
+    sendFrames(20);
+
+    // Called again halfway through bucket 4: buckets 1 and 2 are empty, and the 20 frames land in bucket 3
+    canardUpdateBusLoad(&ins, START_USEC + CANARD_BUS_LOAD_BUCKET_USEC * 4U + CANARD_BUS_LOAD_BUCKET_USEC / 2U);
+    assertLoad(60, 60);
+
+    // Bucket 4 still ends on the original grid
+    sendFrames(10);
+    canardUpdateBusLoad(&ins, START_USEC + CANARD_BUS_LOAD_BUCKET_USEC * 5U - 1U);
+    assertLoad(60, 60);
+    closeBucket(4);
+    assertLoad(70, 70);
+
+    // Bucket 0 leaves the window, then bucket 3
+    closeBucket(CANARD_BUS_LOAD_BUCKETS);
+    assertLoad(30, 30);
+    closeBucket(CANARD_BUS_LOAD_BUCKETS + 3U);
+    assertLoad(10, 10);
+
+    // After more than a whole window without a call, only the frames counted since the last call are left
+    sendFrames(30);
+    closeBucket(3U * CANARD_BUS_LOAD_BUCKETS);
+    assertLoad(30, 30);
+    closeBucket(4U * CANARD_BUS_LOAD_BUCKETS - 1U);
+    assertLoad(30, 30);
+    closeBucket(4U * CANARD_BUS_LOAD_BUCKETS);
+    assertLoad(0, 0);
+}
+
+static int32_t encodeNothing(CanardPublisher* pub, CanardTxTransfer* transfer, uint8_t* out, uint16_t size)
+{
+    return -1;
+}
+
+static void testThrottleHysteresis(void)
+{
+    canardInitScheduler(&scheduler, buffer, sizeof(buffer));
+    canardInitPublisher(&publisher);
+    publisher.period_usec = CANARD_BUS_LOAD_BUCKET_USEC;
+    publisher.encode = encodeNothing;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardAddPublisher(&scheduler, &publisher));
+    canardSetSchedulerThrottle(&scheduler, 100, 50);
+
+    // Load of each step, with the state it must leave: trips at the threshold, holds down to the release threshold
+    static const struct
+    {
+        uint16_t load_permille;
+        bool throttled;
+    } steps[] = {
+        {99, false}, {100, true}, {120, true}, {50, true}, {49, false}, {99, false}, {100, true}, {0, false},
+    };
+    uint32_t bucket = 0;
+    for (uint8_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++)
+    {
+        // Replace the whole window with one bucket of the wanted load
+        for (uint32_t end = bucket + CANARD_BUS_LOAD_BUCKETS - 1U; bucket < end; bucket++)
+        {
+            closeBucket(bucket);
+        }
+        sendFrames(steps[i].load_permille);
+        closeBucket(bucket++);
+        TEST_ASSERT_EQUAL_UINT16(steps[i].load_permille, canardGetBusLoad(&ins));
+
+        canardRunScheduler(&scheduler, &ins, START_USEC + (uint64_t) CANARD_BUS_LOAD_BUCKET_USEC * bucket);
+        TEST_ASSERT_EQUAL(steps[i].throttled, scheduler.throttled);
+        TEST_ASSERT_EQUAL(steps[i].throttled, publisher.throttled);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testWorstCaseFrameBits);
+    RUN_TEST(testWindowSlidesOneBucketAtATime);
+    RUN_TEST(testLateCallForgetsSkippedBuckets);
+    RUN_TEST(testThrottleHysteresis);
+    return UNITY_END();
+}
@@ -0,0 +1,224 @@
+/*
+ * bxCAN acceptance filters compiled from the subscription table and from what the should_accept callback accepts,
+ * evaluated the way the filter banks would.
+ */
+#include <unity.h>
+#include <canard_bxcan.h>
+
+#define LOCAL_NODE_ID           42U
+#define OTHER_NODE_ID           43U
+#define REMOTE_NODE_ID          7U
+
+static uint8_t pool[32 * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static CanardBxCanAcceptanceFilter filters[CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS];
+
+static void onTransfer(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+}
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = 0;
+    return true;
+}
+
+/// Accepts services and a few scattered messages and one run of them, like a library handling its own protocol types
+static const uint16_t accepted_messages[] = {341, 1030, 1034, 1090, 2000, 2001};
+#define ACCEPTED_RUN_FIRST      20100U
+#define ACCEPTED_RUN_LAST       20130U
+
+static bool acceptSome(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                       CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = 0;
+    if (transfer_type != CanardTransferTypeBroadcast)
+    {
+        return true;
+    }
+    if ((data_type_id >= ACCEPTED_RUN_FIRST) && (data_type_id <= ACCEPTED_RUN_LAST))
+    {
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(accepted_messages) / sizeof(accepted_messages[0]); i++)
+    {
+        if (accepted_messages[i] == data_type_id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool acceptServices(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                           CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = 0;
+    return transfer_type != CanardTransferTypeBroadcast;
+}
+
+static uint32_t messageId(uint16_t data_type_id, uint8_t source_node_id)
+{
+    return CANARD_CAN_FRAME_EFF | ((uint32_t) CANARD_TRANSFER_PRIORITY_MEDIUM << 24U) |
+           ((uint32_t) data_type_id << 8U) | source_node_id;
+}
+
+static uint32_t serviceId(uint8_t data_type_id, bool request, uint8_t destination_node_id, uint8_t source_node_id)
+{
+    return CANARD_CAN_FRAME_EFF | ((uint32_t) CANARD_TRANSFER_PRIORITY_MEDIUM << 24U) |
+           ((uint32_t) data_type_id << 16U) | ((uint32_t) request << 15U) |
+           ((uint32_t) destination_node_id << 8U) | (1U << 7U) | source_node_id;
+}
+
+static bool passes(int16_t count, uint32_t can_id)
+{
+    return canardBxCanAcceptanceFiltersMatch(filters, (uint8_t) count, can_id);
+}
+
+static CanardSubscription subscriptions[] = {
+    {1010, CanardTransferTypeBroadcast, 0, onTransfer},
+    {1063, CanardTransferTypeBroadcast, 0, onTransfer},
+    {20000, CanardTransferTypeBroadcast, 0, onTransfer},
+    {1, CanardTransferTypeRequest, 0, onTransfer},
+    {5, CanardTransferTypeResponse, 0, onTransfer},
+};
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&ins, LOCAL_NODE_ID);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardSetSubscriptions(&ins, subscriptions,
+                                                              sizeof(subscriptions) / sizeof(subscriptions[0])));
+}
+
+void tearDown(void)
+{
+}
+
+void test_exact_filters_pass_only_subscribed_transfers(void)
+{
+    const int16_t count = canardBxCanCompileAcceptanceFilters(&ins, false, filters,
+                                                              CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS);
+    TEST_ASSERT_EQUAL_INT16(5, count);
+
+    TEST_ASSERT_TRUE(passes(count, messageId(1010, REMOTE_NODE_ID)));
+    TEST_ASSERT_TRUE(passes(count, messageId(1063, 127)));
+    TEST_ASSERT_TRUE(passes(count, messageId(20000, 1)));
+    TEST_ASSERT_TRUE(passes(count, serviceId(1, true, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_TRUE(passes(count, serviceId(5, false, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+
+    TEST_ASSERT_FALSE(passes(count, messageId(1011, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, serviceId(1, true, OTHER_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, serviceId(1, false, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, serviceId(5, true, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, messageId(1010, REMOTE_NODE_ID) & ~CANARD_CAN_FRAME_EFF));
+    TEST_ASSERT_FALSE(passes(count, messageId(1010, REMOTE_NODE_ID) | CANARD_CAN_FRAME_RTR));
+}
+
+void test_callback_messages_pass_and_their_neighbours_do_not(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, acceptSome, NULL);
+    canardSetLocalNodeID(&ins, LOCAL_NODE_ID);
+    const int16_t count = canardBxCanCompileAcceptanceFilters(&ins, false, filters,
+                                                              CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS);
+    // Services, four single IDs, 2000 and 2001 as one block, and 20100 to 20130 as blocks of 4, 8, 16, 2 and 1
+    TEST_ASSERT_EQUAL_INT16(11, count);
+
+    for (uint32_t data_type_id = 0; data_type_id <= 0xFFFFU; data_type_id++)
+    {
+        uint64_t signature = 0;
+        const bool wanted = acceptSome(&ins, &signature, (uint16_t) data_type_id, CanardTransferTypeBroadcast,
+                                       REMOTE_NODE_ID);
+        TEST_ASSERT_EQUAL(wanted, passes(count, messageId((uint16_t) data_type_id, REMOTE_NODE_ID)));
+    }
+    TEST_ASSERT_TRUE(passes(count, serviceId(200, true, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+}
+
+void test_callback_accepting_everything_costs_one_message_filter(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, acceptAll, NULL);
+    canardSetLocalNodeID(&ins, LOCAL_NODE_ID);
+    const int16_t count = canardBxCanCompileAcceptanceFilters(&ins, false, filters,
+                                                              CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS);
+    TEST_ASSERT_EQUAL_INT16(2, count);
+    TEST_ASSERT_TRUE(passes(count, messageId(0, REMOTE_NODE_ID)));
+    TEST_ASSERT_TRUE(passes(count, messageId(0xFFFF, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, serviceId(3, false, OTHER_NODE_ID, REMOTE_NODE_ID)));
+}
+
+void test_merged_filters_still_pass_every_wanted_transfer(void)
+{
+    ins.should_accept = acceptSome;
+    for (uint8_t max_filters = 1; max_filters <= CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS; max_filters++)
+    {
+        const int16_t count = canardBxCanCompileAcceptanceFilters(&ins, true, filters, max_filters);
+        TEST_ASSERT_GREATER_THAN(0, count);
+        TEST_ASSERT_LESS_OR_EQUAL(max_filters, count);
+
+        for (size_t i = 0; i < sizeof(subscriptions) / sizeof(subscriptions[0]); i++)
+        {
+            const CanardSubscription* const sub = &subscriptions[i];
+            const uint32_t can_id = (sub->transfer_type == CanardTransferTypeBroadcast) ?
+                messageId(sub->data_type_id, REMOTE_NODE_ID) :
+                serviceId((uint8_t) sub->data_type_id, sub->transfer_type == CanardTransferTypeRequest,
+                          LOCAL_NODE_ID, REMOTE_NODE_ID);
+            TEST_ASSERT_TRUE(passes(count, can_id));
+        }
+        for (size_t i = 0; i < sizeof(accepted_messages) / sizeof(accepted_messages[0]); i++)
+        {
+            TEST_ASSERT_TRUE(passes(count, messageId(accepted_messages[i], REMOTE_NODE_ID)));
+        }
+        for (uint16_t id = ACCEPTED_RUN_FIRST; id <= ACCEPTED_RUN_LAST; id++)
+        {
+            TEST_ASSERT_TRUE(passes(count, messageId(id, REMOTE_NODE_ID)));
+        }
+        TEST_ASSERT_TRUE(passes(count, messageId(12345, 0)));                // Anonymous
+    }
+}
+
+void test_should_accept_opens_all_services_to_this_node(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, acceptServices, NULL);
+    canardSetLocalNodeID(&ins, LOCAL_NODE_ID);
+    const int16_t count = canardBxCanCompileAcceptanceFilters(&ins, false, filters,
+                                                              CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS);
+    TEST_ASSERT_EQUAL_INT16(1, count);
+    TEST_ASSERT_TRUE(passes(count, serviceId(200, true, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_TRUE(passes(count, serviceId(3, false, LOCAL_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, serviceId(3, false, OTHER_NODE_ID, REMOTE_NODE_ID)));
+    TEST_ASSERT_FALSE(passes(count, messageId(1010, REMOTE_NODE_ID)));
+}
+
+void test_anonymous_node_gets_no_service_filters(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, acceptServices, NULL);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardSetSubscriptions(&ins, subscriptions,
+                                                              sizeof(subscriptions) / sizeof(subscriptions[0])));
+    const int16_t count = canardBxCanCompileAcceptanceFilters(&ins, false, filters,
+                                                              CANARD_BXCAN_NUM_ACCEPTANCE_FILTERS);
+    TEST_ASSERT_EQUAL_INT16(3, count);
+    TEST_ASSERT_FALSE(passes(count, serviceId(1, true, 0, REMOTE_NODE_ID)));
+}
+
+void test_empty_set_rejects_everything_and_bad_arguments_fail(void)
+{
+    TEST_ASSERT_FALSE(canardBxCanAcceptanceFiltersMatch(filters, 0, messageId(1010, REMOTE_NODE_ID)));
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT,
+                            canardBxCanCompileAcceptanceFilters(&ins, false, filters, 0));
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT,
+                            canardBxCanCompileAcceptanceFilters(&ins, false, NULL, 4));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_exact_filters_pass_only_subscribed_transfers);
+    RUN_TEST(test_callback_messages_pass_and_their_neighbours_do_not);
+    RUN_TEST(test_callback_accepting_everything_costs_one_message_filter);
+    RUN_TEST(test_merged_filters_still_pass_every_wanted_transfer);
+    RUN_TEST(test_should_accept_opens_all_services_to_this_node);
+    RUN_TEST(test_anonymous_node_gets_no_service_filters);
+    RUN_TEST(test_empty_set_rejects_everything_and_bad_arguments_fail);
+    return UNITY_END();
+}
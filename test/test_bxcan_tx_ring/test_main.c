@@ -0,0 +1,193 @@
+/*
+ * bxCAN TX ring: the main context fills the ring from the libcanard TX queue while a second thread stands in for the
+ * TX interrupt and drains it. Every transfer must come out whole and in order on a receiving instance, and the ring
+ * must hand over the highest priority frames first and never more than it holds.
+ */
+#include <unity.h>
+#include <canard_bxcan.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_TRANSFERS           5000U
+#define NUM_DATA_TYPES          8U
+#define MAX_PAYLOAD             100U
+#define MAX_FRAMES              (NUM_TRANSFERS * ((MAX_PAYLOAD + 2U) / 7U + 1U))
+#define SIGNATURE               0x1234U
+
+static uint8_t tx_pool[2000U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[2000U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx;
+static CanardBxCanTxRing ring;
+
+static CanardCANFrame sent_frames[MAX_FRAMES];
+static uint32_t num_sent_frames;
+static int producer_done;
+static uint32_t received;
+static uint32_t corrupted;
+
+static void onTransfer(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    uint8_t payload[MAX_PAYLOAD];
+    for (uint16_t i = 0; i < transfer->payload_len; i++)
+    {
+        canardDecodeScalar(transfer, i * 8U, 8, false, &payload[i]);
+    }
+    bool intact = (transfer->payload_len >= 2U) && (payload[1] == transfer->payload_len);
+    for (uint16_t i = 2; i < transfer->payload_len; i++)
+    {
+        intact = intact && (payload[i] == (uint8_t)(payload[0] + i));
+    }
+    received++;
+    corrupted += intact ? 0U : 1U;
+}
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return true;
+}
+
+/// Stands in for CAN1_TX_IRQHandler(): takes frames off the ring as the mailboxes would
+static void* interruptThread(void* arg)
+{
+    for (;;)
+    {
+        const CanardCANFrame* const frame = canardBxCanPeekTxRing(&ring);
+        if (frame != NULL)
+        {
+            sent_frames[num_sent_frames++] = *frame;
+            canardBxCanPopTxRing(&ring);
+        }
+        else if (__atomic_load_n(&producer_done, __ATOMIC_ACQUIRE) && (canardBxCanPeekTxRing(&ring) == NULL))
+        {
+            break;
+        }
+        else
+        {
+            sched_yield();                                                  // The host may have a single core
+        }
+    }
+    return NULL;
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 5);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onTransfer, acceptAll, NULL);
+    canardSetLocalNodeID(&rx, 9);
+    canardBxCanInitTxRing(&ring);
+    num_sent_frames = 0;
+    producer_done = 0;
+    received = 0;
+    corrupted = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static uint16_t fillRing(void)
+{
+#if CANARD_ENABLE_DEADLINE
+    return canardBxCanFillTxRing(&tx, &ring, 0);
+#else
+    return canardBxCanFillTxRing(&tx, &ring);
+#endif
+}
+
+static void testProducerAndInterrupt(void)
+{
+    uint8_t transfer_ids[NUM_DATA_TYPES] = {0};
+    uint8_t payload[MAX_PAYLOAD];
+    uint32_t published = 0;
+    srand(7);
+
+    pthread_t thread;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, interruptThread, NULL));
+    for (uint32_t i = 0; i < NUM_TRANSFERS; i++)
+    {
+        const uint8_t data_type = (uint8_t)(rand() % NUM_DATA_TYPES);
+        const uint16_t len = (uint16_t)(2 + (rand() % (MAX_PAYLOAD - 1U)));
+        payload[0] = (uint8_t) rand();
+        payload[1] = (uint8_t) len;
+        for (uint16_t k = 2; k < len; k++)
+        {
+            payload[k] = (uint8_t)(payload[0] + k);
+        }
+        if (canardBroadcast(&tx, SIGNATURE, (uint16_t)(100U + data_type), &transfer_ids[data_type],
+                            (uint8_t)(data_type * 3U), payload, len) > 0)
+        {
+            published++;
+        }
+        // Keep a backlog in the TX queue, so that the ring is refilled while the other thread drains it
+        do
+        {
+            if (fillRing() == 0)
+            {
+                sched_yield();
+            }
+        } while (tx.allocator.statistics.current_usage_blocks > 200U);
+    }
+    while (canardPeekTxQueue(&tx) != NULL)
+    {
+        if (fillRing() == 0)
+        {
+            sched_yield();
+        }
+    }
+    __atomic_store_n(&producer_done, 1, __ATOMIC_RELEASE);
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(thread, NULL));
+
+    for (uint32_t i = 0; i < num_sent_frames; i++)
+    {
+        canardHandleRxFrame(&rx, &sent_frames[i], 1000U + i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(NUM_TRANSFERS, published);
+    TEST_ASSERT_EQUAL_UINT32(published, received);
+    TEST_ASSERT_EQUAL_UINT32(0, corrupted);
+    TEST_ASSERT_EQUAL_UINT32(ring.head, ring.tail);
+}
+
+static void testFillOrderAndLimit(void)
+{
+    uint8_t transfer_ids[3] = {0};
+    const uint8_t payload[7] = {0};
+
+    // More single-frame transfers than the ring holds, lowest priority first
+    for (uint8_t i = 0; i < CANARD_BXCAN_TX_RING_SIZE; i++)
+    {
+        for (uint8_t p = 0; p < 3; p++)
+        {
+            canardBroadcast(&tx, SIGNATURE, (uint16_t)(100U + p), &transfer_ids[p],
+                            (uint8_t)(CANARD_TRANSFER_PRIORITY_LOWEST - (p * 8U)), payload, sizeof(payload));
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(CANARD_BXCAN_TX_RING_SIZE, fillRing());
+    TEST_ASSERT_EQUAL_UINT16(0, fillRing());                                // Full until the interrupt takes some
+
+    // The ring got the highest priority frames, and the queue kept the rest
+    for (uint8_t i = 0; i < CANARD_BXCAN_TX_RING_SIZE; i++)
+    {
+        const CanardCANFrame* const frame = canardBxCanPeekTxRing(&ring);
+        TEST_ASSERT_NOT_NULL(frame);
+        TEST_ASSERT_EQUAL_UINT32(102U, (frame->id >> 8U) & 0xFFFFU);
+        canardBxCanPopTxRing(&ring);
+    }
+    TEST_ASSERT_NULL(canardBxCanPeekTxRing(&ring));
+    TEST_ASSERT_EQUAL_UINT32(101U, (canardPeekTxQueue(&tx)->id >> 8U) & 0xFFFFU);
+    TEST_ASSERT_EQUAL_UINT16(CANARD_BXCAN_TX_RING_SIZE, fillRing());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testProducerAndInterrupt);
+    RUN_TEST(testFillOrderAndLimit);
+    return UNITY_END();
+}
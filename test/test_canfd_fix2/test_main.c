@@ -0,0 +1,264 @@
+/*
+ * uavcan.equipment.gnss.Fix2 with full covariance, published over a simulated bus through CanardDriver, once in
+ * classic CAN frames and once in CAN FD frames. Every transfer must decode to what was sent, FD must need fewer frames
+ * and less bus time, and a controller without FD support must drop FD frames instead of sending them.
+ */
+#include <unity.h>
+#include <canard_driver.h>
+#include <uavcan.equipment.gnss.Fix2.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_TRANSFERS           1000U
+#define BUS_QUEUE_SIZE          256U
+#define NOMINAL_BITRATE         1000000.0
+#define DATA_BITRATE            4000000.0
+
+/// One CAN bus with its controller; frames sent on it are received back in order, stamped with the bus time
+typedef struct
+{
+    CanardDriver driver;
+    CanardCANFrame frames[BUS_QUEUE_SIZE];
+    uint64_t timestamps_usec[BUS_QUEUE_SIZE];
+    uint16_t head;
+    uint16_t tail;
+    double busy_usec;                       ///< Total time the bus spent transmitting
+} SimBus;
+
+typedef struct
+{
+    uint32_t frames;
+    double bus_usec;
+    double latency_usec;
+} BusResult;
+
+static uint8_t tx_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx;
+static struct uavcan_equipment_gnss_Fix2 sent;
+static uint32_t received;
+static uint32_t mismatched;
+static uint64_t last_timestamp_usec;
+
+/// Time a frame occupies the bus, stuff bits included; FD frames switch to the data bit rate after arbitration
+static double frameUsec(const CanardCANFrame* frame)
+{
+    const uint32_t data_bits = 8U * frame->data_len;
+#if CANARD_ENABLE_CANFD
+    if (frame->canfd)
+    {
+        const uint32_t arbitration = 1U + 11U + 1U + 1U + 18U + 1U + 1U + 1U + 1U;      // SOF to BRS
+        const uint32_t crc = (frame->data_len > 16U) ? 21U : 17U;
+        const uint32_t data = 1U + 4U + data_bits;                                      // ESI, DLC, data
+        const uint32_t fast = data + data / 4U + 4U + crc + (4U + crc) / 4U + 1U;       // To the CRC delimiter
+        const uint32_t slow = arbitration + (arbitration - 1U) / 4U + 2U + 7U + 3U;     // Then ACK, EOF, IFS
+        return (slow / NOMINAL_BITRATE + fast / DATA_BITRATE) * 1e6;
+    }
+#endif
+    const uint32_t stuffed = 54U + data_bits;
+    return (stuffed + (stuffed - 1U) / 4U + 13U) / NOMINAL_BITRATE * 1e6;
+}
+
+static int16_t simTransmit(CanardDriver* driver, const CanardCANFrame* frame)
+{
+    SimBus* const bus = (SimBus*) driver->user_reference;
+    const uint16_t next = (uint16_t)((bus->head + 1U) % BUS_QUEUE_SIZE);
+    if (next == bus->tail)
+    {
+        return 0;
+    }
+    bus->busy_usec += frameUsec(frame);
+    bus->frames[bus->head] = *frame;
+    bus->timestamps_usec[bus->head] = (uint64_t) bus->busy_usec;
+    bus->head = next;
+    return 1;
+}
+
+static int16_t simReceive(CanardDriver* driver, CanardCANFrame* out_frame, uint64_t* out_timestamp_usec)
+{
+    SimBus* const bus = (SimBus*) driver->user_reference;
+    if (bus->head == bus->tail)
+    {
+        return 0;
+    }
+    *out_frame = bus->frames[bus->tail];
+    *out_timestamp_usec = bus->timestamps_usec[bus->tail];
+    bus->tail = (uint16_t)((bus->tail + 1U) % BUS_QUEUE_SIZE);
+    return 1;
+}
+
+static void initBus(SimBus* bus, bool canfd)
+{
+    memset(bus, 0, sizeof(*bus));
+    bus->driver.transmit = simTransmit;
+    bus->driver.receive = simReceive;
+    bus->driver.canfd = canfd;
+    bus->driver.user_reference = bus;
+}
+
+static uint16_t transmit(SimBus* bus)
+{
+#if CANARD_ENABLE_DEADLINE
+    return canardDriverTransmit(&tx, &bus->driver, 0);
+#else
+    return canardDriverTransmit(&tx, &bus->driver);
+#endif
+}
+
+static void onTransfer(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    struct uavcan_equipment_gnss_Fix2 msg;
+    memset(&msg, 0, sizeof(msg));
+    received++;
+    last_timestamp_usec = transfer->timestamp_usec;
+    if (uavcan_equipment_gnss_Fix2_decode(transfer, &msg) ||
+        (msg.longitude_deg_1e8 != sent.longitude_deg_1e8) ||
+        (msg.covariance.len != sent.covariance.len) ||
+        (memcmp(msg.covariance.data, sent.covariance.data, sizeof(float) * sent.covariance.len) != 0) ||
+        (msg.ecef_position_velocity.len != sent.ecef_position_velocity.len) ||
+        (msg.ecef_position_velocity.data[0].covariance.len != sent.ecef_position_velocity.data[0].covariance.len) ||
+        (memcmp(msg.ecef_position_velocity.data[0].covariance.data, sent.ecef_position_velocity.data[0].covariance.data,
+                sizeof(float) * sent.ecef_position_velocity.data[0].covariance.len) != 0))
+    {
+        mismatched++;
+    }
+}
+
+static bool acceptFix2(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                       CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    if (data_type_id != UAVCAN_EQUIPMENT_GNSS_FIX2_ID)
+    {
+        return false;
+    }
+    *out_signature = UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE;
+    return true;
+}
+
+/// Fresh instances on both ends and the message to send
+static void initNodes(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 5);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onTransfer, acceptFix2, NULL);
+    canardSetLocalNodeID(&rx, 6);
+
+    memset(&sent, 0, sizeof(sent));
+    sent.longitude_deg_1e8 = 12345678901LL;
+    sent.covariance.len = 36;
+    for (uint8_t i = 0; i < 36U; i++)
+    {
+        sent.covariance.data[i] = (float) i * 1.5F;
+    }
+    sent.ecef_position_velocity.len = 1;
+    sent.ecef_position_velocity.data[0].covariance.len = 36;
+    for (uint8_t i = 0; i < 36U; i++)
+    {
+        sent.ecef_position_velocity.data[0].covariance.data[i] = (float) i;
+    }
+    received = 0;
+    mismatched = 0;
+}
+
+void setUp(void)
+{
+    initNodes();
+}
+
+void tearDown(void)
+{
+}
+
+/// Publishes NUM_TRANSFERS Fix2 messages one after another on an idle bus and averages what each one cost
+static BusResult publishFix2(bool canfd)
+{
+    SimBus bus;
+    initBus(&bus, true);
+    uint8_t transfer_id = 0;
+    BusResult result = {0, 0.0, 0.0};
+
+    for (uint32_t i = 0; i < NUM_TRANSFERS; i++)
+    {
+        sent.longitude_deg_1e8++;
+        uint8_t buffer[UAVCAN_EQUIPMENT_GNSS_FIX2_MAX_SIZE];
+        CanardTxTransfer transfer;
+        canardInitTxTransfer(&transfer);
+        transfer.transfer_type = CanardTransferTypeBroadcast;
+        transfer.data_type_signature = UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE;
+        transfer.data_type_id = UAVCAN_EQUIPMENT_GNSS_FIX2_ID;
+        transfer.inout_transfer_id = &transfer_id;
+        transfer.priority = CANARD_TRANSFER_PRIORITY_MEDIUM;
+        transfer.canfd = canfd;
+        transfer.payload = buffer;
+        transfer.payload_len = (uint16_t) uavcan_equipment_gnss_Fix2_encode(&sent, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                                                          , canardTxTransferTao(&tx, &transfer)
+#endif
+                                                                          );
+
+        const double start_usec = bus.busy_usec;
+        const int16_t frames = canardBroadcastObj(&tx, &transfer);
+        TEST_ASSERT_TRUE(frames > 0);
+        result.frames += (uint32_t) frames;
+        TEST_ASSERT_EQUAL_UINT16(frames, transmit(&bus));
+        TEST_ASSERT_EQUAL_INT16(frames, canardDriverReceive(&rx, &bus.driver, BUS_QUEUE_SIZE));
+        result.bus_usec += bus.busy_usec - start_usec;
+        result.latency_usec += (double) last_timestamp_usec - start_usec;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, bus.driver.tx_dropped);
+    TEST_ASSERT_EQUAL_UINT32(NUM_TRANSFERS, received);
+    TEST_ASSERT_EQUAL_UINT32(0, mismatched);
+    return result;
+}
+
+static void testFix2ClassicVersusFd(void)
+{
+    const BusResult classic = publishFix2(false);
+    initNodes();
+    const BusResult fd = publishFix2(true);
+
+    TEST_ASSERT_TRUE(fd.frames * 4U < classic.frames);
+    TEST_ASSERT_TRUE(fd.bus_usec * 2.0 < classic.bus_usec);
+
+    char message[160];
+    snprintf(message, sizeof(message), "Fix2, classic 1 Mbit/s: %.1f frames, %.0f us on the bus, %.0f us latency",
+             (double) classic.frames / NUM_TRANSFERS, classic.bus_usec / NUM_TRANSFERS,
+             classic.latency_usec / NUM_TRANSFERS);
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Fix2, CAN FD 1/4 Mbit/s: %.1f frames, %.0f us on the bus, %.0f us latency",
+             (double) fd.frames / NUM_TRANSFERS, fd.bus_usec / NUM_TRANSFERS, fd.latency_usec / NUM_TRANSFERS);
+    TEST_MESSAGE(message);
+}
+
+static void testClassicControllerDropsFdFrames(void)
+{
+    SimBus bus;
+    initBus(&bus, false);
+    uint8_t transfer_id = 0;
+    const uint8_t payload[100] = {0};
+
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.data_type_signature = UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE;
+    transfer.data_type_id = UAVCAN_EQUIPMENT_GNSS_FIX2_ID;
+    transfer.inout_transfer_id = &transfer_id;
+    transfer.canfd = true;
+    transfer.payload = payload;
+    transfer.payload_len = sizeof(payload);
+    const int16_t frames = canardBroadcastObj(&tx, &transfer);
+    TEST_ASSERT_TRUE(frames > 0);
+
+    TEST_ASSERT_EQUAL_UINT16(0, transmit(&bus));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t) frames, bus.driver.tx_dropped);
+    TEST_ASSERT_NULL(canardPeekTxQueue(&tx));
+    TEST_ASSERT_EQUAL_INT16(0, canardDriverReceive(&rx, &bus.driver, BUS_QUEUE_SIZE));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testFix2ClassicVersusFd);
+    RUN_TEST(testClassicControllerDropsFdFrames);
+    return UNITY_END();
+}
@@ -0,0 +1,160 @@
+/*
+ * Transfer CRC: the engine selected with CANARD_CRC_IMPLEMENTATION matches a bit by bit reference, whatever the length
+ * and alignment of the data, and its speed is printed. Signature seeds are right whether they come from the cache, from
+ * a slot another signature took over, or with the cache disabled. The native_crc_* environments run this against the
+ * other engines and without the cache.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BENCHMARK_PAYLOAD_LEN   222U
+#define BENCHMARK_ROUNDS        20000U
+
+static const char* const EngineNames[] = {"bitwise", "table", "nibble"};
+
+/// CRC-16-CCITT, polynomial 0x1021, one bit at a time
+static uint16_t referenceCrc(uint16_t crc, const uint8_t* bytes, size_t len)
+{
+    while (len-- > 0)
+    {
+        crc ^= (uint16_t)((uint16_t)(*bytes++) << 8U);
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000U) ? (uint16_t)((uint16_t)(crc << 1U) ^ 0x1021U) : (uint16_t)(crc << 1U);
+        }
+    }
+    return crc;
+}
+
+static void fillPseudoRandom(uint8_t* bytes, size_t len, uint32_t seed)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        seed = seed * 1103515245UL + 12345UL;
+        bytes[i] = (uint8_t)(seed >> 16U);
+    }
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_check_value(void)
+{
+    static const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, crcAdd(0xFFFF, check, sizeof(check)));          // CRC-16/CCITT-FALSE
+}
+
+void test_matches_reference_for_any_length_and_alignment(void)
+{
+    uint8_t data[300];
+    fillPseudoRandom(data, sizeof(data), 1);
+    for (size_t offset = 0; offset < 8; offset++)
+    {
+        for (size_t len = 0; len + offset <= sizeof(data); len++)
+        {
+            TEST_ASSERT_EQUAL_HEX16(referenceCrc(0xFFFF, &data[offset], len), crcAdd(0xFFFF, &data[offset], len));
+        }
+    }
+}
+
+void test_byte_and_block_updates_agree(void)
+{
+    uint8_t data[64];
+    fillPseudoRandom(data, sizeof(data), 2);
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        crc = crcAddByte(crc, data[i]);
+    }
+    TEST_ASSERT_EQUAL_HEX16(crcAdd(0xFFFF, data, sizeof(data)), crc);
+}
+
+void test_signature_seed_is_little_endian_signature(void)
+{
+    const uint64_t signature = 0x8A2B6E3F1C4D5E6FULL;
+    uint8_t bytes[8];
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        bytes[i] = (uint8_t)(signature >> (8U * i));
+    }
+    TEST_ASSERT_EQUAL_HEX16(referenceCrc(0xFFFF, bytes, sizeof(bytes)), crcAddSignature(0xFFFF, signature));
+}
+
+void test_signature_seed_cache_slot_collisions(void)
+{
+    // Two pairs that fold to the same slot, and zero, which marks an empty slot and is never cached
+    static const uint64_t signatures[] = {0x0000000000000001ULL, 0x0000000100000000ULL, 0,
+                                          0x5A5A5A5A00000000ULL, 0x000000005A5A5A5AULL};
+    static uint8_t pool[16U * CANARD_MEM_BLOCK_SIZE];
+    CanardInstance ins;
+    canardInit(&ins, pool, sizeof(pool), NULL, NULL, NULL);
+
+    for (uint8_t round = 0; round < 3; round++)
+    {
+        for (uint8_t i = 0; i < sizeof(signatures) / sizeof(signatures[0]); i++)
+        {
+            TEST_ASSERT_EQUAL_HEX16(crcAddSignature(0xFFFF, signatures[i]), crcSignatureSeed(&ins, signatures[i]));
+            TEST_ASSERT_EQUAL_HEX16(crcAddSignature(0xFFFF, signatures[i]), crcSignatureSeed(&ins, signatures[i]));
+        }
+    }
+#if CANARD_SIGNATURE_CRC_CACHE_SIZE > 0
+    // The last signature folding to a slot owns it
+    TEST_ASSERT_EQUAL_HEX64(0x0000000100000000ULL, ins.signature_crc_cache[1].data_type_signature);
+    TEST_ASSERT_EQUAL_HEX64(0x000000005A5A5A5AULL,
+                            ins.signature_crc_cache[0x5A5A5A5AU & (CANARD_SIGNATURE_CRC_CACHE_SIZE - 1U)]
+                                .data_type_signature);
+#endif
+}
+
+void test_benchmark_ns_per_byte(void)
+{
+    uint8_t payload[BENCHMARK_PAYLOAD_LEN];
+    fillPseudoRandom(payload, sizeof(payload), 3);
+
+    volatile uint16_t sink = 0;
+    double start = nowSeconds();
+    for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        sink ^= crcAdd((uint16_t) round, payload, sizeof(payload));
+    }
+    const double engine_ns = (nowSeconds() - start) * 1e9 / ((double) BENCHMARK_ROUNDS * sizeof(payload));
+
+    start = nowSeconds();
+    for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        sink ^= referenceCrc((uint16_t) round, payload, sizeof(payload));
+    }
+    const double reference_ns = (nowSeconds() - start) * 1e9 / ((double) BENCHMARK_ROUNDS * sizeof(payload));
+
+    char message[128];
+    snprintf(message, sizeof(message), "%s engine: %.2f ns per byte, bit by bit reference %.2f ns per byte (%u-byte payload)",
+             EngineNames[CANARD_CRC_IMPLEMENTATION], engine_ns, reference_ns, (unsigned) BENCHMARK_PAYLOAD_LEN);
+    TEST_MESSAGE(message);
+    (void) sink;
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_check_value);
+    RUN_TEST(test_matches_reference_for_any_length_and_alignment);
+    RUN_TEST(test_byte_and_block_updates_agree);
+    RUN_TEST(test_signature_seed_is_little_endian_signature);
+    RUN_TEST(test_signature_seed_cache_slot_collisions);
+    RUN_TEST(test_benchmark_ns_per_byte);
+    return UNITY_END();
+}
@@ -0,0 +1,283 @@
+/*
+ * Redundant interfaces: a node publishes one 4-frame transfer per millisecond on two simulated buses, and a receiver
+ * listens on both through CanardDriver. The receiver must stay on its interface while that one is healthy, even if
+ * the other is faster now and then; must move to the other interface within the quiet timeout when its own fails;
+ * and must move back once the failed one has recovered and the other fails in turn. No transfer may be delivered
+ * twice, and a stuck TX queue must not hold up the other interface.
+ */
+#include <unity.h>
+#include <canard_driver.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_IFACES              2U
+#define FRAME_USEC              160U
+#define STEP_USEC               20U
+#define PERIOD_USEC             1000U
+#define PAYLOAD_LEN             20U
+#define BUS_QUEUE_SIZE          1024U
+#define MAX_TRANSFERS           4000U
+#define SIGNATURE               0x1234U
+#define QUIET_TIMEOUT_USEC      10000U      // IFACE_QUIET_TIMEOUT_USEC in canard.c
+#define MAX_LOST_PER_FAILURE    (QUIET_TIMEOUT_USEC / PERIOD_USEC + 2U)
+
+/// One CAN bus with its controller; a frame reaches the receiver FRAME_USEC after the bus took it, plus the latency
+typedef struct
+{
+    CanardDriver driver;
+    CanardCANFrame frames[BUS_QUEUE_SIZE];
+    uint64_t arrival_usec[BUS_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint64_t busy_until_usec;
+    uint64_t fail_from_usec;                ///< The bus takes and delivers nothing from here...
+    uint64_t fail_until_usec;               ///< ...until here
+    uint32_t latency_usec;                  ///< Extra latency, switched on and off every 'latency_period_usec'
+    uint32_t latency_period_usec;
+} SimBus;
+
+static uint8_t tx_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx;
+static SimBus buses[NUM_IFACES];
+static CanardDriver rx_drivers[NUM_IFACES];
+static uint64_t now_usec;
+
+static uint64_t published_usec[MAX_TRANSFERS];
+static uint8_t deliveries[MAX_TRANSFERS];
+static uint32_t num_published;
+static uint32_t malformed;
+static bool any_delivered;
+static uint8_t delivering_iface;            ///< Interface the last transfer came from
+static uint32_t iface_switches;
+static uint64_t max_latency_usec;           ///< Of transfers published after 'latency_from_usec'
+static uint64_t latency_from_usec;
+
+static bool busFailed(const SimBus* bus)
+{
+    return (now_usec >= bus->fail_from_usec) && (now_usec < bus->fail_until_usec);
+}
+
+static int16_t simTransmit(CanardDriver* driver, const CanardCANFrame* frame)
+{
+    SimBus* const bus = (SimBus*) driver->user_reference;
+    if (busFailed(bus) || (now_usec < bus->busy_until_usec) || ((bus->head - bus->tail) == BUS_QUEUE_SIZE))
+    {
+        return 0;
+    }
+    uint64_t arrival_usec = now_usec + FRAME_USEC;
+    if ((bus->latency_period_usec > 0U) && (((now_usec / bus->latency_period_usec) % 2U) == 1U))
+    {
+        arrival_usec += bus->latency_usec;
+    }
+    if ((bus->head != bus->tail) && (arrival_usec < bus->arrival_usec[(bus->head - 1U) % BUS_QUEUE_SIZE]))
+    {
+        arrival_usec = bus->arrival_usec[(bus->head - 1U) % BUS_QUEUE_SIZE];   // A bus does not reorder frames
+    }
+    bus->busy_until_usec = now_usec + FRAME_USEC;
+    bus->frames[bus->head % BUS_QUEUE_SIZE] = *frame;
+    bus->arrival_usec[bus->head % BUS_QUEUE_SIZE] = arrival_usec;
+    bus->head++;
+    return 1;
+}
+
+static int16_t simReceive(CanardDriver* driver, CanardCANFrame* out_frame, uint64_t* out_timestamp_usec)
+{
+    SimBus* const bus = (SimBus*) driver->user_reference;
+    if (busFailed(bus))
+    {
+        bus->tail = bus->head;                                              // Whatever was on the wire is lost
+        return 0;
+    }
+    if ((bus->head == bus->tail) || (bus->arrival_usec[bus->tail % BUS_QUEUE_SIZE] > now_usec))
+    {
+        return 0;
+    }
+    *out_frame = bus->frames[bus->tail % BUS_QUEUE_SIZE];
+    *out_timestamp_usec = now_usec;
+    bus->tail++;
+    return 1;
+}
+
+static void onTransfer(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    uint8_t payload[4];
+    for (uint8_t i = 0; i < sizeof(payload); i++)
+    {
+        canardDecodeScalar(transfer, i * 8U, 8, false, &payload[i]);
+    }
+    const uint32_t seq = payload[0] | ((uint32_t) payload[1] << 8U) | ((uint32_t) payload[2] << 16U) |
+                         ((uint32_t) payload[3] << 24U);
+    if ((transfer->payload_len != PAYLOAD_LEN) || (seq >= num_published))
+    {
+        malformed++;
+        return;
+    }
+    if (any_delivered && (transfer->iface_id != delivering_iface))
+    {
+        iface_switches++;
+    }
+    any_delivered = true;
+    delivering_iface = transfer->iface_id;
+    deliveries[seq]++;
+    if ((published_usec[seq] >= latency_from_usec) && ((now_usec - published_usec[seq]) > max_latency_usec))
+    {
+        max_latency_usec = now_usec - published_usec[seq];
+    }
+}
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return true;
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 5);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onTransfer, acceptAll, NULL);
+    canardSetLocalNodeID(&rx, 9);
+    memset(buses, 0, sizeof(buses));
+    memset(rx_drivers, 0, sizeof(rx_drivers));
+    for (uint8_t i = 0; i < NUM_IFACES; i++)
+    {
+        buses[i].driver.transmit = simTransmit;
+        buses[i].driver.iface_id = i;
+        buses[i].driver.user_reference = &buses[i];
+        rx_drivers[i].receive = simReceive;
+        rx_drivers[i].iface_id = i;
+        rx_drivers[i].user_reference = &buses[i];
+    }
+    memset(deliveries, 0, sizeof(deliveries));
+    num_published = 0;
+    malformed = 0;
+    any_delivered = false;
+    iface_switches = 0;
+    max_latency_usec = 0;
+    latency_from_usec = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/// Runs the buses until 'end_usec', publishing one transfer every PERIOD_USEC on both interfaces
+static void run(uint64_t end_usec)
+{
+    uint8_t transfer_id = 0;
+    for (now_usec = STEP_USEC; now_usec < end_usec; now_usec += STEP_USEC)
+    {
+        if ((now_usec % PERIOD_USEC) == 0U)
+        {
+            TEST_ASSERT_TRUE(num_published < MAX_TRANSFERS);
+            uint8_t payload[PAYLOAD_LEN] = {0};
+            payload[0] = (uint8_t) num_published;
+            payload[1] = (uint8_t)(num_published >> 8U);
+            CanardTxTransfer transfer;
+            canardInitTxTransfer(&transfer);
+            transfer.data_type_signature = SIGNATURE;
+            transfer.data_type_id = 100;
+            transfer.inout_transfer_id = &transfer_id;
+            transfer.priority = CANARD_TRANSFER_PRIORITY_MEDIUM;
+            transfer.iface_mask = (uint8_t)((1U << NUM_IFACES) - 1U);
+            transfer.payload = payload;
+            transfer.payload_len = PAYLOAD_LEN;
+#if CANARD_ENABLE_DEADLINE
+            transfer.deadline_usec = now_usec + 1000000U;
+#endif
+            published_usec[num_published++] = now_usec;
+            TEST_ASSERT_EQUAL_INT16(4, canardBroadcastObj(&tx, &transfer));   // A stuck queue holds up nothing
+        }
+        for (uint8_t i = 0; i < NUM_IFACES; i++)
+        {
+#if CANARD_ENABLE_DEADLINE
+            canardDriverTransmit(&tx, &buses[i].driver, now_usec);
+#else
+            canardDriverTransmit(&tx, &buses[i].driver);
+#endif
+        }
+        for (uint8_t i = 0; i < NUM_IFACES; i++)
+        {
+            canardDriverReceive(&rx, &rx_drivers[i], BUS_QUEUE_SIZE);
+        }
+    }
+}
+
+/// Counts the transfers published before 'end_usec' that never arrived, and checks that none arrived twice
+static uint32_t lostBefore(uint64_t end_usec)
+{
+    uint32_t lost = 0;
+    for (uint32_t seq = 0; seq < num_published; seq++)
+    {
+        TEST_ASSERT_TRUE(deliveries[seq] <= 1U);
+        lost += ((published_usec[seq] < end_usec) && (deliveries[seq] == 0U)) ? 1U : 0U;
+    }
+    return lost;
+}
+
+static void testHealthyInterfacesAreNotSwitched(void)
+{
+    // Interface 1 is now and then slower than interface 0, but never quiet for long
+    buses[1].latency_usec = 3000U;
+    buses[1].latency_period_usec = 50000U;
+    run(2000000U);
+
+    TEST_ASSERT_EQUAL_UINT32(0, malformed);
+    TEST_ASSERT_EQUAL_UINT32(0, lostBefore(1990000U));
+    TEST_ASSERT_EQUAL_UINT32(0, iface_switches);
+}
+
+static void testFailover(void)
+{
+    buses[0].fail_from_usec = 1000000U;
+    buses[0].fail_until_usec = UINT64_MAX;
+    latency_from_usec = 1000000U + QUIET_TIMEOUT_USEC + PERIOD_USEC;
+    run(2000000U);
+
+    const uint32_t lost = lostBefore(1990000U);
+    TEST_ASSERT_EQUAL_UINT32(0, malformed);
+    TEST_ASSERT_TRUE(lost <= MAX_LOST_PER_FAILURE);
+    TEST_ASSERT_EQUAL_UINT32(1, iface_switches);
+    TEST_ASSERT_TRUE(max_latency_usec < PERIOD_USEC);
+    TEST_ASSERT_TRUE(tx.statistics.tx_iface_refused[0] > 0U);
+    TEST_ASSERT_EQUAL_UINT32(0, tx.statistics.tx_iface_refused[1]);
+
+    char message[100];
+    snprintf(message, sizeof(message), "Interface 0 failed: %u transfers lost, then %u us latency on interface 1",
+             (unsigned) lost, (unsigned) max_latency_usec);
+    TEST_MESSAGE(message);
+}
+
+static void testRecoveredInterfaceTakesOverAgain(void)
+{
+    // Interface 0 fails and comes back with its stale TX backlog, then interface 1 fails for good
+    buses[0].fail_from_usec = 1000000U;
+    buses[0].fail_until_usec = 2000000U;
+    buses[1].fail_from_usec = 3000000U;
+    buses[1].fail_until_usec = UINT64_MAX;
+    latency_from_usec = 3000000U + QUIET_TIMEOUT_USEC + PERIOD_USEC;
+    run(4000000U);
+
+    const uint32_t lost = lostBefore(3990000U);
+    TEST_ASSERT_EQUAL_UINT32(0, malformed);
+    TEST_ASSERT_TRUE(lost <= 2U * MAX_LOST_PER_FAILURE);
+    TEST_ASSERT_EQUAL_UINT32(2, iface_switches);
+    TEST_ASSERT_TRUE(max_latency_usec < PERIOD_USEC);
+
+    char message[100];
+    snprintf(message, sizeof(message), "Both interfaces failed in turn: %u transfers lost, then %u us latency",
+             (unsigned) lost, (unsigned) max_latency_usec);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testHealthyInterfacesAreNotSwitched);
+    RUN_TEST(testFailover);
+    RUN_TEST(testRecoveredInterfaceTakesOverAgain);
+    return UNITY_END();
+}
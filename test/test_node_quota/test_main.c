@@ -0,0 +1,151 @@
+/*
+ * Per-node block quota: in a 60-block pool, node 66 starts 40 transfers and never finishes them while node 10 sends
+ * 5 ordinary ones. Without a quota node 66 takes the whole pool and node 10 gets nothing through; with a 12-block
+ * quota node 66 only loses its own traffic, every refused frame is counted against it, and once the stale transfers
+ * are cleaned up no node holds any block.
+ */
+#include <unity.h>
+#include <canard.h>
+#include <stdio.h>
+#include <string.h>
+
+#define POOL_BLOCKS             60U
+#define FLOOD_NODE_ID           66U
+#define GOOD_NODE_ID            10U
+#define FLOOD_TRANSFERS         40U
+#define FLOOD_FRAMES            3U          ///< Frames sent of each flood transfer, which never ends
+#define GOOD_TRANSFERS          5U
+#define PAYLOAD_LEN             60U
+#define NODE_QUOTA              12U
+#define SIGNATURE               0x1234U
+
+static uint8_t flood_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t good_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[POOL_BLOCKS * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance flood;
+static CanardInstance good;
+static CanardInstance rx;
+static uint32_t good_received;
+static uint32_t flood_refused;              ///< Frames of node 66 refused for lack of memory
+static uint64_t now_usec;
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    TEST_ASSERT_EQUAL_UINT8(GOOD_NODE_ID, transfer->source_node_id);
+    good_received++;
+}
+
+void setUp(void)
+{
+    canardInit(&flood, flood_pool, sizeof(flood_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&flood, FLOOD_NODE_ID);
+    canardInit(&good, good_pool, sizeof(good_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&good, GOOD_NODE_ID);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onReception, acceptAll, NULL);
+    canardSetLocalNodeID(&rx, 9);
+    good_received = 0;
+    flood_refused = 0;
+    now_usec = 1000;
+}
+
+void tearDown(void)
+{
+}
+
+/// Broadcasts one transfer from the sender and feeds at most max_frames of its frames to rx, dropping the rest
+static void send(CanardInstance* sender, uint16_t data_type_id, uint32_t max_frames)
+{
+    static const uint8_t payload[PAYLOAD_LEN] = {0};
+    static uint8_t transfer_ids[2][FLOOD_TRANSFERS];
+    uint8_t* const transfer_id = &transfer_ids[(sender == &flood) ? 0 : 1][data_type_id % FLOOD_TRANSFERS];
+    TEST_ASSERT_TRUE(canardBroadcast(sender, SIGNATURE, data_type_id, transfer_id, CANARD_TRANSFER_PRIORITY_MEDIUM,
+                                     payload, sizeof(payload)) > (int16_t) FLOOD_FRAMES);
+    uint32_t fed = 0;
+    for (const CanardCANFrame* frame = canardPeekTxQueue(sender); frame != NULL; frame = canardPeekTxQueue(sender))
+    {
+        if (fed++ < max_frames)
+        {
+            const int16_t result = canardHandleRxFrame(&rx, frame, now_usec);
+            now_usec += 100U;
+            if (result == -CANARD_ERROR_OUT_OF_MEMORY)
+            {
+                flood_refused += (sender == &flood) ? 1U : 0U;
+            }
+        }
+        canardPopTxQueue(sender);
+    }
+}
+
+/// Node 66 leaves FLOOD_TRANSFERS transfers unfinished, then node 10 sends GOOD_TRANSFERS complete ones
+static void floodThenSend(void)
+{
+    for (uint16_t i = 0; i < FLOOD_TRANSFERS; i++)
+    {
+        send(&flood, (uint16_t)(100U + i), FLOOD_FRAMES);
+        TEST_ASSERT_TRUE((rx.node_block_quota == 0U) || (rx.node_blocks[FLOOD_NODE_ID] <= rx.node_block_quota));
+    }
+    for (uint16_t i = 0; i < GOOD_TRANSFERS; i++)
+    {
+        send(&good, (uint16_t)(200U + i), UINT32_MAX);
+    }
+}
+
+static void assertNothingHeldAfterCleanup(void)
+{
+    canardCleanupStaleTransfers(&rx, now_usec + 10000000U);
+    TEST_ASSERT_EQUAL_UINT16(0, canardGetPoolAllocatorStatistics(&rx).current_usage_blocks);
+    for (uint16_t node_id = 0; node_id <= CANARD_MAX_NODE_ID; node_id++)
+    {
+        TEST_ASSERT_EQUAL_UINT16(0, rx.node_blocks[node_id]);
+    }
+}
+
+static void testFloodWithoutQuotaStarvesOtherNodes(void)
+{
+    floodThenSend();
+
+    TEST_ASSERT_EQUAL_UINT32(0, good_received);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_throttled);
+    TEST_ASSERT_EQUAL_UINT16(0, canardGetNodeThrottleCount(&rx, FLOOD_NODE_ID));
+    assertNothingHeldAfterCleanup();
+}
+
+static void testQuotaConfinesTheFloodToItsNode(void)
+{
+    canardSetNodeBlockQuota(&rx, NODE_QUOTA);
+    floodThenSend();
+
+    TEST_ASSERT_EQUAL_UINT32(GOOD_TRANSFERS, good_received);
+    TEST_ASSERT_TRUE(flood_refused > 0U);
+    TEST_ASSERT_EQUAL_UINT16(flood_refused, canardGetNodeThrottleCount(&rx, FLOOD_NODE_ID));
+    TEST_ASSERT_EQUAL_UINT16(0, canardGetNodeThrottleCount(&rx, GOOD_NODE_ID));
+    TEST_ASSERT_EQUAL_UINT32(flood_refused, rx.statistics.rx_throttled);
+    uint32_t total = 0;
+    for (uint16_t node_id = 0; node_id <= CANARD_MAX_NODE_ID; node_id++)
+    {
+        total += canardGetNodeThrottleCount(&rx, (uint8_t) node_id);
+    }
+    TEST_ASSERT_EQUAL_UINT32(rx.statistics.rx_throttled, total);
+    assertNothingHeldAfterCleanup();
+
+    char message[100];
+    snprintf(message, sizeof(message), "%u-block pool, %u-block quota: node %u throttled %u times, node %u got %u of %u",
+             (unsigned) POOL_BLOCKS, (unsigned) NODE_QUOTA, (unsigned) FLOOD_NODE_ID, (unsigned) flood_refused,
+             (unsigned) GOOD_NODE_ID, (unsigned) good_received, (unsigned) GOOD_TRANSFERS);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testFloodWithoutQuotaStarvesOtherNodes);
+    RUN_TEST(testQuotaConfinesTheFloodToItsNode);
+    return UNITY_END();
+}
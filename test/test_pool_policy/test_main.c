@@ -0,0 +1,251 @@
+/*
+ * RX pool policy: the reserved blocks are kept for transfers of reserved_priority or better, a frame that does not fit
+ * evicts the partial transfers of the worst priority below its own, oldest first and no more than it needs, and an
+ * eviction that could not make enough room drops nothing. rx_denied and rx_evicted count the outcomes.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <string.h>
+
+#define POOL_BLOCKS             40U
+#define MAX_FRAMES              64U
+#define MAX_DATA_TYPE_ID        64U
+#define RESERVED_BLOCKS         4U
+#define FILLER_PAYLOAD_LEN      400U
+
+/// The frames of one transfer, fed to the receiver one at a time
+typedef struct
+{
+    CanardCANFrame frames[MAX_FRAMES];
+    uint8_t count;
+    uint8_t fed;
+    uint16_t data_type_id;
+} Transfer;
+
+static uint8_t tx_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[POOL_BLOCKS * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx;
+static uint8_t transfer_ids[MAX_DATA_TYPE_ID];
+static bool received[MAX_DATA_TYPE_ID];
+static uint16_t next_filler_id;
+static uint64_t now_usec;
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = 0;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    TEST_ASSERT_TRUE(transfer->data_type_id < MAX_DATA_TYPE_ID);
+    received[transfer->data_type_id] = true;
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 20);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onReception, acceptAll, NULL);
+    canardSetLocalNodeID(&rx, 10);
+    memset(transfer_ids, 0, sizeof(transfer_ids));
+    memset(received, 0, sizeof(received));
+    next_filler_id = MAX_DATA_TYPE_ID / 2U;
+    now_usec = 1000;
+}
+
+void tearDown(void)
+{
+}
+
+static void setPolicy(uint16_t reserved_blocks, bool evict_lower_priority)
+{
+    const CanardPoolPolicy policy = {reserved_blocks, CANARD_TRANSFER_PRIORITY_HIGH, evict_lower_priority};
+    canardSetPoolPolicy(&rx, &policy);
+}
+
+static uint16_t freeBlocks(void)
+{
+    const CanardPoolAllocatorStatistics stats = canardGetPoolAllocatorStatistics(&rx);
+    return (uint16_t)(stats.capacity_blocks - stats.current_usage_blocks);
+}
+
+static void prepare(Transfer* transfer, uint8_t priority, uint16_t data_type_id, uint16_t payload_len)
+{
+    static const uint8_t payload[FILLER_PAYLOAD_LEN] = {0};
+    TEST_ASSERT_TRUE(payload_len <= sizeof(payload));
+    TEST_ASSERT_TRUE(data_type_id < MAX_DATA_TYPE_ID);
+    CanardTxTransfer tx_transfer;
+    canardInitTxTransfer(&tx_transfer);
+    tx_transfer.data_type_signature = 0;
+    tx_transfer.data_type_id = data_type_id;
+    tx_transfer.inout_transfer_id = &transfer_ids[data_type_id];
+    tx_transfer.priority = priority;
+    tx_transfer.payload = payload;
+    tx_transfer.payload_len = payload_len;
+    TEST_ASSERT_TRUE(canardBroadcastObj(&tx, &tx_transfer) > 0);
+
+    transfer->count = 0;
+    transfer->fed = 0;
+    transfer->data_type_id = data_type_id;
+    for (const CanardCANFrame* frame = canardPeekTxQueue(&tx); frame != NULL; frame = canardPeekTxQueue(&tx))
+    {
+        TEST_ASSERT_TRUE(transfer->count < MAX_FRAMES);
+        transfer->frames[transfer->count++] = *frame;
+        canardPopTxQueue(&tx);
+    }
+}
+
+static int16_t feedNext(Transfer* transfer)
+{
+    TEST_ASSERT_TRUE(transfer->fed < transfer->count);
+    return canardHandleRxFrame(&rx, &transfer->frames[transfer->fed++], now_usec++);
+}
+
+/// Feeds every frame of the transfer but the last, all of which must be taken
+static void feedAllButLast(Transfer* transfer)
+{
+    while (transfer->fed < transfer->count - 1U)
+    {
+        TEST_ASSERT_EQUAL_INT16(CANARD_OK, feedNext(transfer));
+    }
+}
+
+/// Takes pool blocks with partial transfers of the given priority until exactly free_target blocks are left
+static void fillUntilFree(uint8_t priority, uint16_t free_target)
+{
+    Transfer filler;
+    filler.count = 0;
+    filler.fed = 0;
+    while (freeBlocks() > free_target)
+    {
+        if (filler.fed + 1U >= filler.count)
+        {
+            prepare(&filler, priority, next_filler_id++, FILLER_PAYLOAD_LEN);
+        }
+        TEST_ASSERT_EQUAL_INT16(CANARD_OK, feedNext(&filler));
+    }
+    TEST_ASSERT_EQUAL_UINT16(free_target, freeBlocks());
+}
+
+static void testReserveIsKeptForHighPriority(void)
+{
+    setPolicy(RESERVED_BLOCKS, false);
+
+    // Medium priority takes the pool down to the reserve and no further
+    Transfer medium;
+    medium.count = 0;
+    medium.fed = 0;
+    int16_t result = CANARD_OK;
+    uint16_t free_before = 0;
+    while (result == CANARD_OK)
+    {
+        if (medium.fed + 1U >= medium.count)
+        {
+            prepare(&medium, CANARD_TRANSFER_PRIORITY_MEDIUM, next_filler_id++, FILLER_PAYLOAD_LEN);
+        }
+        free_before = freeBlocks();
+        result = feedNext(&medium);
+    }
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, result);
+    TEST_ASSERT_EQUAL_UINT16(RESERVED_BLOCKS, free_before);
+    TEST_ASSERT_EQUAL_UINT32(1, rx.statistics.rx_denied);
+
+    // A high priority transfer still gets through on the reserve
+    fillUntilFree(CANARD_TRANSFER_PRIORITY_MEDIUM, RESERVED_BLOCKS);
+    Transfer high;
+    prepare(&high, CANARD_TRANSFER_PRIORITY_HIGH, 2, 40);
+    TEST_ASSERT_TRUE(1U + rxPayloadBlocks(40) <= RESERVED_BLOCKS);
+    while (high.fed < high.count)
+    {
+        TEST_ASSERT_EQUAL_INT16(CANARD_OK, feedNext(&high));
+    }
+    TEST_ASSERT_TRUE(received[2]);
+
+    // The high priority transfer kept its state block, so the pool is now inside the reserve; without eviction, a
+    // medium frame is denied and nothing is dropped
+    Transfer late;
+    prepare(&late, CANARD_TRANSFER_PRIORITY_MEDIUM, 3, 40);
+    TEST_ASSERT_EQUAL_UINT16(RESERVED_BLOCKS - 1U, freeBlocks());
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, feedNext(&late));
+    TEST_ASSERT_EQUAL_UINT32(2, rx.statistics.rx_denied);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_evicted);
+}
+
+static void testEvictionTakesWorstPriorityOldestFirst(void)
+{
+    setPolicy(0, true);
+
+    // Older medium and lowest priority partial transfers, interleaved
+    Transfer partial[4];
+    uint16_t partial_blocks = 0;
+    const uint8_t priorities[4] = {CANARD_TRANSFER_PRIORITY_MEDIUM, CANARD_TRANSFER_PRIORITY_LOWEST,
+                                   CANARD_TRANSFER_PRIORITY_MEDIUM, CANARD_TRANSFER_PRIORITY_LOWEST};
+    for (uint8_t i = 0; i < 4U; i++)
+    {
+        const uint16_t free_before = freeBlocks();
+        prepare(&partial[i], priorities[i], (uint16_t)(1U + i), 120);
+        feedAllButLast(&partial[i]);
+        partial_blocks = (uint16_t)(free_before - freeBlocks() - 1U);     // Payload blocks, without the state
+    }
+    fillUntilFree(CANARD_TRANSFER_PRIORITY_HIGHEST, 0);
+
+    // The high priority transfer needs less than one lowest priority transfer holds
+    TEST_ASSERT_TRUE(1U + rxPayloadBlocks(40) <= partial_blocks);
+    Transfer high;
+    prepare(&high, CANARD_TRANSFER_PRIORITY_HIGH, 10, 40);
+    while (high.fed < high.count)
+    {
+        TEST_ASSERT_EQUAL_INT16(CANARD_OK, feedNext(&high));
+    }
+    TEST_ASSERT_TRUE(received[10]);
+    TEST_ASSERT_EQUAL_UINT32(1, rx.statistics.rx_evicted);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_denied);
+
+    // Only the oldest lowest priority transfer was dropped; the others complete
+    fillUntilFree(CANARD_TRANSFER_PRIORITY_HIGHEST, 0);
+    for (uint8_t i = 0; i < 4U; i++)
+    {
+        feedNext(&partial[i]);
+    }
+    TEST_ASSERT_TRUE(received[1]);
+    TEST_ASSERT_FALSE(received[2]);
+    TEST_ASSERT_TRUE(received[3]);
+    TEST_ASSERT_TRUE(received[4]);
+}
+
+static void testEvictionWithoutEnoughRoomDropsNothing(void)
+{
+    setPolicy(RESERVED_BLOCKS, true);
+
+    // A lowest priority transfer holds fewer blocks than a medium frame would need to clear the reserve
+    Transfer lowest;
+    const uint16_t free_before = freeBlocks();
+    prepare(&lowest, CANARD_TRANSFER_PRIORITY_LOWEST, 1, 60);
+    feedAllButLast(&lowest);
+    const uint16_t lowest_blocks = (uint16_t)(free_before - freeBlocks() - 1U);
+    TEST_ASSERT_TRUE(lowest_blocks > 0U);
+    TEST_ASSERT_TRUE(1U + lowest_blocks < RESERVED_BLOCKS + 1U);
+    fillUntilFree(CANARD_TRANSFER_PRIORITY_HIGHEST, 1);
+
+    Transfer medium;
+    prepare(&medium, CANARD_TRANSFER_PRIORITY_MEDIUM, 2, 40);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, feedNext(&medium));
+    TEST_ASSERT_EQUAL_UINT32(1, rx.statistics.rx_denied);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_evicted);
+
+    // The lowest priority transfer was left alone
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, feedNext(&lowest));
+    TEST_ASSERT_TRUE(received[1]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testReserveIsKeptForHighPriority);
+    RUN_TEST(testEvictionTakesWorstPriorityOldestFirst);
+    RUN_TEST(testEvictionWithoutEnoughRoomDropsNothing);
+    return UNITY_END();
+}
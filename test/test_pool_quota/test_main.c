@@ -0,0 +1,260 @@
+/*
+ * Pool quotas: each consumer is held to its quota, with refusals counted in consumer_refused and the high water mark
+ * in consumer_peak_blocks, the per-consumer usage always adds up to current_usage_blocks, and a TX backlog held to
+ * its quota leaves the blocks an incoming request needs.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define POOL_BLOCKS             40U
+#define TX_QUOTA                30U
+#define SIGNATURE               0x1234U
+#define REQUEST_TYPE_ID         11U
+#define REQUEST_LEN             60U
+#define LOCAL_NODE_ID           10U
+#define REMOTE_NODE_ID          20U
+
+static uint8_t pool[POOL_BLOCKS * CANARD_MEM_BLOCK_SIZE];
+static uint8_t remote_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static CanardInstance remote;
+static uint8_t broadcast_tid;
+static uint8_t request_tid;
+static uint32_t requests_received;
+static uint64_t now_usec;
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    if (transfer->transfer_type == CanardTransferTypeRequest)
+    {
+        TEST_ASSERT_EQUAL_UINT16(REQUEST_LEN, transfer->payload_len);
+        requests_received++;
+    }
+}
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), onReception, acceptAll, NULL);
+    canardSetLocalNodeID(&ins, LOCAL_NODE_ID);
+    canardInit(&remote, remote_pool, sizeof(remote_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&remote, REMOTE_NODE_ID);
+    broadcast_tid = 0;
+    request_tid = 0;
+    requests_received = 0;
+    now_usec = 1000;
+}
+
+void tearDown(void)
+{
+}
+
+static CanardPoolAllocatorStatistics stats(void)
+{
+    return canardGetPoolAllocatorStatistics(&ins);
+}
+
+/// Every block in use belongs to exactly one consumer, and no consumer is above its peak
+static void checkUsageAddsUp(void)
+{
+    const CanardPoolAllocatorStatistics s = stats();
+    uint32_t total = 0;
+    for (uint8_t c = 0; c < CANARD_NUM_POOL_CONSUMERS; c++)
+    {
+        total += s.consumer_usage_blocks[c];
+        TEST_ASSERT_TRUE(s.consumer_usage_blocks[c] <= s.consumer_peak_blocks[c]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(s.current_usage_blocks, total);
+    TEST_ASSERT_TRUE(s.current_usage_blocks <= s.peak_usage_blocks);
+}
+
+/// Queues a broadcast on the local node, which nothing drains, as if the bus were off
+static int16_t queueBroadcast(uint16_t payload_len)
+{
+    static const uint8_t payload[REQUEST_LEN] = {0};
+    TEST_ASSERT_TRUE(payload_len <= sizeof(payload));
+    return canardBroadcast(&ins, SIGNATURE, 100, &broadcast_tid, CANARD_TRANSFER_PRIORITY_LOW, payload, payload_len);
+}
+
+/// Sends a request from the remote node to the local one, frame by frame, and returns the last result
+static int16_t receiveRequest(uint32_t max_frames)
+{
+    static const uint8_t payload[REQUEST_LEN] = {0};
+    TEST_ASSERT_TRUE(canardRequestOrRespond(&remote, LOCAL_NODE_ID, SIGNATURE, REQUEST_TYPE_ID, &request_tid,
+                                            CANARD_TRANSFER_PRIORITY_HIGH, CanardRequest, payload,
+                                            sizeof(payload)) > 1);
+    int16_t result = CANARD_OK;
+    uint32_t fed = 0;
+    for (const CanardCANFrame* frame = canardPeekTxQueue(&remote); frame != NULL; frame = canardPeekTxQueue(&remote))
+    {
+        if ((fed++ < max_frames) && (result == CANARD_OK))
+        {
+            result = canardHandleRxFrame(&ins, frame, now_usec++);
+            checkUsageAddsUp();
+        }
+        canardPopTxQueue(&remote);
+    }
+    return result;
+}
+
+static void testTxQuota(void)
+{
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT,
+                            canardSetPoolQuota(&ins, (CanardPoolConsumer) CANARD_NUM_POOL_CONSUMERS, 1));
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardSetPoolQuota(&ins, CanardPoolConsumerTxItem, TX_QUOTA));
+
+    for (uint16_t i = 0; i < TX_QUOTA; i++)
+    {
+        TEST_ASSERT_EQUAL_INT16(1, queueBroadcast(7));
+        checkUsageAddsUp();
+    }
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, queueBroadcast(7));
+    TEST_ASSERT_EQUAL_UINT16(1, stats().consumer_refused[CanardPoolConsumerTxItem]);
+
+    // A multi-frame transfer that does not fit the quota is refused as a whole and counted once
+    canardPopTxQueue(&ins);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, queueBroadcast(20));
+    TEST_ASSERT_EQUAL_UINT16(2, stats().consumer_refused[CanardPoolConsumerTxItem]);
+    TEST_ASSERT_EQUAL_UINT16(TX_QUOTA - 1U, stats().consumer_usage_blocks[CanardPoolConsumerTxItem]);
+
+    // So is a stream, which finds out only when it needs its second frame
+    const uint8_t payload[20] = {0};
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.transfer_type = CanardTransferTypeBroadcast;
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = 100;
+    transfer.inout_transfer_id = &broadcast_tid;
+    transfer.priority = CANARD_TRANSFER_PRIORITY_LOW;
+#if CANARD_MULTI_IFACE
+    transfer.iface_mask = 1U;
+#endif
+    CanardTxStream stream;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &ins, &transfer, 0));
+    canardTxStreamWrite(&stream, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, canardTxStreamCommit(&stream));
+    TEST_ASSERT_EQUAL_UINT16(3, stats().consumer_refused[CanardPoolConsumerTxItem]);
+    TEST_ASSERT_EQUAL_UINT16(TX_QUOTA - 1U, stats().consumer_usage_blocks[CanardPoolConsumerTxItem]);
+    TEST_ASSERT_EQUAL_UINT16(TX_QUOTA, stats().consumer_peak_blocks[CanardPoolConsumerTxItem]);
+    checkUsageAddsUp();
+
+    // The peak stays once the queue drains; a quota of zero lifts the limit
+    while (canardPeekTxQueue(&ins) != NULL)
+    {
+        canardPopTxQueue(&ins);
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, stats().consumer_usage_blocks[CanardPoolConsumerTxItem]);
+    TEST_ASSERT_EQUAL_UINT16(TX_QUOTA, stats().consumer_peak_blocks[CanardPoolConsumerTxItem]);
+    canardSetPoolQuota(&ins, CanardPoolConsumerTxItem, 0);
+    for (uint16_t i = 0; i < POOL_BLOCKS; i++)
+    {
+        TEST_ASSERT_EQUAL_INT16(1, queueBroadcast(7));
+    }
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, queueBroadcast(7));
+    TEST_ASSERT_EQUAL_UINT16(3, stats().consumer_refused[CanardPoolConsumerTxItem]);     // The pool, not the quota
+    TEST_ASSERT_EQUAL_UINT16(POOL_BLOCKS, stats().consumer_peak_blocks[CanardPoolConsumerTxItem]);
+}
+
+static void testRxQuota(void)
+{
+    const uint16_t payload_blocks = rxPayloadBlocks(REQUEST_LEN);
+    TEST_ASSERT_TRUE(payload_blocks > 1U);
+    canardSetPoolQuota(&ins, CanardPoolConsumerRxBuffer, (uint16_t)(payload_blocks - 1U));
+
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, receiveRequest(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(0, requests_received);
+    TEST_ASSERT_TRUE(stats().consumer_refused[CanardPoolConsumerRxBuffer] > 0U);
+    TEST_ASSERT_EQUAL_UINT16(payload_blocks - 1U, stats().consumer_peak_blocks[CanardPoolConsumerRxBuffer]);
+    TEST_ASSERT_EQUAL_UINT16(0, stats().consumer_refused[CanardPoolConsumerRxState]);
+
+    // With room for the payload the next request gets through and gives its blocks back
+    canardSetPoolQuota(&ins, CanardPoolConsumerRxBuffer, payload_blocks);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, receiveRequest(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(1, requests_received);
+    TEST_ASSERT_EQUAL_UINT16(0, stats().consumer_usage_blocks[CanardPoolConsumerRxBuffer]);
+    TEST_ASSERT_EQUAL_UINT16(payload_blocks, stats().consumer_peak_blocks[CanardPoolConsumerRxBuffer]);
+    checkUsageAddsUp();
+}
+
+static void testUsageAddsUpUnderMixedTraffic(void)
+{
+    canardSetPoolQuota(&ins, CanardPoolConsumerTxItem, TX_QUOTA);
+    srand(3);
+    for (uint16_t round = 0; round < 2000U; round++)
+    {
+        switch (rand() % 4)
+        {
+        case 0:
+            (void) queueBroadcast((uint16_t)(rand() % REQUEST_LEN));
+            break;
+        case 1:
+            (void) receiveRequest((uint32_t)(rand() % 12));                // Often left unfinished
+            break;
+        case 2:
+            for (int i = rand() % 8; (i > 0) && (canardPeekTxQueue(&ins) != NULL); i--)
+            {
+                canardPopTxQueue(&ins);
+            }
+            break;
+        default:
+            now_usec += (uint64_t)(rand() % 3) * CANARD_RECOMMENDED_STALE_TRANSFER_CLEANUP_INTERVAL_USEC;
+            canardCleanupStaleTransfers(&ins, now_usec);
+            break;
+        }
+        checkUsageAddsUp();
+        TEST_ASSERT_TRUE(stats().consumer_usage_blocks[CanardPoolConsumerTxItem] <= TX_QUOTA);
+    }
+    TEST_ASSERT_EQUAL_UINT16(TX_QUOTA, stats().consumer_peak_blocks[CanardPoolConsumerTxItem]);
+}
+
+/// With the bus off, queues broadcasts until the pool or the TX quota refuses one
+static void fillTxBacklog(void)
+{
+    while (queueBroadcast(REQUEST_LEN) > 0)
+    {
+        checkUsageAddsUp();
+    }
+    while (queueBroadcast(7) > 0)
+    {
+        checkUsageAddsUp();
+    }
+}
+
+static void testTxBacklogCannotStarveRx(void)
+{
+    // Without a quota the backlog takes the whole pool and the request is lost
+    fillTxBacklog();
+    TEST_ASSERT_EQUAL_UINT16(POOL_BLOCKS, stats().current_usage_blocks);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, receiveRequest(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(0, requests_received);
+
+    // With one, the rest of the pool is left for the request
+    setUp();
+    TEST_ASSERT_TRUE(TX_QUOTA + 1U + rxPayloadBlocks(REQUEST_LEN) <= POOL_BLOCKS);
+    canardSetPoolQuota(&ins, CanardPoolConsumerTxItem, TX_QUOTA);
+    fillTxBacklog();
+    TEST_ASSERT_EQUAL_UINT16(TX_QUOTA, stats().consumer_usage_blocks[CanardPoolConsumerTxItem]);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, receiveRequest(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(1, requests_received);
+    TEST_ASSERT_TRUE(stats().consumer_refused[CanardPoolConsumerTxItem] > 0U);
+    TEST_ASSERT_EQUAL_UINT16(0, stats().consumer_refused[CanardPoolConsumerRxBuffer]);
+    checkUsageAddsUp();
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testTxQuota);
+    RUN_TEST(testRxQuota);
+    RUN_TEST(testUsageAddsUpUnderMixedTraffic);
+    RUN_TEST(testTxBacklogCannotStarveRx);
+    return UNITY_END();
+}
@@ -0,0 +1,323 @@
+/*
+ * RX payload arena: the same frames are fed to a receiver with an arena and to one without. Both must decode
+ * uavcan.equipment.gnss.Fix2 and uavcan.equipment.power.BatteryInfo to what was sent; the arena receiver must hand out
+ * a contiguous payload with its pool blocks already released, and fall back to the scattered layout for a transfer
+ * that does not fit. The benchmark reports the decode time of both messages in both layouts.
+ */
+#include <unity.h>
+#include <canard.h>
+#include <uavcan.equipment.gnss.Fix2.h>
+#include <uavcan.equipment.power.BatteryInfo.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_ROUNDS        20000U
+#define BENCHMARK_RUNS          8U
+
+/// What a receiver saw inside its handler
+typedef struct
+{
+    uint32_t received;
+    uint16_t payload_len;
+    bool contiguous;                        ///< payload_middle and payload_tail were NULL
+    bool in_arena;                          ///< payload_head pointed into the arena
+    uint16_t blocks_in_handler;             ///< Pool blocks in use while the handler ran
+    struct uavcan_equipment_gnss_Fix2 fix2;
+    struct uavcan_equipment_power_BatteryInfo battery;
+    uint32_t decode_rounds;                 ///< How many times the handler decodes the transfer
+    double decode_seconds;                  ///< Time those decodes took
+} Capture;
+
+static uint8_t tx_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t arena_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t plain_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx_arena;
+static CanardInstance rx_plain;
+static Capture arena_capture;
+static Capture plain_capture;
+static uint8_t arena[UAVCAN_EQUIPMENT_GNSS_FIX2_MAX_SIZE];
+static uint8_t transfer_id;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static bool acceptBoth(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                       CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    if (data_type_id == UAVCAN_EQUIPMENT_GNSS_FIX2_ID)
+    {
+        *out_signature = UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE;
+        return true;
+    }
+    if (data_type_id == UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID)
+    {
+        *out_signature = UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE;
+        return true;
+    }
+    return false;
+}
+
+static void onTransfer(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    Capture* const capture = (Capture*) canardGetUserReference(instance);
+    capture->received++;
+    capture->payload_len = transfer->payload_len;
+    capture->contiguous = (transfer->payload_middle == NULL) && (transfer->payload_tail == NULL);
+    capture->in_arena = (transfer->payload_head == arena);
+    capture->blocks_in_handler = canardGetPoolAllocatorStatistics(instance).current_usage_blocks;
+
+    const double start = nowSeconds();
+    for (uint32_t i = 0; i < capture->decode_rounds; i++)
+    {
+        if (transfer->data_type_id == UAVCAN_EQUIPMENT_GNSS_FIX2_ID)
+        {
+            memset(&capture->fix2, 0, sizeof(capture->fix2));
+            TEST_ASSERT_FALSE(uavcan_equipment_gnss_Fix2_decode(transfer, &capture->fix2));
+        }
+        else
+        {
+            memset(&capture->battery, 0, sizeof(capture->battery));
+            TEST_ASSERT_FALSE(uavcan_equipment_power_BatteryInfo_decode(transfer, &capture->battery));
+        }
+    }
+    capture->decode_seconds = nowSeconds() - start;
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 5);
+    canardInit(&rx_arena, arena_pool, sizeof(arena_pool), onTransfer, acceptBoth, &arena_capture);
+    canardSetLocalNodeID(&rx_arena, 9);
+    canardSetRxPayloadArena(&rx_arena, arena, sizeof(arena));
+    canardInit(&rx_plain, plain_pool, sizeof(plain_pool), onTransfer, acceptBoth, &plain_capture);
+    canardSetLocalNodeID(&rx_plain, 10);
+    memset(&arena_capture, 0, sizeof(arena_capture));
+    memset(&plain_capture, 0, sizeof(plain_capture));
+    arena_capture.decode_rounds = 1;
+    plain_capture.decode_rounds = 1;
+}
+
+void tearDown(void)
+{
+}
+
+static void makeFix2(struct uavcan_equipment_gnss_Fix2* msg, uint8_t covariance_len)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->timestamp.usec = 123456789U;
+    msg->longitude_deg_1e8 = 12345678901LL;
+    msg->latitude_deg_1e8 = -4876543210LL;
+    msg->height_msl_mm = 54321;
+    msg->ned_velocity[0] = 1.5F;
+    msg->ned_velocity[2] = -0.25F;
+    msg->sats_used = 17;
+    msg->status = 3;
+    msg->covariance.len = covariance_len;
+    for (uint8_t i = 0; i < covariance_len; i++)
+    {
+        msg->covariance.data[i] = (float) i * 1.5F;
+    }
+}
+
+static void makeBatteryInfo(struct uavcan_equipment_power_BatteryInfo* msg)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->temperature = 300.5F;
+    msg->voltage = 15.25F;
+    msg->current = -3.5F;
+    msg->remaining_capacity_wh = 42.0F;
+    msg->full_charge_capacity_wh = 80.0F;
+    msg->status_flags = 0x21U;
+    msg->state_of_health_pct = 98;
+    msg->state_of_charge_pct = 52;
+    msg->battery_id = 2;
+    msg->model_instance_id = 0xDEADBEEFU;
+    msg->model_name.len = 20;
+    memcpy(msg->model_name.data, "Example 4S 5000 mAh!", 20);
+}
+
+/// Broadcasts one encoded message from tx and feeds every frame to both receivers
+static void sendToBoth(uint64_t signature, uint16_t data_type_id, const uint8_t* payload, uint16_t payload_len)
+{
+    TEST_ASSERT_TRUE(canardBroadcast(&tx, signature, data_type_id, &transfer_id, CANARD_TRANSFER_PRIORITY_MEDIUM,
+                                     payload, payload_len) > 1);
+    uint64_t timestamp_usec = 1;
+    for (const CanardCANFrame* frame = canardPeekTxQueue(&tx); frame != NULL; frame = canardPeekTxQueue(&tx))
+    {
+        TEST_ASSERT_GREATER_OR_EQUAL_INT16(0, canardHandleRxFrame(&rx_arena, frame, timestamp_usec));
+        TEST_ASSERT_GREATER_OR_EQUAL_INT16(0, canardHandleRxFrame(&rx_plain, frame, timestamp_usec));
+        timestamp_usec++;
+        canardPopTxQueue(&tx);
+    }
+}
+
+static uint16_t sendFix2(const struct uavcan_equipment_gnss_Fix2* msg)
+{
+    uint8_t buffer[UAVCAN_EQUIPMENT_GNSS_FIX2_MAX_SIZE];
+    const uint16_t len = (uint16_t) uavcan_equipment_gnss_Fix2_encode((struct uavcan_equipment_gnss_Fix2*) msg, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                                                      , true
+#endif
+                                                                      );
+    sendToBoth(UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE, UAVCAN_EQUIPMENT_GNSS_FIX2_ID, buffer, len);
+    return len;
+}
+
+static uint16_t sendBatteryInfo(const struct uavcan_equipment_power_BatteryInfo* msg)
+{
+    uint8_t buffer[UAVCAN_EQUIPMENT_POWER_BATTERYINFO_MAX_SIZE];
+    const uint16_t len = (uint16_t) uavcan_equipment_power_BatteryInfo_encode(
+        (struct uavcan_equipment_power_BatteryInfo*) msg, buffer
+#if CANARD_ENABLE_TAO_OPTION
+        , true
+#endif
+        );
+    sendToBoth(UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID, buffer, len);
+    return len;
+}
+
+static void testArenaDecodeMatchesScatteredDecode(void)
+{
+    struct uavcan_equipment_gnss_Fix2 fix2;
+    makeFix2(&fix2, 36);
+    const uint16_t fix2_len = sendFix2(&fix2);
+    TEST_ASSERT_TRUE(fix2_len > 3U * CANARD_MEM_BLOCK_SIZE);        // Head, several pool blocks and a tail
+
+    TEST_ASSERT_EQUAL_UINT32(1, arena_capture.received);
+    TEST_ASSERT_EQUAL_UINT32(1, plain_capture.received);
+    TEST_ASSERT_TRUE(arena_capture.contiguous);
+    TEST_ASSERT_TRUE(arena_capture.in_arena);
+    TEST_ASSERT_FALSE(plain_capture.contiguous);
+    TEST_ASSERT_EQUAL_UINT16(fix2_len, arena_capture.payload_len);
+    TEST_ASSERT_EQUAL_UINT16(fix2_len, plain_capture.payload_len);
+    TEST_ASSERT_EQUAL_MEMORY(&plain_capture.fix2, &arena_capture.fix2, sizeof(fix2));
+    TEST_ASSERT_EQUAL_INT64(fix2.longitude_deg_1e8, arena_capture.fix2.longitude_deg_1e8);
+    TEST_ASSERT_EQUAL_UINT8(36, arena_capture.fix2.covariance.len);
+    TEST_ASSERT_EQUAL_MEMORY(fix2.covariance.data, arena_capture.fix2.covariance.data, 36U * sizeof(float));
+
+    struct uavcan_equipment_power_BatteryInfo battery;
+    makeBatteryInfo(&battery);
+    sendBatteryInfo(&battery);
+
+    TEST_ASSERT_EQUAL_UINT32(2, arena_capture.received);
+    TEST_ASSERT_TRUE(arena_capture.in_arena);
+    TEST_ASSERT_EQUAL_MEMORY(&plain_capture.battery, &arena_capture.battery, sizeof(battery));
+    TEST_ASSERT_EQUAL_UINT32(battery.model_instance_id, arena_capture.battery.model_instance_id);
+    TEST_ASSERT_EQUAL_UINT8(20, arena_capture.battery.model_name.len);
+    TEST_ASSERT_EQUAL_MEMORY(battery.model_name.data, arena_capture.battery.model_name.data, 20);
+}
+
+static void testTransferLargerThanArenaStaysScattered(void)
+{
+    struct uavcan_equipment_gnss_Fix2 fix2;
+    makeFix2(&fix2, 36);
+    canardSetRxPayloadArena(&rx_arena, arena, 64);
+    const uint16_t fix2_len = sendFix2(&fix2);
+    TEST_ASSERT_TRUE(fix2_len > 64U);
+
+    TEST_ASSERT_EQUAL_UINT32(1, arena_capture.received);
+    TEST_ASSERT_FALSE(arena_capture.contiguous);
+    TEST_ASSERT_FALSE(arena_capture.in_arena);
+    TEST_ASSERT_EQUAL_UINT16(plain_capture.blocks_in_handler, arena_capture.blocks_in_handler);
+    TEST_ASSERT_EQUAL_MEMORY(&plain_capture.fix2, &arena_capture.fix2, sizeof(fix2));
+
+    // A transfer that does fit still goes through the arena
+    makeFix2(&fix2, 4);
+    TEST_ASSERT_TRUE(sendFix2(&fix2) <= 64U);
+    TEST_ASSERT_TRUE(arena_capture.in_arena);
+    TEST_ASSERT_TRUE(arena_capture.contiguous);
+    TEST_ASSERT_EQUAL_MEMORY(&plain_capture.fix2, &arena_capture.fix2, sizeof(fix2));
+
+    // Removing the arena brings back the scattered layout
+    canardSetRxPayloadArena(&rx_arena, NULL, 0);
+    sendFix2(&fix2);
+    TEST_ASSERT_FALSE(arena_capture.in_arena);
+    TEST_ASSERT_FALSE(arena_capture.contiguous);
+}
+
+static void testPoolBlocksAreFreedBeforeTheHandlerRuns(void)
+{
+    struct uavcan_equipment_gnss_Fix2 fix2;
+    makeFix2(&fix2, 36);
+    sendFix2(&fix2);
+
+    // Between transfers, each receiver only keeps the RX state of the one session
+    const uint16_t idle_blocks = canardGetPoolAllocatorStatistics(&rx_arena).current_usage_blocks;
+    TEST_ASSERT_EQUAL_UINT16(idle_blocks, canardGetPoolAllocatorStatistics(&rx_plain).current_usage_blocks);
+    TEST_ASSERT_EQUAL_UINT16(idle_blocks, arena_capture.blocks_in_handler);
+    TEST_ASSERT_TRUE(plain_capture.blocks_in_handler > idle_blocks);
+}
+
+/// Decodes the last transfer BENCHMARK_ROUNDS times inside the handler of each receiver, best of BENCHMARK_RUNS
+static void measureDecode(uint16_t (*send)(const void* msg), const void* msg, double* out_arena_ns,
+                          double* out_plain_ns)
+{
+    *out_arena_ns = 1e9;
+    *out_plain_ns = 1e9;
+    arena_capture.decode_rounds = BENCHMARK_ROUNDS;
+    plain_capture.decode_rounds = BENCHMARK_ROUNDS;
+    for (uint32_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        send(msg);
+        const double arena_ns = arena_capture.decode_seconds * 1e9 / BENCHMARK_ROUNDS;
+        const double plain_ns = plain_capture.decode_seconds * 1e9 / BENCHMARK_ROUNDS;
+        *out_arena_ns = (arena_ns < *out_arena_ns) ? arena_ns : *out_arena_ns;
+        *out_plain_ns = (plain_ns < *out_plain_ns) ? plain_ns : *out_plain_ns;
+    }
+    TEST_ASSERT_TRUE(arena_capture.in_arena);
+    TEST_ASSERT_FALSE(plain_capture.contiguous);
+}
+
+static uint16_t sendAnyFix2(const void* msg)
+{
+    return sendFix2((const struct uavcan_equipment_gnss_Fix2*) msg);
+}
+
+static uint16_t sendAnyBatteryInfo(const void* msg)
+{
+    return sendBatteryInfo((const struct uavcan_equipment_power_BatteryInfo*) msg);
+}
+
+static void testBenchmark(void)
+{
+    struct uavcan_equipment_gnss_Fix2 fix2;
+    struct uavcan_equipment_power_BatteryInfo battery;
+    double arena_ns = 0.0;
+    double plain_ns = 0.0;
+    char message[120];
+
+    makeFix2(&fix2, 0);
+    measureDecode(sendAnyFix2, &fix2, &arena_ns, &plain_ns);
+    snprintf(message, sizeof(message), "Fix2, %u bytes: scattered %.0f ns, arena %.0f ns per decode",
+             (unsigned) arena_capture.payload_len, plain_ns, arena_ns);
+    TEST_MESSAGE(message);
+
+    makeFix2(&fix2, 36);
+    measureDecode(sendAnyFix2, &fix2, &arena_ns, &plain_ns);
+    snprintf(message, sizeof(message), "Fix2 with covariance, %u bytes: scattered %.0f ns, arena %.0f ns per decode",
+             (unsigned) arena_capture.payload_len, plain_ns, arena_ns);
+    TEST_MESSAGE(message);
+
+    makeBatteryInfo(&battery);
+    measureDecode(sendAnyBatteryInfo, &battery, &arena_ns, &plain_ns);
+    snprintf(message, sizeof(message), "BatteryInfo, %u bytes: scattered %.0f ns, arena %.0f ns per decode",
+             (unsigned) arena_capture.payload_len, plain_ns, arena_ns);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testArenaDecodeMatchesScatteredDecode);
+    RUN_TEST(testTransferLargerThanArenaStaysScattered);
+    RUN_TEST(testPoolBlocksAreFreedBeforeTheHandlerRuns);
+    RUN_TEST(testBenchmark);
+    return UNITY_END();
+}
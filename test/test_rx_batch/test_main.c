@@ -0,0 +1,168 @@
+/*
+ * Batched RX ingestion: canardHandleRxFrames() gives the same transfers and counters as a canardHandleRxFrame() loop,
+ * and drops foreign service frames before any transfer state is looked up.
+ */
+#include <unity.h>
+#include <canard.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BURST_FRAMES            64U
+#define BENCHMARK_BURSTS        20000U
+#define LOCAL_NODE_ID           10U
+
+static uint8_t pool[64U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static CanardCANFrame burst[BURST_FRAMES];
+static uint64_t timestamps[BURST_FRAMES];
+static uint32_t received;
+static uint32_t received_checksum;
+
+static bool shouldAccept(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                         CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = 0;
+    return data_type_id == 1000U;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    uint8_t value = 0;
+    (void) canardDecodeScalar(transfer, 0, 8, false, &value);
+    received++;
+    received_checksum = received_checksum * 31U + value + transfer->source_node_id;
+}
+
+/// Even frames are single-frame broadcasts from different nodes, odd frames are requests addressed to another node
+static void fillBurst(uint8_t transfer_id)
+{
+    for (uint32_t i = 0; i < BURST_FRAMES; i++)
+    {
+        CanardCANFrame* const frame = &burst[i];
+        memset(frame, 0, sizeof(*frame));
+        const uint8_t source_node_id = (uint8_t)(1U + i / 2U);
+        if ((i % 2U) == 0U)
+        {
+            frame->id = (1000UL << 8U) | source_node_id;
+        }
+        else
+        {
+            frame->id = (1UL << 15U) | (20UL << 16U) | ((LOCAL_NODE_ID + 1UL) << 8U) | (1UL << 7U) | source_node_id;
+        }
+        frame->id |= CANARD_CAN_FRAME_EFF | ((uint32_t) CANARD_TRANSFER_PRIORITY_MEDIUM << 24U);
+        frame->data[0] = (uint8_t) i;
+        frame->data[1] = (uint8_t)(0xC0U | (transfer_id & 31U));
+        frame->data_len = 2;
+        timestamps[i] = (uint64_t) transfer_id * 1000U + i;
+    }
+}
+
+static void resetInstance(void)
+{
+    canardInit(&ins, pool, sizeof(pool), onReception, shouldAccept, NULL);
+    canardSetLocalNodeID(&ins, LOCAL_NODE_ID);
+    received = 0;
+    received_checksum = 0;
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/// Feeds BENCHMARK_BURSTS bursts either in one call each or frame by frame, returns the time per frame in nanoseconds
+static double runBursts(bool batched)
+{
+    resetInstance();
+    const double start = nowSeconds();
+    for (uint32_t n = 0; n < BENCHMARK_BURSTS; n++)
+    {
+        if (batched)
+        {
+            (void) canardHandleRxFrames(&ins, burst, BURST_FRAMES, timestamps);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < BURST_FRAMES; i++)
+            {
+                (void) canardHandleRxFrame(&ins, &burst[i], timestamps[i]);
+            }
+        }
+    }
+    return (nowSeconds() - start) * 1e9 / (double)(BENCHMARK_BURSTS * BURST_FRAMES);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_batch_matches_frame_loop(void)
+{
+    int16_t loop_results[BURST_FRAMES];
+    uint16_t loop_handled = 0;
+
+    resetInstance();
+    for (uint8_t transfer_id = 0; transfer_id < 40U; transfer_id++)
+    {
+        fillBurst(transfer_id);
+        for (uint32_t i = 0; i < BURST_FRAMES; i++)
+        {
+            const int16_t result = canardHandleRxFrame(&ins, &burst[i], timestamps[i]);
+            loop_results[i] = result;
+            loop_handled = (uint16_t)(loop_handled + ((result == CANARD_OK) ? 1U : 0U));
+        }
+    }
+    const CanardInstanceStatistics loop_statistics = ins.statistics;
+    const uint32_t loop_received = received;
+    const uint32_t loop_checksum = received_checksum;
+
+    uint16_t batch_handled = 0;
+    resetInstance();
+    for (uint8_t transfer_id = 0; transfer_id < 40U; transfer_id++)
+    {
+        fillBurst(transfer_id);
+        batch_handled = (uint16_t)(batch_handled + canardHandleRxFrames(&ins, burst, BURST_FRAMES, timestamps));
+    }
+
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_WRONG_ADDRESS, loop_results[1]);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, loop_results[0]);
+    TEST_ASSERT_EQUAL_UINT16(40U * BURST_FRAMES / 2U, loop_handled);
+    TEST_ASSERT_EQUAL_UINT16(loop_handled, batch_handled);
+    TEST_ASSERT_EQUAL_UINT32(loop_received, received);
+    TEST_ASSERT_EQUAL_UINT32(loop_checksum, received_checksum);
+    TEST_ASSERT_EQUAL_MEMORY(&loop_statistics, &ins.statistics, sizeof(CanardInstanceStatistics));
+}
+
+void test_empty_batch(void)
+{
+    resetInstance();
+    TEST_ASSERT_EQUAL_UINT16(0, canardHandleRxFrames(&ins, NULL, 0, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, ins.statistics.rx_frames);
+}
+
+void test_benchmark_ns_per_frame(void)
+{
+    char message[96];
+    fillBurst(1);
+    (void) runBursts(true);                                                 // Warm up the caches
+    const double loop_ns = runBursts(false);
+    const double batch_ns = runBursts(true);
+    snprintf(message, sizeof(message), "%u-frame bursts, half foreign services: loop %.1f ns, batch %.1f ns per frame",
+             (unsigned) BURST_FRAMES, loop_ns, batch_ns);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_batch_matches_frame_loop);
+    RUN_TEST(test_empty_batch);
+    RUN_TEST(test_benchmark_ns_per_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,152 @@
+/*
+ * RX transfer state lookup: every session is found again, the descriptors spread over the hash buckets, and the cost
+ * per frame stays flat as the number of sessions grows.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <stdio.h>
+#include <time.h>
+
+#define MAX_SESSIONS            500U
+#define ROUNDS                  200U
+
+static uint8_t pool[(MAX_SESSIONS + 64U) * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static uint32_t received;
+
+static bool shouldAccept(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                         CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = 0;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    received++;
+}
+
+static uint16_t sessionDataTypeId(uint32_t session)
+{
+    return (uint16_t)(1000U + session / CANARD_MAX_NODE_ID);
+}
+
+static uint8_t sessionSourceNodeId(uint32_t session)
+{
+    return (uint8_t)(CANARD_MIN_NODE_ID + session % CANARD_MAX_NODE_ID);
+}
+
+/// Same layout as the library's transfer descriptors of broadcasts
+static uint32_t sessionDescriptor(uint32_t session)
+{
+    return (uint32_t) sessionDataTypeId(session) | ((uint32_t) CanardTransferTypeBroadcast << 16U) |
+           ((uint32_t) sessionSourceNodeId(session) << 18U);
+}
+
+static CanardCANFrame singleFrame(uint32_t session, uint8_t transfer_id)
+{
+    CanardCANFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.id = CANARD_CAN_FRAME_EFF | ((uint32_t)CANARD_TRANSFER_PRIORITY_MEDIUM << 24U) |
+               ((uint32_t)sessionDataTypeId(session) << 8U) | sessionSourceNodeId(session);
+    frame.data[0] = (uint8_t) session;
+    frame.data[1] = (uint8_t)(0xC0U | (transfer_id & 31U));
+    frame.data_len = 2;
+    return frame;
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/// Runs ROUNDS transfers on each of 'sessions' sessions and returns the time per frame in nanoseconds
+static double runSessions(uint32_t sessions)
+{
+    canardInit(&ins, pool, sizeof(pool), onReception, shouldAccept, NULL);
+    canardSetLocalNodeID(&ins, 127);
+    received = 0;
+
+    uint64_t timestamp_usec = 1;
+    const double start = nowSeconds();
+    for (uint32_t round = 0; round < ROUNDS; round++)
+    {
+        for (uint32_t session = 0; session < sessions; session++)
+        {
+            const CanardCANFrame frame = singleFrame(session, (uint8_t) round);
+            TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardHandleRxFrame(&ins, &frame, timestamp_usec));
+        }
+        timestamp_usec += 1000U;
+    }
+    const double elapsed = nowSeconds() - start;
+
+    TEST_ASSERT_EQUAL_UINT32(sessions * ROUNDS, received);
+    TEST_ASSERT_EQUAL_UINT32(sessions * ROUNDS, ins.statistics.rx_transfers);
+    TEST_ASSERT_EQUAL_UINT32(sessions, ins.allocator.statistics.current_usage_blocks);
+    return elapsed * 1e9 / (double)(sessions * ROUNDS);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_every_session_keeps_its_state(void)
+{
+    (void) runSessions(MAX_SESSIONS);
+
+    uint32_t found = 0;
+    for (uint32_t session = 0; session < MAX_SESSIONS; session++)
+    {
+        const CanardRxState* const state = findRxState(&ins, sessionDescriptor(session));
+        TEST_ASSERT_NOT_NULL(state);
+        TEST_ASSERT_EQUAL_UINT8(ROUNDS & 31U, state->transfer_id);
+        found++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(MAX_SESSIONS, found);
+}
+
+void test_descriptors_spread_over_buckets(void)
+{
+    uint16_t chain_length[CANARD_RX_STATE_HASH_BUCKETS] = {0};
+    for (uint32_t session = 0; session < MAX_SESSIONS; session++)
+    {
+        chain_length[rxStateBucket(sessionDescriptor(session))]++;
+    }
+
+    uint16_t longest = 0;
+    for (uint32_t bucket = 0; bucket < CANARD_RX_STATE_HASH_BUCKETS; bucket++)
+    {
+        longest = (chain_length[bucket] > longest) ? chain_length[bucket] : longest;
+    }
+    // Twice the mean chain length; a single list, or a hash keyed on the data type alone, is far above this
+    TEST_ASSERT_LESS_OR_EQUAL(2U * MAX_SESSIONS / CANARD_RX_STATE_HASH_BUCKETS, longest);
+}
+
+void test_benchmark_lookup_cost_per_frame(void)
+{
+    static const uint32_t session_counts[] = {10, 100, MAX_SESSIONS};
+    char message[96];
+    (void) runSessions(MAX_SESSIONS);                                       // Warm up the caches
+    for (size_t i = 0; i < sizeof(session_counts) / sizeof(session_counts[0]); i++)
+    {
+        const double ns_per_frame = runSessions(session_counts[i]);
+        snprintf(message, sizeof(message), "%3u sessions: %.1f ns per single-frame transfer",
+                 (unsigned) session_counts[i], ns_per_frame);
+        TEST_MESSAGE(message);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_every_session_keeps_its_state);
+    RUN_TEST(test_descriptors_spread_over_buckets);
+    RUN_TEST(test_benchmark_lookup_cost_per_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,231 @@
+/*
+ * RX payload reader: reads through a CanardRxReader match canardDecodeScalar() at every width and offset, the generated
+ * decoders still round-trip a multi-frame message, and a sequential decode no longer walks the block list per field.
+ */
+#include <unity.h>
+#include <canard.h>
+#include <uavcan.protocol.GetNodeInfo_res.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_PAYLOAD_LEN         240U
+#define BENCHMARK_PAYLOAD_LEN   224U
+#define BENCHMARK_ROUNDS        20000U
+
+static uint8_t tx_pool[16384];
+static uint8_t rx_pool[16384];
+static CanardInstance tx_ins;
+static CanardInstance rx_ins;
+static uint8_t payload[UAVCAN_PROTOCOL_GETNODEINFO_RESPONSE_MAX_SIZE];
+static uint16_t payload_len;
+static void (*check_transfer)(const CanardRxTransfer* transfer);
+static uint32_t received;
+
+static bool shouldAccept(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                         CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = UAVCAN_PROTOCOL_GETNODEINFO_RESPONSE_SIGNATURE;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    received++;
+    check_transfer(transfer);
+}
+
+/// Sends the first 'len' bytes of 'payload' from tx_ins to rx_ins, frame by frame
+static void transfer(uint16_t len, void (*check)(const CanardRxTransfer* transfer))
+{
+    static uint8_t transfer_id;
+    canardInit(&tx_ins, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx_ins, 5);
+    canardInit(&rx_ins, rx_pool, sizeof(rx_pool), onReception, shouldAccept, NULL);
+    canardSetLocalNodeID(&rx_ins, 9);
+    check_transfer = check;
+    received = 0;
+
+    TEST_ASSERT_GREATER_THAN_INT16(0, canardBroadcast(&tx_ins, UAVCAN_PROTOCOL_GETNODEINFO_RESPONSE_SIGNATURE,
+                                                      UAVCAN_PROTOCOL_GETNODEINFO_RESPONSE_ID, &transfer_id,
+                                                      CANARD_TRANSFER_PRIORITY_MEDIUM, payload, len));
+    uint64_t timestamp_usec = 1;
+    for (const CanardCANFrame* frame = canardPeekTxQueue(&tx_ins); frame != NULL; frame = canardPeekTxQueue(&tx_ins))
+    {
+        TEST_ASSERT_GREATER_OR_EQUAL_INT16(0, canardHandleRxFrame(&rx_ins, frame, timestamp_usec++));
+        canardPopTxQueue(&tx_ins);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, received);
+}
+
+static uint64_t readContiguous(uint32_t bit_offset, uint8_t bit_length)
+{
+    CanardRxTransfer contiguous;
+    memset(&contiguous, 0, sizeof(contiguous));
+    contiguous.payload_head = payload;
+    contiguous.payload_len = payload_len;
+    uint64_t value = 0;
+    (void) canardDecodeScalar(&contiguous, bit_offset, bit_length, false, &value);
+    return value;
+}
+
+static void checkReads(const CanardRxTransfer* transfer)
+{
+    TEST_ASSERT_EQUAL_UINT16(payload_len, transfer->payload_len);
+    for (uint8_t width = 1; width <= 64; width = (uint8_t)(width + ((width < 8) ? 1 : 7)))
+    {
+        CanardRxReader reader;
+        canardInitRxReader(&reader, transfer);
+        for (uint32_t offset = 0; offset < payload_len * 8U; offset += width)
+        {
+            uint64_t value = 0;
+            TEST_ASSERT_GREATER_THAN_INT16(0, canardReadScalar(&reader, offset, width, false, &value));
+            TEST_ASSERT_EQUAL_UINT64(readContiguous(offset, width), value);
+        }
+    }
+
+    // Random access through one reader, including reads behind the block it is parked on
+    CanardRxReader reader;
+    canardInitRxReader(&reader, transfer);
+    for (uint32_t i = 0; i < 2000U; i++)
+    {
+        const uint32_t offset = (uint32_t) rand() % (payload_len * 8U);
+        const uint8_t width = (uint8_t)(1 + rand() % 64);
+        uint64_t value = 0;
+        uint64_t reference = 0;
+        (void) canardReadScalar(&reader, offset, width, false, &value);
+        (void) canardDecodeScalar(transfer, offset, width, false, &reference);
+        TEST_ASSERT_EQUAL_UINT64(reference, value);
+        TEST_ASSERT_EQUAL_UINT64(readContiguous(offset, width), value);
+    }
+}
+
+static struct uavcan_protocol_GetNodeInfoResponse sent_info;
+
+static void checkGetNodeInfo(const CanardRxTransfer* transfer)
+{
+    struct uavcan_protocol_GetNodeInfoResponse decoded;
+    memset(&decoded, 0, sizeof(decoded));
+    TEST_ASSERT_FALSE(uavcan_protocol_GetNodeInfoResponse_decode(transfer, &decoded));
+    TEST_ASSERT_EQUAL_UINT32(sent_info.status.uptime_sec, decoded.status.uptime_sec);
+    TEST_ASSERT_EQUAL_MEMORY(sent_info.hardware_version.unique_id, decoded.hardware_version.unique_id,
+                             sizeof(decoded.hardware_version.unique_id));
+    TEST_ASSERT_EQUAL_UINT8(sent_info.hardware_version.certificate_of_authenticity.len,
+                            decoded.hardware_version.certificate_of_authenticity.len);
+    TEST_ASSERT_EQUAL_MEMORY(sent_info.hardware_version.certificate_of_authenticity.data,
+                             decoded.hardware_version.certificate_of_authenticity.data,
+                             decoded.hardware_version.certificate_of_authenticity.len);
+    TEST_ASSERT_EQUAL_UINT8(sent_info.name.len, decoded.name.len);
+    TEST_ASSERT_EQUAL_MEMORY(sent_info.name.data, decoded.name.data, decoded.name.len);
+}
+
+static double elapsed_ns;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static void benchmarkDecodeScalar(const CanardRxTransfer* transfer)
+{
+    volatile uint32_t sum = 0;
+    const double start = nowSeconds();
+    for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        for (uint32_t offset = 0; offset < BENCHMARK_PAYLOAD_LEN * 8U; offset += 16U)
+        {
+            uint16_t value = 0;
+            (void) canardDecodeScalar(transfer, offset, 16, false, &value);
+            sum += value;
+        }
+    }
+    elapsed_ns = (nowSeconds() - start) * 1e9 / BENCHMARK_ROUNDS;
+}
+
+static void benchmarkReader(const CanardRxTransfer* transfer)
+{
+    volatile uint32_t sum = 0;
+    const double start = nowSeconds();
+    for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        CanardRxReader reader;
+        canardInitRxReader(&reader, transfer);
+        for (uint32_t offset = 0; offset < BENCHMARK_PAYLOAD_LEN * 8U; offset += 16U)
+        {
+            uint16_t value = 0;
+            (void) canardReadScalar(&reader, offset, 16, false, &value);
+            sum += value;
+        }
+    }
+    elapsed_ns = (nowSeconds() - start) * 1e9 / BENCHMARK_ROUNDS;
+}
+
+void setUp(void)
+{
+    srand(7);
+    for (uint32_t i = 0; i < MAX_PAYLOAD_LEN; i++)
+    {
+        payload[i] = (uint8_t) rand();
+    }
+}
+
+void tearDown(void)
+{
+}
+
+void test_reader_matches_contiguous_payload(void)
+{
+    for (payload_len = 1; payload_len <= MAX_PAYLOAD_LEN; payload_len = (uint16_t)(payload_len + 13U))
+    {
+        transfer(payload_len, checkReads);
+    }
+}
+
+void test_generated_decoder_round_trip(void)
+{
+    memset(&sent_info, 0, sizeof(sent_info));
+    sent_info.status.uptime_sec = 123456;
+    for (uint8_t i = 0; i < sizeof(sent_info.hardware_version.unique_id); i++)
+    {
+        sent_info.hardware_version.unique_id[i] = (uint8_t)(i * 17U);
+    }
+    sent_info.hardware_version.certificate_of_authenticity.len = 100;
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        sent_info.hardware_version.certificate_of_authenticity.data[i] = (uint8_t)(255U - i);
+    }
+    strcpy((char*) sent_info.name.data, "org.arduino.dronecan.reader_test");
+    sent_info.name.len = (uint8_t) strlen((const char*) sent_info.name.data);
+
+    payload_len = (uint16_t) uavcan_protocol_GetNodeInfoResponse_encode(&sent_info, payload
+#if CANARD_ENABLE_TAO_OPTION
+                                                                        , true
+#endif
+                                                                        );
+    transfer(payload_len, checkGetNodeInfo);
+}
+
+void test_benchmark_sequential_decode(void)
+{
+    char message[112];
+    payload_len = BENCHMARK_PAYLOAD_LEN;
+    transfer(payload_len, benchmarkDecodeScalar);                          // Warm up the caches
+    transfer(payload_len, benchmarkDecodeScalar);
+    const double scalar_ns = elapsed_ns;
+    transfer(payload_len, benchmarkReader);
+    const double reader_ns = elapsed_ns;
+    snprintf(message, sizeof(message), "%u-byte payload as %u uint16 fields: canardDecodeScalar %.0f ns, reader %.0f ns",
+             (unsigned) BENCHMARK_PAYLOAD_LEN, (unsigned)(BENCHMARK_PAYLOAD_LEN / 2U), scalar_ns, reader_ns);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_reader_matches_contiguous_payload);
+    RUN_TEST(test_generated_decoder_round_trip);
+    RUN_TEST(test_benchmark_sequential_decode);
+    return UNITY_END();
+}
@@ -0,0 +1,289 @@
+/*
+ * Scheduler, run from a fake clock: the first slots are spread over the shortest period so that publishers of the
+ * same rate, or of multiples of it, never fire in the same call; a late call counts the missed slots as overruns and
+ * publishes once, on the original grid; jitter statistics follow the lateness of each slot; and publishers that
+ * encode into the buffer and publishers that write into a TX stream queue the same frames and skip alike.
+ */
+#include <unity.h>
+#include <canard_scheduler.h>
+#include <string.h>
+
+#define SIGNATURE               0x1234U
+#define MAX_PUBLISHERS          8U
+#define PAYLOAD_LEN             19U         ///< With the CRC, exactly three classic frames
+#define TICK_USEC               100U
+
+static uint8_t pool[400U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t buffer[64];
+static CanardInstance ins;
+static CanardScheduler scheduler;
+static CanardPublisher publishers[MAX_PUBLISHERS];
+static uint32_t fired[MAX_PUBLISHERS];      ///< Publications of each publisher
+static uint64_t first_fired_usec[MAX_PUBLISHERS];
+static uint8_t last_fired;                  ///< Index of the publisher that published last
+static uint64_t now_usec;
+static bool skip_next;
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&ins, 5);
+    canardInitScheduler(&scheduler, buffer, sizeof(buffer));
+    memset(fired, 0, sizeof(fired));
+    memset(first_fired_usec, 0, sizeof(first_fired_usec));
+    now_usec = 1000000U;
+    skip_next = false;
+}
+
+void tearDown(void)
+{
+}
+
+static uint8_t indexOf(const CanardPublisher* publisher)
+{
+    return (uint8_t)(publisher - publishers);
+}
+
+static void recordFired(const CanardPublisher* publisher)
+{
+    const uint8_t index = indexOf(publisher);
+    last_fired = index;
+    if (fired[index]++ == 0U)
+    {
+        first_fired_usec[index] = now_usec;
+    }
+}
+
+static int32_t encodeSample(CanardPublisher* publisher, CanardTxTransfer* transfer, uint8_t* out, uint16_t size)
+{
+    TEST_ASSERT_TRUE(size >= PAYLOAD_LEN);
+    if (skip_next)
+    {
+        return -1;
+    }
+    recordFired(publisher);
+    for (uint8_t i = 0; i < PAYLOAD_LEN; i++)
+    {
+        out[i] = (uint8_t)(publisher->data_type_id + i);
+    }
+    return PAYLOAD_LEN;
+}
+
+static int16_t writeSample(CanardPublisher* publisher, CanardTxStream* stream)
+{
+    for (uint8_t i = 0; i < PAYLOAD_LEN; i++)
+    {
+        const uint8_t byte = (uint8_t)(publisher->data_type_id + i);
+        canardTxStreamWrite(stream, &byte, 1);
+    }
+    if (skip_next)
+    {
+        return -1;                                                          // After taking frames, which are released
+    }
+    recordFired(publisher);
+    return 0;
+}
+
+static void addPublisher(uint8_t index, uint32_t period_usec, bool write)
+{
+    CanardPublisher* const publisher = &publishers[index];
+    canardInitPublisher(publisher);
+    publisher->data_type_signature = SIGNATURE;
+    publisher->data_type_id = (uint16_t)(100U + index);
+    publisher->period_usec = period_usec;
+    publisher->encode = write ? NULL : encodeSample;
+    publisher->write = write ? writeSample : NULL;
+#if CANARD_MULTI_IFACE
+    publisher->iface_mask = 1U;
+#endif
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardAddPublisher(&scheduler, publisher));
+}
+
+static void drainQueue(void)
+{
+    while (canardPeekTxQueue(&ins) != NULL)
+    {
+        canardPopTxQueue(&ins);
+    }
+}
+
+/// Runs the scheduler at every tick for the given time; no call may queue more than one message
+static void runFor(uint64_t duration_usec)
+{
+    const uint64_t end_usec = now_usec + duration_usec;
+    for (; now_usec < end_usec; now_usec += TICK_USEC)
+    {
+        TEST_ASSERT_TRUE(canardRunScheduler(&scheduler, &ins, now_usec) <= 1U);
+        drainQueue();
+    }
+}
+
+static void testStaggeredSlotsNeverCoincide(void)
+{
+    // Four publishers at one rate and two at half of it, all first slots within the shorter period
+    static const uint32_t Periods[] = {12000U, 12000U, 12000U, 12000U, 24000U, 24000U};
+    const uint8_t count = sizeof(Periods) / sizeof(Periods[0]);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        addPublisher(i, Periods[i], (i % 2U) != 0U);
+    }
+    const uint64_t start_usec = now_usec;
+    runFor(1200000U);
+
+    uint64_t first_slots = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(1200000U / Periods[i], fired[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, publishers[i].statistics.overruns);
+        TEST_ASSERT_EQUAL_UINT32(0, publishers[i].statistics.max_jitter_usec);
+        TEST_ASSERT_TRUE(first_fired_usec[i] - start_usec < Periods[0]);
+        // The slots are spaced by an equal share of the shortest period
+        TEST_ASSERT_EQUAL_UINT64(0, (first_fired_usec[i] - start_usec) % (Periods[0] / count));
+        first_slots |= 1ULL << ((first_fired_usec[i] - start_usec) / (Periods[0] / count));
+    }
+    TEST_ASSERT_EQUAL_UINT64((1ULL << count) - 1U, first_slots);
+}
+
+static void testLateCallCountsOverrunsWithoutBurst(void)
+{
+    addPublisher(0, 1000U, false);
+    const uint64_t start_usec = now_usec;
+    TEST_ASSERT_EQUAL_UINT16(1, canardRunScheduler(&scheduler, &ins, now_usec));
+
+    // Five and a half periods later: the slots at 1, 2, 3 and 4 ms are missed, the one at 5 ms is served late
+    now_usec = start_usec + 5500U;
+    TEST_ASSERT_EQUAL_UINT16(1, canardRunScheduler(&scheduler, &ins, now_usec));
+    TEST_ASSERT_EQUAL_UINT32(4, publishers[0].statistics.overruns);
+    TEST_ASSERT_EQUAL_UINT32(500, publishers[0].statistics.last_jitter_usec);
+    TEST_ASSERT_EQUAL_UINT16(2, fired[0]);
+    TEST_ASSERT_EQUAL_UINT16(0, canardRunScheduler(&scheduler, &ins, now_usec));
+
+    // The phase is kept: the next slot is at 6 ms, not 6.5 ms
+    TEST_ASSERT_EQUAL_UINT16(0, canardRunScheduler(&scheduler, &ins, start_usec + 5999U));
+    TEST_ASSERT_EQUAL_UINT16(1, canardRunScheduler(&scheduler, &ins, start_usec + 6000U));
+    TEST_ASSERT_EQUAL_UINT32(0, publishers[0].statistics.last_jitter_usec);
+    TEST_ASSERT_EQUAL_UINT32(4, publishers[0].statistics.overruns);
+    TEST_ASSERT_EQUAL_UINT32(3, publishers[0].statistics.publications);
+}
+
+static void testJitterStatistics(void)
+{
+    static const uint32_t LateUsec[] = {0U, 100U, 300U, 50U, 999U};
+    addPublisher(0, 1000U, false);
+    const uint64_t start_usec = now_usec;
+
+    uint64_t total_usec = 0;
+    uint32_t max_usec = 0;
+    for (uint8_t i = 0; i < sizeof(LateUsec) / sizeof(LateUsec[0]); i++)
+    {
+        now_usec = start_usec + 1000U * i + LateUsec[i];
+        TEST_ASSERT_EQUAL_UINT16(1, canardRunScheduler(&scheduler, &ins, now_usec));
+        total_usec += LateUsec[i];
+        max_usec = (LateUsec[i] > max_usec) ? LateUsec[i] : max_usec;
+        TEST_ASSERT_EQUAL_UINT32(LateUsec[i], publishers[0].statistics.last_jitter_usec);
+        TEST_ASSERT_EQUAL_UINT32(max_usec, publishers[0].statistics.max_jitter_usec);
+        TEST_ASSERT_EQUAL_UINT64(total_usec, publishers[0].statistics.total_jitter_usec);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, publishers[0].statistics.overruns);
+}
+
+static void testEncodeAndWriteQueueTheSameFrames(void)
+{
+    // Neither or both callbacks, or no period, are refused
+    CanardPublisher bad;
+    canardInitPublisher(&bad);
+    bad.period_usec = 1000U;
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardAddPublisher(&scheduler, &bad));
+    bad.encode = encodeSample;
+    bad.write = writeSample;
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardAddPublisher(&scheduler, &bad));
+    bad.write = NULL;
+    bad.period_usec = 0;
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardAddPublisher(&scheduler, &bad));
+
+    // Publisher 0 encodes and publisher 1 writes the same payload under the same data type
+    addPublisher(0, 1000U, false);
+    addPublisher(1, 1000U, true);
+    publishers[1].data_type_id = publishers[0].data_type_id;
+    runFor(1000U);
+    TEST_ASSERT_EQUAL_UINT32(1, fired[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, fired[1]);
+
+    // Next period: both publish the same frames
+    const uint64_t slot_usec = now_usec;
+    CanardCANFrame frames[2][4];
+    uint8_t counts[2] = {0, 0};
+    for (uint64_t t = slot_usec; t < slot_usec + 1000U; t += TICK_USEC)
+    {
+        if (canardRunScheduler(&scheduler, &ins, t) == 0U)
+        {
+            continue;
+        }
+        const uint8_t which = last_fired;
+        for (const CanardCANFrame* frame = canardPeekTxQueue(&ins); frame != NULL; frame = canardPeekTxQueue(&ins))
+        {
+            TEST_ASSERT_TRUE(counts[which] < 4U);
+            frames[which][counts[which]++] = *frame;
+            canardPopTxQueue(&ins);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(3, counts[0]);
+    TEST_ASSERT_EQUAL_UINT8(counts[0], counts[1]);
+    for (uint8_t f = 0; f < counts[0]; f++)
+    {
+        TEST_ASSERT_EQUAL_HEX32(frames[0][f].id, frames[1][f].id);
+        TEST_ASSERT_EQUAL_UINT8(frames[0][f].data_len, frames[1][f].data_len);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(frames[0][f].data, frames[1][f].data, frames[0][f].data_len);
+    }
+    now_usec = slot_usec + 1000U;
+
+    // A skipped period is counted for both and leaves no frames behind
+    skip_next = true;
+    runFor(1000U);
+    TEST_ASSERT_EQUAL_UINT32(1, publishers[0].statistics.skipped);
+    TEST_ASSERT_EQUAL_UINT32(1, publishers[1].statistics.skipped);
+    TEST_ASSERT_EQUAL_UINT16(0, canardGetPoolAllocatorStatistics(&ins).current_usage_blocks);
+    TEST_ASSERT_EQUAL_UINT32(2, publishers[0].statistics.publications);
+    TEST_ASSERT_EQUAL_UINT32(2, publishers[1].statistics.publications);
+
+    // A full pool is a TX error for both
+    skip_next = false;
+    canardSetPoolQuota(&ins, CanardPoolConsumerTxItem, 1);
+    runFor(1000U);
+    TEST_ASSERT_EQUAL_UINT32(1, publishers[0].statistics.tx_errors);
+    TEST_ASSERT_EQUAL_UINT32(1, publishers[1].statistics.tx_errors);
+    TEST_ASSERT_EQUAL_UINT16(0, canardGetPoolAllocatorStatistics(&ins).current_usage_blocks);
+}
+
+static void testThrottleDividerOnQueueDepth(void)
+{
+    addPublisher(0, 1000U, false);
+    publishers[0].throttle_divider = 4;
+    canardSetSchedulerQueueThrottle(&scheduler, 3, 0);
+
+    // Nothing drains the queue: after the first publication fills it, only one slot in four is published
+    for (uint32_t slot = 0; slot < 9U; slot++)
+    {
+        canardRunScheduler(&scheduler, &ins, now_usec + 1000U * slot);
+    }
+    TEST_ASSERT_TRUE(publishers[0].throttled);
+    TEST_ASSERT_EQUAL_UINT32(3, publishers[0].statistics.publications);
+    TEST_ASSERT_EQUAL_UINT32(6, publishers[0].statistics.throttled);
+
+    // Once the queue is down to the release threshold, every slot is published again
+    drainQueue();
+    canardRunScheduler(&scheduler, &ins, now_usec + 9000U);
+    TEST_ASSERT_FALSE(publishers[0].throttled);
+    TEST_ASSERT_EQUAL_UINT32(4, publishers[0].statistics.publications);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testStaggeredSlotsNeverCoincide);
+    RUN_TEST(testLateCallCountsOverrunsWithoutBurst);
+    RUN_TEST(testJitterStatistics);
+    RUN_TEST(testEncodeAndWriteQueueTheSameFrames);
+    RUN_TEST(testThrottleDividerOnQueueDepth);
+    return UNITY_END();
+}
@@ -0,0 +1,207 @@
+/*
+ * Transport counters: each way a frame can be rejected lands in its own rx_errors slot, and the frame, transfer and
+ * TX counters count what actually happened, not just the same thing on both RX entry points.
+ */
+#include <unity.h>
+#include <canard.h>
+#include <string.h>
+
+#define SIGNATURE               0x1234U
+#define DATA_TYPE_ID            1000U
+#define PAYLOAD_LEN             20U                 // 2 CRC bytes + 20 payload bytes: frames of 5, 7, 7 and 1 bytes
+#define FRAMES_PER_TRANSFER     4U
+#define LOCAL_NODE_ID           10U
+#define REMOTE_NODE_ID          7U
+#define OTHER_NODE_ID           8U
+
+static uint8_t tx_pool[32U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[32U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t other_pool[32U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance other;                        ///< A second sender, the receiver has no state for it
+static CanardInstance rx;
+static CanardCANFrame frames[FRAMES_PER_TRANSFER];
+static uint8_t transfer_id;
+static uint32_t received;
+static uint64_t now_usec;
+static uint32_t fed_bits;
+
+static bool shouldAccept(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                         CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return data_type_id == DATA_TYPE_ID;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    received++;
+}
+
+/// Queues one transfer on a TX instance and takes its frames off the queue into 'frames'
+static void makeTransfer(CanardInstance* sender)
+{
+    uint8_t payload[PAYLOAD_LEN];
+    for (uint8_t i = 0; i < PAYLOAD_LEN; i++)
+    {
+        payload[i] = (uint8_t)(transfer_id * 3U + i);
+    }
+    TEST_ASSERT_EQUAL_INT16(FRAMES_PER_TRANSFER,
+                            canardBroadcast(sender, SIGNATURE, DATA_TYPE_ID, &transfer_id, CANARD_TRANSFER_PRIORITY_MEDIUM,
+                                            payload, PAYLOAD_LEN
+#if CANARD_ENABLE_DEADLINE
+                                            , UINT64_MAX
+#endif
+#if CANARD_MULTI_IFACE
+                                            , 1U
+#endif
+#if CANARD_ENABLE_CANFD
+                                            , false
+#endif
+                                            ));
+    for (uint8_t i = 0; i < FRAMES_PER_TRANSFER; i++)
+    {
+        const CanardCANFrame* const frame = canardPeekTxQueue(sender);
+        TEST_ASSERT_NOT_NULL(frame);
+        frames[i] = *frame;
+        canardPopTxQueue(sender);
+    }
+    TEST_ASSERT_NULL(canardPeekTxQueue(sender));
+}
+
+/// Worst case bits of an extended frame, worked out by hand from the frame layout instead of by the library
+static uint32_t extendedFrameBits(uint8_t data_len)
+{
+    const uint32_t stuffed = 1U + 11U + 1U + 1U + 18U + 1U + 2U + 4U + 8U * data_len + 15U;    // SOF to CRC
+    return stuffed + (stuffed - 1U) / 4U + 1U + 2U + 7U + 3U;    // Stuff bits, CRC delimiter, ACK, EOF, IFS
+}
+
+static int16_t feed(const CanardCANFrame* frame)
+{
+    now_usec += 100U;
+    fed_bits += extendedFrameBits(frame->data_len);
+    return canardHandleRxFrame(&rx, frame, now_usec);
+}
+
+/// A single-frame transfer with the given CAN ID, carrying one payload byte
+static CanardCANFrame singleFrame(uint32_t id)
+{
+    CanardCANFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.id = CANARD_CAN_FRAME_EFF | ((uint32_t) CANARD_TRANSFER_PRIORITY_MEDIUM << 24U) | id;
+    frame.data[0] = 0x55U;
+    frame.data[1] = 0xC0U;
+    frame.data_len = 2;
+    return frame;
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, REMOTE_NODE_ID);
+    canardInit(&other, other_pool, sizeof(other_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&other, OTHER_NODE_ID);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onReception, shouldAccept, NULL);
+    canardSetLocalNodeID(&rx, LOCAL_NODE_ID);
+    transfer_id = 0;
+    received = 0;
+    now_usec = 1000U;
+    fed_bits = 0;
+}
+
+void tearDown(void)
+{
+}
+void test_every_rejection_lands_in_its_own_slot(void)
+{
+    // A good transfer
+    makeTransfer(&tx);
+    for (uint8_t i = 0; i < FRAMES_PER_TRANSFER; i++)
+    {
+        TEST_ASSERT_EQUAL_INT16(CANARD_OK, feed(&frames[i]));
+    }
+
+    // A payload bit flipped on the way: the last frame fails the transfer CRC
+    makeTransfer(&tx);
+    frames[1].data[3] ^= 1U;
+    for (uint8_t i = 0; i < FRAMES_PER_TRANSFER - 1U; i++)
+    {
+        TEST_ASSERT_EQUAL_INT16(CANARD_OK, feed(&frames[i]));
+    }
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_BAD_CRC, feed(&frames[FRAMES_PER_TRANSFER - 1U]));
+
+    // The first frame of a transfer from a node never heard before is lost: the rest have nothing to attach to
+    makeTransfer(&other);
+    for (uint8_t i = 1; i < FRAMES_PER_TRANSFER; i++)
+    {
+        TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_MISSED_START, feed(&frames[i]));
+    }
+
+    // A frame seen twice, as after a lost ACK: the copy has the wrong toggle, and the transfer still arrives
+    makeTransfer(&tx);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, feed(&frames[0]));
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, feed(&frames[1]));
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_WRONG_TOGGLE, feed(&frames[1]));
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, feed(&frames[2]));
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, feed(&frames[3]));
+
+    // A message nobody wants, and a request for another node
+    CanardCANFrame frame = singleFrame((2000UL << 8U) | REMOTE_NODE_ID);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_NOT_WANTED, feed(&frame));
+    frame = singleFrame((20UL << 16U) | (1UL << 15U) | ((LOCAL_NODE_ID + 1UL) << 8U) | (1UL << 7U) | REMOTE_NODE_ID);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_WRONG_ADDRESS, feed(&frame));
+
+    const CanardInstanceStatistics stats = canardGetStatistics(&rx);
+    uint32_t expected_errors[CANARD_NUM_RX_ERROR_CODES] = {0};
+    expected_errors[CANARD_ERROR_RX_BAD_CRC] = 1;
+    expected_errors[CANARD_ERROR_RX_MISSED_START] = FRAMES_PER_TRANSFER - 1U;
+    expected_errors[CANARD_ERROR_RX_WRONG_TOGGLE] = 1;
+    expected_errors[CANARD_ERROR_RX_NOT_WANTED] = 1;
+    expected_errors[CANARD_ERROR_RX_WRONG_ADDRESS] = 1;
+    for (uint8_t code = 0; code < CANARD_NUM_RX_ERROR_CODES; code++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(expected_errors[code], stats.rx_errors[code]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(4U * FRAMES_PER_TRANSFER + 2U, stats.rx_frames);
+    TEST_ASSERT_EQUAL_UINT32(fed_bits, stats.rx_bits);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.rx_transfers);
+    TEST_ASSERT_EQUAL_UINT32(2, received);
+}
+
+void test_tx_counters(void)
+{
+    for (uint8_t i = 0; i < 3U; i++)
+    {
+        makeTransfer(&tx);
+    }
+    static uint8_t huge_payload[sizeof(tx_pool)];
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY,
+                            canardBroadcast(&tx, SIGNATURE, DATA_TYPE_ID, &transfer_id,
+                                            CANARD_TRANSFER_PRIORITY_MEDIUM, huge_payload, sizeof(huge_payload)
+#if CANARD_ENABLE_DEADLINE
+                                            , UINT64_MAX
+#endif
+#if CANARD_MULTI_IFACE
+                                            , 1U
+#endif
+#if CANARD_ENABLE_CANFD
+                                            , false
+#endif
+                                            ));
+
+    const CanardInstanceStatistics stats = canardGetStatistics(&tx);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.tx_transfers);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.tx_errors);
+    TEST_ASSERT_EQUAL_UINT32(3U * FRAMES_PER_TRANSFER, stats.tx_frames_queued);
+    TEST_ASSERT_EQUAL_UINT32(3U * FRAMES_PER_TRANSFER, stats.tx_frames);
+    TEST_ASSERT_EQUAL_UINT32(3U * (3U * extendedFrameBits(8) + extendedFrameBits(2)),
+                             stats.tx_bits);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_every_rejection_lands_in_its_own_slot);
+    RUN_TEST(test_tx_counters);
+    return UNITY_END();
+}
@@ -0,0 +1,88 @@
+/*
+ * Subscription table: valid tables are sorted and dispatched from, rejected ones are left untouched.
+ */
+#include <unity.h>
+#include <canard.h>
+
+static uint8_t pool[64 * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static uint16_t last_data_type_id;
+
+static void onTransfer(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    last_data_type_id = transfer->data_type_id;
+}
+
+static int16_t receiveBroadcast(uint16_t data_type_id)
+{
+    CanardCANFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.id = CANARD_CAN_FRAME_EFF | ((uint32_t) data_type_id << 8U) | 42U;
+    frame.data[0] = 0xC0U;
+    frame.data_len = 1;
+    return canardHandleRxFrame(&ins, &frame, 1000);
+}
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&ins, 10);
+    last_data_type_id = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void test_valid_table_is_sorted_and_dispatched(void)
+{
+    CanardSubscription table[] = {
+        {1030, CanardTransferTypeBroadcast, 0, onTransfer},
+        {1010, CanardTransferTypeBroadcast, 0, onTransfer},
+        {1020, CanardTransferTypeBroadcast, 0, onTransfer},
+    };
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardSetSubscriptions(&ins, table, 3));
+    TEST_ASSERT_EQUAL_UINT16(1010, table[0].data_type_id);
+    TEST_ASSERT_EQUAL_UINT16(1020, table[1].data_type_id);
+    TEST_ASSERT_EQUAL_UINT16(1030, table[2].data_type_id);
+
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, receiveBroadcast(1020));
+    TEST_ASSERT_EQUAL_UINT16(1020, last_data_type_id);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_RX_NOT_WANTED, receiveBroadcast(1025));
+}
+
+void test_rejected_table_is_not_reordered(void)
+{
+    CanardSubscription installed[] = {
+        {1010, CanardTransferTypeBroadcast, 0, onTransfer},
+    };
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardSetSubscriptions(&ins, installed, 1));
+
+    CanardSubscription duplicate[] = {
+        {1030, CanardTransferTypeBroadcast, 0, onTransfer},
+        {1020, CanardTransferTypeBroadcast, 0, onTransfer},
+        {1030, CanardTransferTypeBroadcast, 0, onTransfer},
+    };
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardSetSubscriptions(&ins, duplicate, 3));
+    TEST_ASSERT_EQUAL_UINT16(1030, duplicate[0].data_type_id);
+    TEST_ASSERT_EQUAL_UINT16(1020, duplicate[1].data_type_id);
+
+    CanardSubscription no_handler[] = {
+        {1030, CanardTransferTypeBroadcast, 0, onTransfer},
+        {1020, CanardTransferTypeBroadcast, 0, NULL},
+    };
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardSetSubscriptions(&ins, no_handler, 2));
+    TEST_ASSERT_EQUAL_UINT16(1030, no_handler[0].data_type_id);
+
+    // The previous table stays installed
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, receiveBroadcast(1010));
+    TEST_ASSERT_EQUAL_UINT16(1010, last_data_type_id);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_valid_table_is_sorted_and_dispatched);
+    RUN_TEST(test_rejected_table_is_not_reordered);
+    return UNITY_END();
+}
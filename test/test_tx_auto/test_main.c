@@ -0,0 +1,116 @@
+/*
+ * Transfer IDs kept by the library for canardBroadcastAuto() and canardRequestAuto(): each descriptor counts on its
+ * own, slots of descriptors that went quiet are reused, and a working set larger than the table is refused instead of
+ * having its transfer IDs reset over and over.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+
+#define SIGNATURE               0x1234U
+
+static uint8_t pool[64U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static const uint8_t empty_payload[1];
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&ins, 5);
+}
+
+void tearDown(void)
+{
+}
+
+/// Broadcasts an empty message and returns the transfer ID it went out with, or a negative error code
+static int16_t broadcast(uint16_t data_type_id)
+{
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = data_type_id;
+    transfer.priority = CANARD_TRANSFER_PRIORITY_MEDIUM;
+    transfer.payload = empty_payload;
+#if CANARD_MULTI_IFACE
+    transfer.iface_mask = 1U;
+#endif
+    const int16_t result = canardBroadcastAuto(&ins, &transfer);
+    if (result < 0)
+    {
+        return result;
+    }
+    const CanardCANFrame* const frame = canardPeekTxQueue(&ins);
+    const int16_t transfer_id = (int16_t)(frame->data[frame->data_len - 1U] & 31U);
+    canardPopTxQueue(&ins);
+    return transfer_id;
+}
+
+static void testSeparateCounters(void)
+{
+    TEST_ASSERT_EQUAL_INT16(0, broadcast(100));
+    TEST_ASSERT_EQUAL_INT16(1, broadcast(100));
+    TEST_ASSERT_EQUAL_INT16(0, broadcast(101));
+    TEST_ASSERT_EQUAL_INT16(2, broadcast(100));
+
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = 100;
+    transfer.payload = empty_payload;
+#if CANARD_MULTI_IFACE
+    transfer.iface_mask = 1U;
+#endif
+    TEST_ASSERT_EQUAL_INT16(1, canardRequestAuto(&ins, 42, &transfer));
+    TEST_ASSERT_EQUAL_HEX8(0xC0U, canardPeekTxQueue(&ins)->data[0]);   // A request to 42 is its own descriptor
+    canardPopTxQueue(&ins);
+}
+
+static void testQuietSlotsAreReused(void)
+{
+    // Fill every slot, then keep only the first half busy
+    for (uint16_t id = 0; id < CANARD_TX_TRANSFER_ID_SLOTS; id++)
+    {
+        TEST_ASSERT_EQUAL_INT16(0, broadcast((uint16_t)(100U + id)));
+    }
+    for (uint16_t round = 0; round < 3; round++)
+    {
+        for (uint16_t id = 0; id < CANARD_TX_TRANSFER_ID_SLOTS / 2U; id++)
+        {
+            TEST_ASSERT_EQUAL_INT16((int16_t)(round + 1U), broadcast((uint16_t)(100U + id)));
+        }
+    }
+
+    // New descriptors take the quiet slots, and the busy ones keep counting
+    for (uint16_t id = 0; id < CANARD_TX_TRANSFER_ID_SLOTS / 2U; id++)
+    {
+        TEST_ASSERT_EQUAL_INT16(0, broadcast((uint16_t)(200U + id)));
+    }
+    for (uint16_t id = 0; id < CANARD_TX_TRANSFER_ID_SLOTS / 2U; id++)
+    {
+        TEST_ASSERT_EQUAL_INT16(4, broadcast((uint16_t)(100U + id)));
+        TEST_ASSERT_EQUAL_INT16(1, broadcast((uint16_t)(200U + id)));
+    }
+}
+
+static void testWorkingSetLargerThanSlots(void)
+{
+    // One descriptor more than there are slots, in turn: the last one never gets a slot
+    for (uint16_t round = 0; round < 4; round++)
+    {
+        for (uint16_t id = 0; id < CANARD_TX_TRANSFER_ID_SLOTS; id++)
+        {
+            TEST_ASSERT_EQUAL_INT16((int16_t) round, broadcast((uint16_t)(100U + id)));
+        }
+        TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, broadcast(100U + CANARD_TX_TRANSFER_ID_SLOTS));
+    }
+    TEST_ASSERT_EQUAL_UINT32(4, ins.statistics.tx_errors);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testSeparateCounters);
+    RUN_TEST(testQuietSlotsAreReused);
+    RUN_TEST(testWorkingSetLargerThanSlots);
+    return UNITY_END();
+}
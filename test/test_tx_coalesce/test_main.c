@@ -0,0 +1,170 @@
+/*
+ * TX coalescing: a coalescing broadcast replaces the queued transfer of its type and key as long as none of that
+ * transfer went out, through canardBroadcastObj() and through a TX stream alike. A transfer that has started keeps
+ * its remaining frames, transfers with another key or without coalescing stay, and every replaced transfer is counted
+ * in tx_coalesced.
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <string.h>
+
+#define SIGNATURE               0x1234U
+#define DATA_TYPE_ID            1092U
+#define PAYLOAD_LEN             19U         ///< With the CRC, exactly three classic frames
+#define FRAMES_PER_TRANSFER     3U
+
+static uint8_t tx_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx;
+static uint8_t transfer_id;
+static uint8_t received[8];                 ///< First payload byte of each transfer received
+static uint8_t received_count;
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    TEST_ASSERT_TRUE(received_count < sizeof(received));
+    TEST_ASSERT_EQUAL_UINT16(PAYLOAD_LEN, transfer->payload_len);
+    canardDecodeScalar(transfer, 0, 8, false, &received[received_count++]);
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 5);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onReception, acceptAll, NULL);
+    canardSetLocalNodeID(&rx, 10);
+    transfer_id = 0;
+    received_count = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static CanardTxTransfer makeTransfer(bool coalesce, uint8_t coalesce_key)
+{
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.transfer_type = CanardTransferTypeBroadcast;
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = DATA_TYPE_ID;
+    transfer.inout_transfer_id = &transfer_id;
+    transfer.priority = CANARD_TRANSFER_PRIORITY_LOW;
+    transfer.coalesce = coalesce;
+    transfer.coalesce_key = coalesce_key;
+#if CANARD_MULTI_IFACE
+    transfer.iface_mask = 1U;
+#endif
+    return transfer;
+}
+
+/// Broadcasts a sample whose payload starts with the given tag
+static void publish(uint8_t tag, bool coalesce, uint8_t coalesce_key)
+{
+    uint8_t payload[PAYLOAD_LEN] = {0};
+    payload[0] = tag;
+    CanardTxTransfer transfer = makeTransfer(coalesce, coalesce_key);
+    transfer.payload = payload;
+    transfer.payload_len = sizeof(payload);
+    TEST_ASSERT_EQUAL_INT16(FRAMES_PER_TRANSFER, canardBroadcastObj(&tx, &transfer));
+}
+
+/// Publishes the same sample through a TX stream
+static void publishStream(uint8_t tag, uint8_t coalesce_key)
+{
+    const uint8_t padding[PAYLOAD_LEN - 1U] = {0};
+    const CanardTxTransfer transfer = makeTransfer(true, 0);
+    CanardTxStream stream;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &tx, &transfer, 0));
+    canardTxStreamWrite(&stream, &tag, 1);
+    canardTxStreamWrite(&stream, padding, sizeof(padding));
+    stream.transfer.coalesce_key = coalesce_key;                            // May change until the commit
+    TEST_ASSERT_EQUAL_INT16(FRAMES_PER_TRANSFER, canardTxStreamCommit(&stream));
+}
+
+/// Sends the next frame of the TX queue to the receiver
+static void sendFrame(void)
+{
+    const CanardCANFrame* const frame = canardPeekTxQueue(&tx);
+    TEST_ASSERT_NOT_NULL(frame);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardHandleRxFrame(&rx, frame, 1000));
+    canardPopTxQueue(&tx);
+}
+
+/// Sends the rest of the TX queue to the receiver
+static void sendAll(void)
+{
+    while (canardPeekTxQueue(&tx) != NULL)
+    {
+        sendFrame();
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, canardGetPoolAllocatorStatistics(&tx).current_usage_blocks);
+}
+
+static void assertReceived(const uint8_t* tags, uint8_t count)
+{
+    TEST_ASSERT_EQUAL_UINT8(count, received_count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(tags, received, count);
+}
+
+static void testLatestSampleReplacesQueued(void)
+{
+    publish(1, true, 0);
+    publish(2, true, 0);
+    publishStream(3, 0);
+    TEST_ASSERT_EQUAL_UINT16(FRAMES_PER_TRANSFER, canardGetPoolAllocatorStatistics(&tx).current_usage_blocks);
+    TEST_ASSERT_EQUAL_UINT32(2, tx.statistics.tx_coalesced);
+
+    sendAll();
+    const uint8_t expected[] = {3};
+    assertReceived(expected, sizeof(expected));
+}
+
+static void testOtherKeysAndPlainTransfersStay(void)
+{
+    publish(1, true, 0);
+    publish(2, true, 1);
+    publishStream(3, 2);
+    publish(4, false, 0);
+    publish(5, true, 1);                                                    // Replaces only the sample of key 1
+    TEST_ASSERT_EQUAL_UINT32(1, tx.statistics.tx_coalesced);
+
+    sendAll();
+    const uint8_t expected[] = {1, 3, 4, 5};
+    assertReceived(expected, sizeof(expected));
+}
+
+static void testStartedTransferIsKept(void)
+{
+    publish(1, true, 0);
+    sendFrame();                                                            // The first sample is on its way
+    publish(2, true, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, tx.statistics.tx_coalesced);
+    TEST_ASSERT_EQUAL_UINT16(2U * FRAMES_PER_TRANSFER - 1U, canardGetPoolAllocatorStatistics(&tx).current_usage_blocks);
+
+    // A third sample replaces the second, which has not started, and still leaves the first alone
+    publishStream(3, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, tx.statistics.tx_coalesced);
+
+    sendAll();
+    const uint8_t expected[] = {1, 3};
+    assertReceived(expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_errors[CANARD_ERROR_RX_MISSED_START]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testLatestSampleReplacesQueued);
+    RUN_TEST(testOtherKeysAndPlainTransfersStay);
+    RUN_TEST(testStartedTransferIsKept);
+    return UNITY_END();
+}
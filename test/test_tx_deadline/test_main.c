@@ -0,0 +1,220 @@
+/*
+ * TX deadlines: canardPeekTxQueueUnexpired() drops an expired transfer with all of its frames, keeps sending a
+ * transfer whose first frame is already out even past its deadline, and counts every dropped transfer in tx_expired.
+ * A zero deadline means none. Under 130% of the bus capacity the receiver sees only whole transfers, each started
+ * before its deadline, and every transfer is either received or counted as expired.
+ */
+#include <unity.h>
+#include <canard.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SIGNATURE               0x1234U
+#define DATA_TYPE_ID            100U
+#define PAYLOAD_LEN             19U         ///< With the CRC, exactly three classic frames
+#define FRAMES_PER_TRANSFER     3U
+#define FRAME_USEC              100U        ///< Time the simulated bus takes to send one frame
+#define DEADLINE_USEC           (20U * FRAME_USEC)
+#define SIMULATED_TRANSFERS     1000U
+
+static uint8_t tx_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t rx_pool[100U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance tx;
+static CanardInstance rx;
+static uint8_t transfer_ids[CANARD_TRANSFER_PRIORITY_LOWEST + 1U];
+static uint32_t received;
+static uint32_t received_late;              ///< Transfers received whose first frame went out after the deadline
+static uint64_t first_frame_usec[CANARD_TRANSFER_PRIORITY_LOWEST + 1U]; ///< When each type last started a transfer
+static uint64_t now_usec;
+
+static bool acceptAll(const CanardInstance* instance, uint64_t* out_signature, uint16_t data_type_id,
+                      CanardTransferType transfer_type, uint8_t source_node_id)
+{
+    *out_signature = SIGNATURE;
+    return true;
+}
+
+static void onReception(CanardInstance* instance, CanardRxTransfer* transfer)
+{
+    TEST_ASSERT_EQUAL_UINT16(PAYLOAD_LEN, transfer->payload_len);
+    uint64_t deadline_usec = 0;
+    canardDecodeScalar(transfer, 0, 64, false, &deadline_usec);
+    received++;
+    received_late += (first_frame_usec[transfer->priority] > deadline_usec) ? 1U : 0U;
+}
+
+void setUp(void)
+{
+    canardInit(&tx, tx_pool, sizeof(tx_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&tx, 5);
+    canardInit(&rx, rx_pool, sizeof(rx_pool), onReception, acceptAll, NULL);
+    canardSetLocalNodeID(&rx, 10);
+    memset(transfer_ids, 0, sizeof(transfer_ids));
+    received = 0;
+    received_late = 0;
+    now_usec = 1000000U;
+}
+
+void tearDown(void)
+{
+}
+
+/// Queues a three frame transfer that carries its own deadline, with one data type per priority level
+static void broadcast(uint8_t priority, uint64_t deadline_usec)
+{
+    uint8_t payload[PAYLOAD_LEN] = {0};
+    for (uint8_t i = 0; i < 8U; i++)
+    {
+        payload[i] = (uint8_t)(deadline_usec >> (8U * i));
+    }
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.transfer_type = CanardTransferTypeBroadcast;
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = (uint16_t)(DATA_TYPE_ID + priority);
+    transfer.inout_transfer_id = &transfer_ids[priority];
+    transfer.priority = priority;
+    transfer.payload = payload;
+    transfer.payload_len = sizeof(payload);
+    transfer.deadline_usec = deadline_usec;
+#if CANARD_MULTI_IFACE
+    transfer.iface_mask = 1U;
+#endif
+    TEST_ASSERT_EQUAL_INT16(FRAMES_PER_TRANSFER, canardBroadcastObj(&tx, &transfer));
+}
+
+/// Sends the next unexpired frame, if any, to the receiver
+static bool sendFrame(void)
+{
+    const CanardCANFrame* const frame = canardPeekTxQueueUnexpired(&tx, now_usec);
+    if (frame == NULL)
+    {
+        return false;
+    }
+    if ((frame->data[frame->data_len - 1U] & 0x80U) != 0U)                  // Start of transfer
+    {
+        first_frame_usec[(frame->id >> 24U) & 0x1FU] = now_usec;            // Priority, hence data type
+    }
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardHandleRxFrame(&rx, frame, now_usec));
+    canardPopTxQueue(&tx);
+    return true;
+}
+
+static uint16_t queuedBlocks(void)
+{
+    return canardGetPoolAllocatorStatistics(&tx).current_usage_blocks;
+}
+
+static void testExpiredTransferIsDroppedWhole(void)
+{
+    broadcast(CANARD_TRANSFER_PRIORITY_HIGH, now_usec + 1000U);
+    broadcast(CANARD_TRANSFER_PRIORITY_LOW, now_usec + 5000U);
+    TEST_ASSERT_EQUAL_UINT16(2U * FRAMES_PER_TRANSFER, queuedBlocks());
+
+    // Not yet expired at its deadline
+    now_usec += 1000U;
+    TEST_ASSERT_NOT_NULL(canardPeekTxQueueUnexpired(&tx, now_usec));
+    TEST_ASSERT_EQUAL_UINT16(2U * FRAMES_PER_TRANSFER, queuedBlocks());
+
+    // Past it, all three frames go at once and the next transfer is on top
+    now_usec++;
+    TEST_ASSERT_TRUE(sendFrame());
+    TEST_ASSERT_EQUAL_UINT32(1, tx.statistics.tx_expired);
+    TEST_ASSERT_EQUAL_UINT16(FRAMES_PER_TRANSFER - 1U, queuedBlocks());
+    while (sendFrame())
+    {
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, received);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_errors[CANARD_ERROR_RX_MISSED_START]);
+}
+
+static void testStartedTransferIsSentToTheEnd(void)
+{
+    broadcast(CANARD_TRANSFER_PRIORITY_HIGH, now_usec + 1000U);
+    TEST_ASSERT_TRUE(sendFrame());
+
+    // The deadline passes while the transfer is on its way: the peek and the cleanup both leave it alone
+    now_usec += 2000U;
+    canardCleanupStaleTransfers(&tx, now_usec);
+    TEST_ASSERT_EQUAL_UINT16(FRAMES_PER_TRANSFER - 1U, queuedBlocks());
+    while (sendFrame())
+    {
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, received);
+    TEST_ASSERT_EQUAL_UINT32(0, tx.statistics.tx_expired);
+    TEST_ASSERT_EQUAL_UINT16(0, queuedBlocks());
+}
+
+static void testCleanupDropsWholeTransfers(void)
+{
+    broadcast(CANARD_TRANSFER_PRIORITY_HIGH, now_usec + 1000U);
+    broadcast(CANARD_TRANSFER_PRIORITY_HIGH, now_usec + 1000U);
+    broadcast(CANARD_TRANSFER_PRIORITY_LOW, now_usec + 5000U);
+    canardCleanupStaleTransfers(&tx, now_usec + 1001U);
+    TEST_ASSERT_EQUAL_UINT32(2, tx.statistics.tx_expired);
+    TEST_ASSERT_EQUAL_UINT16(FRAMES_PER_TRANSFER, queuedBlocks());
+}
+
+static void testZeroDeadlineNeverExpires(void)
+{
+    broadcast(CANARD_TRANSFER_PRIORITY_HIGH, 0);
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tx.tx_deadline_usec);              // Does not make the cleanup scan the queue
+
+    now_usec = UINT64_MAX - 1U;
+    canardCleanupStaleTransfers(&tx, now_usec);
+    TEST_ASSERT_EQUAL_UINT32(0, tx.statistics.cleanup_visited);
+    while (sendFrame())
+    {
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, received);
+    TEST_ASSERT_EQUAL_UINT32(0, tx.statistics.tx_expired);
+}
+
+static void testOverloadSendsOnlyWholeTimelyTransfers(void)
+{
+    // A transfer every 2.3 frame times offers 3 / 2.3 = 130% of what the bus sends
+    uint32_t queued = 0;
+    uint32_t offered_tenths = 0;
+    const uint64_t start_usec = now_usec;
+    while (queued < SIMULATED_TRANSFERS)
+    {
+        for (offered_tenths += 10U; (offered_tenths >= 23U) && (queued < SIMULATED_TRANSFERS); offered_tenths -= 23U)
+        {
+            broadcast((uint8_t)(CANARD_TRANSFER_PRIORITY_HIGH + queued % 8U), now_usec + DEADLINE_USEC);
+            queued++;
+        }
+        (void) sendFrame();
+        now_usec += FRAME_USEC;
+        if ((now_usec - start_usec) % DEADLINE_USEC == 0U)
+        {
+            canardCleanupStaleTransfers(&tx, now_usec);                     // Drops what starved below the top
+        }
+    }
+    while (sendFrame())
+    {
+        now_usec += FRAME_USEC;
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(0, queuedBlocks());
+    TEST_ASSERT_EQUAL_UINT32(SIMULATED_TRANSFERS, received + tx.statistics.tx_expired);
+    TEST_ASSERT_TRUE(tx.statistics.tx_expired > 0U);
+    TEST_ASSERT_EQUAL_UINT32(0, received_late);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_errors[CANARD_ERROR_RX_MISSED_START]);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.statistics.rx_errors[CANARD_ERROR_RX_WRONG_TOGGLE]);
+
+    char message[100];
+    snprintf(message, sizeof(message), "130%% load over %u ms: %u transfers received, %u expired",
+             (unsigned)((now_usec - start_usec) / 1000U), (unsigned) received, (unsigned) tx.statistics.tx_expired);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testExpiredTransferIsDroppedWhole);
+    RUN_TEST(testStartedTransferIsSentToTheEnd);
+    RUN_TEST(testCleanupDropsWholeTransfers);
+    RUN_TEST(testZeroDeadlineNeverExpires);
+    RUN_TEST(testOverloadSendsOnlyWholeTimelyTransfers);
+    return UNITY_END();
+}
@@ -0,0 +1,115 @@
+/*
+ * TX deadline bound: a transfer that has started going out is never removed by canardCleanupStaleTransfers(), even
+ * past its deadline, so it must not hold the bound that lets the cleanup skip the TX queue. Once the queue has been
+ * scanned, later cleanups must visit nothing until a transfer that has not started can actually have expired.
+ */
+#include <unity.h>
+#include <canard.h>
+
+#define SIGNATURE               0x1234U
+#define NUM_WAITING             16U
+#define STARTED_DEADLINE_USEC   1000U
+#define WAITING_DEADLINE_USEC   1000000U
+
+static uint8_t pool[100U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance ins;
+static uint8_t transfer_id;
+
+void setUp(void)
+{
+    canardInit(&ins, pool, sizeof(pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&ins, 5);
+}
+
+void tearDown(void)
+{
+}
+
+static int16_t broadcast(uint8_t priority, uint16_t payload_len, uint64_t deadline_usec)
+{
+    static const uint8_t payload[40] = {0};
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = 100;
+    transfer.inout_transfer_id = &transfer_id;
+    transfer.priority = priority;
+    transfer.payload = payload;
+    transfer.payload_len = payload_len;
+    transfer.deadline_usec = deadline_usec;
+    return canardBroadcastObj(&ins, &transfer);
+}
+
+static uint32_t queuedFrames(void)
+{
+    uint32_t frames = 0;
+    for (const CanardTxQueueItem* item = ins.tx_queues[0].head; item != NULL; item = item->next)
+    {
+        frames++;
+    }
+    return frames;
+}
+
+static void testStartedTransferDoesNotHoldTheBound(void)
+{
+    // One multi-frame transfer goes out first and is interrupted after its first frame
+    const int16_t started_frames = broadcast(CANARD_TRANSFER_PRIORITY_HIGHEST, 40, STARTED_DEADLINE_USEC);
+    TEST_ASSERT_TRUE(started_frames > 1);
+    for (uint8_t i = 0; i < NUM_WAITING; i++)
+    {
+        TEST_ASSERT_EQUAL_INT16(1, broadcast(CANARD_TRANSFER_PRIORITY_LOW, 4, WAITING_DEADLINE_USEC));
+    }
+    canardPopTxQueue(&ins);
+    const uint32_t frames = queuedFrames();
+    TEST_ASSERT_EQUAL_UINT32((uint32_t) started_frames - 1U + NUM_WAITING, frames);
+
+    // The first cleanup past the started transfer's deadline scans the queue and keeps everything
+    canardCleanupStaleTransfers(&ins, STARTED_DEADLINE_USEC + 1U);
+    TEST_ASSERT_EQUAL_UINT32(frames, ins.statistics.cleanup_visited);
+    TEST_ASSERT_EQUAL_UINT32(0, ins.statistics.cleanup_removed);
+    TEST_ASSERT_EQUAL_UINT32(0, ins.statistics.tx_expired);
+    TEST_ASSERT_EQUAL_UINT32(frames, queuedFrames());
+
+    // Until the waiting transfers can expire, no cleanup looks at the queue again
+    for (uint64_t now_usec = STARTED_DEADLINE_USEC + 1000U; now_usec <= WAITING_DEADLINE_USEC; now_usec += 1000U)
+    {
+        canardCleanupStaleTransfers(&ins, now_usec);
+    }
+    TEST_ASSERT_EQUAL_UINT32(frames, ins.statistics.cleanup_visited);
+    TEST_ASSERT_EQUAL_UINT32(0, ins.statistics.cleanup_removed);
+
+    // Then one scan removes the waiting transfers and leaves the rest of the started one
+    canardCleanupStaleTransfers(&ins, WAITING_DEADLINE_USEC + 1U);
+    TEST_ASSERT_EQUAL_UINT32(2U * frames, ins.statistics.cleanup_visited);
+    TEST_ASSERT_EQUAL_UINT32(NUM_WAITING, ins.statistics.cleanup_removed);
+    TEST_ASSERT_EQUAL_UINT32(NUM_WAITING, ins.statistics.tx_expired);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t) started_frames - 1U, queuedFrames());
+
+    // Only the started transfer is left, and it bounds nothing
+    canardCleanupStaleTransfers(&ins, WAITING_DEADLINE_USEC + 2U);
+    canardCleanupStaleTransfers(&ins, UINT64_MAX);
+    TEST_ASSERT_EQUAL_UINT32(2U * frames, ins.statistics.cleanup_visited);
+}
+
+static void testNewTransferLowersTheBound(void)
+{
+    TEST_ASSERT_EQUAL_INT16(1, broadcast(CANARD_TRANSFER_PRIORITY_LOW, 4, WAITING_DEADLINE_USEC));
+    canardCleanupStaleTransfers(&ins, STARTED_DEADLINE_USEC);
+    TEST_ASSERT_EQUAL_UINT32(0, ins.statistics.cleanup_visited);
+
+    // A transfer queued later with an earlier deadline is still found in time
+    TEST_ASSERT_EQUAL_INT16(1, broadcast(CANARD_TRANSFER_PRIORITY_LOW, 4, 2U * STARTED_DEADLINE_USEC));
+    canardCleanupStaleTransfers(&ins, 2U * STARTED_DEADLINE_USEC + 1U);
+    TEST_ASSERT_EQUAL_UINT32(2, ins.statistics.cleanup_visited);
+    TEST_ASSERT_EQUAL_UINT32(1, ins.statistics.cleanup_removed);
+    TEST_ASSERT_EQUAL_UINT32(1, ins.statistics.tx_expired);
+    TEST_ASSERT_EQUAL_UINT32(1, queuedFrames());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testStartedTransferDoesNotHoldTheBound);
+    RUN_TEST(testNewTransferLowersTheBound);
+    return UNITY_END();
+}
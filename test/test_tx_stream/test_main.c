@@ -0,0 +1,620 @@
+/*
+ * TX streams: transfers written through a stream in random chunks and as bit fields come out frame for frame the same
+ * as from canardBroadcastObj() and canardRequestOrRespondObj(), anonymous transfers keep their single frame limit,
+ * failed and aborted streams give their frames back, and the cost of both ways is measured. Field by field writers
+ * for uavcan.equipment.power.BatteryInfo and uavcan.equipment.gnss.Fix2 must give the frames of the generated encoders,
+ * at no more cost than encoding into a buffer and sending it with canardBroadcastObj().
+ */
+#include <unity.h>
+#include <canard_internals.h>
+#include <uavcan.equipment.gnss.Fix2.h>
+#include <uavcan.equipment.power.BatteryInfo.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_ROUNDS        20000U
+#define BENCHMARK_RUNS          8U
+#define SIGNATURE               0xEE468A8121C46A9EULL
+#define DATA_TYPE_ID            1092U
+#define SERVICE_TYPE_ID         11U
+#define MAX_PAYLOAD             300U
+
+static uint8_t reference_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static uint8_t stream_pool[200U * CANARD_MEM_BLOCK_SIZE];
+static CanardInstance reference;
+static CanardInstance streamed;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static void initInstances(uint8_t node_id)
+{
+    canardInit(&reference, reference_pool, sizeof(reference_pool), NULL, NULL, NULL);
+    canardInit(&streamed, stream_pool, sizeof(stream_pool), NULL, NULL, NULL);
+    if (node_id != 0)
+    {
+        canardSetLocalNodeID(&reference, node_id);
+        canardSetLocalNodeID(&streamed, node_id);
+    }
+}
+
+void setUp(void)
+{
+    initInstances(5);
+}
+
+void tearDown(void)
+{
+}
+
+static CanardTxTransfer makeTransfer(CanardTransferType transfer_type, uint8_t* transfer_id, bool canfd)
+{
+    CanardTxTransfer transfer;
+    canardInitTxTransfer(&transfer);
+    transfer.transfer_type = transfer_type;
+    transfer.data_type_signature = SIGNATURE;
+    transfer.data_type_id = (transfer_type == CanardTransferTypeBroadcast) ? DATA_TYPE_ID : SERVICE_TYPE_ID;
+    transfer.inout_transfer_id = transfer_id;
+    transfer.priority = CANARD_TRANSFER_PRIORITY_MEDIUM;
+#if CANARD_MULTI_IFACE
+    transfer.iface_mask = (uint8_t)((1U << CANARD_NUM_IFACES) - 1U);
+#endif
+#if CANARD_ENABLE_CANFD
+    transfer.canfd = canfd;
+#else
+    (void) canfd;
+#endif
+    return transfer;
+}
+
+static const CanardCANFrame* peekQueue(const CanardInstance* instance, uint8_t iface)
+{
+#if CANARD_MULTI_IFACE
+    return canardPeekTxQueueIface(instance, iface);
+#else
+    (void) iface;
+    return canardPeekTxQueue(instance);
+#endif
+}
+
+static void popQueue(CanardInstance* instance, uint8_t iface)
+{
+#if CANARD_MULTI_IFACE
+    canardPopTxQueueIface(instance, iface);
+#else
+    (void) iface;
+    canardPopTxQueue(instance);
+#endif
+}
+
+static void drainQueues(CanardInstance* instance)
+{
+    for (uint8_t iface = 0; iface < CANARD_NUM_IFACES; iface++)
+    {
+        while (peekQueue(instance, iface) != NULL)
+        {
+            popQueue(instance, iface);
+        }
+    }
+}
+
+/// Pops the TX queues of both instances and checks that they held the same frames
+static void checkSameFrames(void)
+{
+    for (uint8_t iface = 0; iface < CANARD_NUM_IFACES; iface++)
+    {
+        const CanardCANFrame* expected;
+        while ((expected = peekQueue(&reference, iface)) != NULL)
+        {
+            const CanardCANFrame* const actual = peekQueue(&streamed, iface);
+            TEST_ASSERT_NOT_NULL(actual);
+            TEST_ASSERT_EQUAL_HEX32(expected->id, actual->id);
+            TEST_ASSERT_EQUAL_UINT8(expected->data_len, actual->data_len);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected->data, actual->data, expected->data_len);
+            popQueue(&reference, iface);
+            popQueue(&streamed, iface);
+        }
+        TEST_ASSERT_NULL(peekQueue(&streamed, iface));
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, streamed.allocator.statistics.current_usage_blocks);
+}
+
+/// Sends a payload both ways, through the stream in random chunks
+static void sendBothWays(CanardTransferType transfer_type, bool canfd, const uint8_t* payload, uint16_t len)
+{
+    uint8_t reference_tid = 7;
+    uint8_t stream_tid = 7;
+
+    CanardTxTransfer transfer = makeTransfer(transfer_type, &reference_tid, canfd);
+    transfer.payload = payload;
+    transfer.payload_len = len;
+    const int16_t expected = (transfer_type == CanardTransferTypeBroadcast) ?
+                             canardBroadcastObj(&reference, &transfer) :
+                             canardRequestOrRespondObj(&reference, 42, &transfer);
+
+    const CanardTxTransfer stream_transfer = makeTransfer(transfer_type, &stream_tid, canfd);
+    CanardTxStream stream;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &stream_transfer, 42));
+    uint16_t written = 0;
+    while (written < len)
+    {
+        uint16_t chunk = (uint16_t)(rand() % 20);
+        if (chunk > len - written)
+        {
+            chunk = (uint16_t)(len - written);
+        }
+        canardTxStreamWrite(&stream, &payload[written], chunk);
+        written = (uint16_t)(written + chunk);
+    }
+    TEST_ASSERT_EQUAL_INT16(expected, canardTxStreamCommit(&stream));
+    TEST_ASSERT_EQUAL_UINT8(reference_tid, stream_tid);
+    checkSameFrames();
+}
+
+static void testStreamMatchesObj(void)
+{
+    static const CanardTransferType Types[] = {
+        CanardTransferTypeBroadcast, CanardTransferTypeRequest, CanardTransferTypeResponse
+    };
+    uint8_t payload[MAX_PAYLOAD];
+    srand(1);
+
+    for (uint16_t len = 0; len <= MAX_PAYLOAD; len++)
+    {
+        for (uint16_t i = 0; i < len; i++)
+        {
+            payload[i] = (uint8_t) rand();
+        }
+        for (uint8_t t = 0; t < sizeof(Types) / sizeof(Types[0]); t++)
+        {
+            sendBothWays(Types[t], false, payload, len);
+#if CANARD_ENABLE_CANFD
+            sendBothWays(Types[t], true, payload, len);
+#endif
+        }
+    }
+}
+
+static void testScalarsMatchEncode(void)
+{
+    uint8_t payload[MAX_PAYLOAD] = {0};
+    uint8_t stream_tid = 0;
+    uint8_t reference_tid = 0;
+    uint32_t bit_offset = 0;
+    srand(2);
+
+    const CanardTxTransfer stream_transfer = makeTransfer(CanardTransferTypeBroadcast, &stream_tid, false);
+    CanardTxStream stream;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &stream_transfer, 0));
+
+    while (bit_offset < (MAX_PAYLOAD - 9U) * 8U)
+    {
+        const uint8_t bit_length = (uint8_t)(1 + (rand() % 64));
+        const uint64_t value = ((uint64_t) rand() << 33U) ^ ((uint64_t) rand() << 11U) ^ (uint64_t) rand();
+        const bool flag = (value & 1U) != 0;                                // Single bits are read as bool
+        const void* const field = (bit_length == 1) ? (const void*) &flag : (const void*) &value;
+        canardEncodeScalar(payload, bit_offset, bit_length, field);
+        canardTxStreamEncodeScalar(&stream, bit_length, field);
+        bit_offset += bit_length;
+        if ((rand() % 8) == 0)                                              // Bytes in between, off the byte boundary
+        {
+            const uint8_t byte = (uint8_t) rand();
+            canardEncodeScalar(payload, bit_offset, 8, &byte);
+            canardTxStreamWrite(&stream, &byte, 1);
+            bit_offset += 8U;
+        }
+    }
+
+    CanardTxTransfer transfer = makeTransfer(CanardTransferTypeBroadcast, &reference_tid, false);
+    transfer.payload = payload;
+    transfer.payload_len = (uint16_t)((bit_offset + 7U) / 8U);
+    TEST_ASSERT_EQUAL_INT16(canardBroadcastObj(&reference, &transfer), canardTxStreamCommit(&stream));
+    checkSameFrames();
+}
+
+static void testAnonymous(void)
+{
+    initInstances(0);
+    const uint8_t payload[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t tid = 0;
+
+    // Single frame: the discriminator is worked out from the payload on commit
+    CanardTxTransfer transfer = makeTransfer(CanardTransferTypeBroadcast, &tid, false);
+    transfer.data_type_id = 3;
+    transfer.payload = payload;
+    transfer.payload_len = 7;
+    TEST_ASSERT_EQUAL_INT16(1, canardBroadcastObj(&reference, &transfer));
+    tid = 0;
+    CanardTxStream stream;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &transfer, 0));
+    canardTxStreamWrite(&stream, payload, 7);
+    TEST_ASSERT_EQUAL_INT16(1, canardTxStreamCommit(&stream));
+    checkSameFrames();
+
+    // One byte more would need a node ID
+    tid = 0;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &transfer, 0));
+    canardTxStreamWrite(&stream, payload, 8);
+    TEST_ASSERT_EQUAL_UINT16(0, streamed.allocator.statistics.current_usage_blocks);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_NODE_ID_NOT_SET, canardTxStreamCommit(&stream));
+    TEST_ASSERT_EQUAL_UINT8(0, tid);
+
+    // Services need a node ID from the start, as do messages whose type ID does not fit
+    transfer.transfer_type = CanardTransferTypeRequest;
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_NODE_ID_NOT_SET, canardTxStreamBegin(&stream, &streamed, &transfer, 42));
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_NODE_ID_NOT_SET, canardTxStreamCommit(&stream));
+    transfer.transfer_type = CanardTransferTypeBroadcast;
+    transfer.data_type_id = DATA_TYPE_ID;
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardTxStreamBegin(&stream, &streamed, &transfer, 0));
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_INVALID_ARGUMENT, canardTxStreamCommit(&stream));
+    TEST_ASSERT_EQUAL_UINT16(0, streamed.allocator.statistics.current_usage_blocks);
+}
+
+static void testAbortAndOutOfMemory(void)
+{
+    static uint8_t small_pool[8U * CANARD_MEM_BLOCK_SIZE];
+    const uint8_t payload[MAX_PAYLOAD] = {0};
+    uint8_t tid = 0;
+    const CanardTxTransfer transfer = makeTransfer(CanardTransferTypeBroadcast, &tid, false);
+    CanardTxStream stream;
+
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &transfer, 0));
+    canardTxStreamWrite(&stream, payload, 100);
+    TEST_ASSERT_GREATER_THAN_UINT16(1, streamed.allocator.statistics.current_usage_blocks);
+    canardTxStreamAbort(&stream);
+    TEST_ASSERT_EQUAL_UINT16(0, streamed.allocator.statistics.current_usage_blocks);
+    TEST_ASSERT_NULL(peekQueue(&streamed, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, tid);
+
+    // The pool runs out halfway through: nothing is queued and every frame comes back
+    canardInit(&streamed, small_pool, sizeof(small_pool), NULL, NULL, NULL);
+    canardSetLocalNodeID(&streamed, 5);
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &transfer, 0));
+    canardTxStreamWrite(&stream, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL_UINT16(0, streamed.allocator.statistics.current_usage_blocks);
+    TEST_ASSERT_EQUAL_INT16(-CANARD_ERROR_OUT_OF_MEMORY, canardTxStreamCommit(&stream));
+    TEST_ASSERT_NULL(peekQueue(&streamed, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, tid);
+
+    // A transfer that fits still goes out afterwards
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(&stream, &streamed, &transfer, 0));
+    canardTxStreamWrite(&stream, payload, 20);
+    TEST_ASSERT_EQUAL_INT16(4, canardTxStreamCommit(&stream));
+    TEST_ASSERT_EQUAL_UINT8(1, tid);
+}
+
+static void writeFloat16(CanardTxStream* stream, float value)
+{
+    const uint16_t float16 = canardConvertNativeFloatToFloat16(value);
+    canardTxStreamEncodeScalar(stream, 16, &float16);
+}
+
+/// Writes uavcan.equipment.power.BatteryInfo the way src/main.cpp does, with tail array optimization
+static void writeBatteryInfo(CanardTxStream* stream, const struct uavcan_equipment_power_BatteryInfo* msg)
+{
+    writeFloat16(stream, msg->temperature);
+    writeFloat16(stream, msg->voltage);
+    writeFloat16(stream, msg->current);
+    writeFloat16(stream, msg->average_power_10sec);
+    writeFloat16(stream, msg->remaining_capacity_wh);
+    writeFloat16(stream, msg->full_charge_capacity_wh);
+    writeFloat16(stream, msg->hours_to_full_charge);
+    canardTxStreamEncodeScalar(stream, 11, &msg->status_flags);
+    canardTxStreamEncodeScalar(stream, 7, &msg->state_of_health_pct);
+    canardTxStreamEncodeScalar(stream, 7, &msg->state_of_charge_pct);
+    canardTxStreamEncodeScalar(stream, 7, &msg->state_of_charge_pct_stdev);
+    canardTxStreamEncodeScalar(stream, 8, &msg->battery_id);
+    canardTxStreamEncodeScalar(stream, 32, &msg->model_instance_id);
+    canardTxStreamWrite(stream, msg->model_name.data, msg->model_name.len);
+}
+
+/// Writes uavcan.equipment.gnss.Fix2, with tail array optimization
+static void writeFix2(CanardTxStream* stream, const struct uavcan_equipment_gnss_Fix2* msg)
+{
+    const uint16_t reserved = 0;
+    canardTxStreamEncodeScalar(stream, 56, &msg->timestamp.usec);
+    canardTxStreamEncodeScalar(stream, 56, &msg->gnss_timestamp.usec);
+    canardTxStreamEncodeScalar(stream, 3, &msg->gnss_time_standard);
+    canardTxStreamEncodeScalar(stream, 13, &reserved);
+    canardTxStreamEncodeScalar(stream, 8, &msg->num_leap_seconds);
+    canardTxStreamEncodeScalar(stream, 37, &msg->longitude_deg_1e8);
+    canardTxStreamEncodeScalar(stream, 37, &msg->latitude_deg_1e8);
+    canardTxStreamEncodeScalar(stream, 27, &msg->height_ellipsoid_mm);
+    canardTxStreamEncodeScalar(stream, 27, &msg->height_msl_mm);
+    for (uint8_t i = 0; i < 3U; i++)
+    {
+        canardTxStreamEncodeScalar(stream, 32, &msg->ned_velocity[i]);
+    }
+    canardTxStreamEncodeScalar(stream, 6, &msg->sats_used);
+    canardTxStreamEncodeScalar(stream, 2, &msg->status);
+    canardTxStreamEncodeScalar(stream, 4, &msg->mode);
+    canardTxStreamEncodeScalar(stream, 6, &msg->sub_mode);
+    canardTxStreamEncodeScalar(stream, 6, &msg->covariance.len);
+    for (uint8_t i = 0; i < msg->covariance.len; i++)
+    {
+        writeFloat16(stream, msg->covariance.data[i]);
+    }
+    writeFloat16(stream, msg->pdop);
+    for (uint8_t k = 0; k < msg->ecef_position_velocity.len; k++)     // The tail array, without its length
+    {
+        const struct uavcan_equipment_gnss_ECEFPositionVelocity* const ecef = &msg->ecef_position_velocity.data[k];
+        for (uint8_t i = 0; i < 3U; i++)
+        {
+            canardTxStreamEncodeScalar(stream, 32, &ecef->velocity_xyz[i]);
+        }
+        for (uint8_t i = 0; i < 3U; i++)
+        {
+            canardTxStreamEncodeScalar(stream, 36, &ecef->position_xyz_mm[i]);
+        }
+        canardTxStreamEncodeScalar(stream, 6, &reserved);
+        canardTxStreamEncodeScalar(stream, 6, &ecef->covariance.len);
+        for (uint8_t i = 0; i < ecef->covariance.len; i++)
+        {
+            writeFloat16(stream, ecef->covariance.data[i]);
+        }
+    }
+}
+
+static void makeBatteryInfo(struct uavcan_equipment_power_BatteryInfo* msg, uint8_t model_name_len)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->temperature = 301.5F;
+    msg->voltage = 15.2F;
+    msg->current = -3.25F;
+    msg->average_power_10sec = 48.0F;
+    msg->remaining_capacity_wh = 120.0F;
+    msg->full_charge_capacity_wh = 180.0F;
+    msg->hours_to_full_charge = 1.5F;
+    msg->status_flags = 0x5A5U;
+    msg->state_of_health_pct = 97;
+    msg->state_of_charge_pct = 66;
+    msg->state_of_charge_pct_stdev = 3;
+    msg->battery_id = 2;
+    msg->model_instance_id = 0xDEADBEEFU;
+    msg->model_name.len = model_name_len;
+    for (uint8_t i = 0; i < model_name_len; i++)
+    {
+        msg->model_name.data[i] = (uint8_t)('A' + i);
+    }
+}
+
+static void makeFix2(struct uavcan_equipment_gnss_Fix2* msg, uint8_t covariance_len, bool with_ecef)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->timestamp.usec = 0x00123456789ABCULL;
+    msg->gnss_timestamp.usec = 0x00FEDCBA987654ULL;
+    msg->gnss_time_standard = 2;
+    msg->num_leap_seconds = 18;
+    msg->longitude_deg_1e8 = -12233365000LL;
+    msg->latitude_deg_1e8 = 4742075000LL;
+    msg->height_ellipsoid_mm = 56123;
+    msg->height_msl_mm = -1234;
+    msg->ned_velocity[0] = 1.25F;
+    msg->ned_velocity[1] = -0.5F;
+    msg->ned_velocity[2] = 0.125F;
+    msg->sats_used = 17;
+    msg->status = 3;
+    msg->mode = 2;
+    msg->sub_mode = 1;
+    msg->covariance.len = covariance_len;
+    for (uint8_t i = 0; i < covariance_len; i++)
+    {
+        msg->covariance.data[i] = 0.25F * (float) i;
+    }
+    msg->pdop = 1.4F;
+    msg->ecef_position_velocity.len = with_ecef ? 1U : 0U;
+    struct uavcan_equipment_gnss_ECEFPositionVelocity* const ecef = &msg->ecef_position_velocity.data[0];
+    for (uint8_t i = 0; i < 3U; i++)
+    {
+        ecef->velocity_xyz[i] = (float) i - 1.0F;
+        ecef->position_xyz_mm[i] = -4000000000LL + (int64_t) i * 1000000000LL;
+    }
+    ecef->covariance.len = 6;
+    for (uint8_t i = 0; i < 6U; i++)
+    {
+        ecef->covariance.data[i] = (float) i;
+    }
+}
+
+static uint32_t encodeBatteryInfo(struct uavcan_equipment_power_BatteryInfo* msg, uint8_t* buffer)
+{
+    return uavcan_equipment_power_BatteryInfo_encode(msg, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                                     , true
+#endif
+                                                     );
+}
+
+static uint32_t encodeFix2(struct uavcan_equipment_gnss_Fix2* msg, uint8_t* buffer)
+{
+    return uavcan_equipment_gnss_Fix2_encode(msg, buffer
+#if CANARD_ENABLE_TAO_OPTION
+                                             , true
+#endif
+                                             );
+}
+
+/// Broadcasts a payload encoded into a buffer, as the reference for a stream writer
+static int16_t broadcastBuffer(uint64_t signature, uint16_t data_type_id, uint8_t* transfer_id,
+                               const uint8_t* buffer, uint32_t len)
+{
+    CanardTxTransfer transfer = makeTransfer(CanardTransferTypeBroadcast, transfer_id, false);
+    transfer.data_type_signature = signature;
+    transfer.data_type_id = data_type_id;
+    transfer.payload = buffer;
+    transfer.payload_len = (uint16_t) len;
+    return canardBroadcastObj(&reference, &transfer);
+}
+
+static void beginMessage(CanardTxStream* stream, uint64_t signature, uint16_t data_type_id, uint8_t* transfer_id)
+{
+    CanardTxTransfer transfer = makeTransfer(CanardTransferTypeBroadcast, transfer_id, false);
+    transfer.data_type_signature = signature;
+    transfer.data_type_id = data_type_id;
+    TEST_ASSERT_EQUAL_INT16(CANARD_OK, canardTxStreamBegin(stream, &streamed, &transfer, 0));
+}
+
+static void testMessagesMatchGeneratedEncoders(void)
+{
+    uint8_t reference_tid = 0;
+    uint8_t stream_tid = 0;
+    CanardTxStream stream;
+
+    static const uint8_t ModelNameLengths[] = {0, 1, 9, 31};
+    for (uint8_t n = 0; n < sizeof(ModelNameLengths); n++)
+    {
+        struct uavcan_equipment_power_BatteryInfo battery;
+        uint8_t buffer[UAVCAN_EQUIPMENT_POWER_BATTERYINFO_MAX_SIZE];
+        makeBatteryInfo(&battery, ModelNameLengths[n]);
+        const int16_t expected = broadcastBuffer(UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE,
+                                                 UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID, &reference_tid,
+                                                 buffer, encodeBatteryInfo(&battery, buffer));
+        beginMessage(&stream, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID,
+                     &stream_tid);
+        writeBatteryInfo(&stream, &battery);
+        TEST_ASSERT_EQUAL_INT16(expected, canardTxStreamCommit(&stream));
+        checkSameFrames();
+    }
+
+    static const uint8_t CovarianceLengths[] = {0, 3, 9, 36};
+    for (uint8_t n = 0; n < sizeof(CovarianceLengths); n++)
+    {
+        for (uint8_t with_ecef = 0; with_ecef < 2U; with_ecef++)
+        {
+            struct uavcan_equipment_gnss_Fix2 fix;
+            uint8_t buffer[UAVCAN_EQUIPMENT_GNSS_FIX2_MAX_SIZE];
+            makeFix2(&fix, CovarianceLengths[n], with_ecef != 0U);
+            const int16_t expected = broadcastBuffer(UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE,
+                                                     UAVCAN_EQUIPMENT_GNSS_FIX2_ID, &reference_tid,
+                                                     buffer, encodeFix2(&fix, buffer));
+            beginMessage(&stream, UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE, UAVCAN_EQUIPMENT_GNSS_FIX2_ID, &stream_tid);
+            writeFix2(&stream, &fix);
+            TEST_ASSERT_EQUAL_INT16(expected, canardTxStreamCommit(&stream));
+            checkSameFrames();
+        }
+    }
+}
+
+/// What one benchmark round sends, on one path or the other
+typedef enum
+{
+    BenchmarkRawObj,
+    BenchmarkRawStream,
+    BenchmarkBatteryInfoObj,
+    BenchmarkBatteryInfoStream,
+    BenchmarkFix2Obj,
+    BenchmarkFix2Stream,
+    BenchmarkCount
+} Benchmark;
+
+static const uint8_t RawPayload[100] = {0x55};
+static struct uavcan_equipment_power_BatteryInfo benchmark_battery;
+static struct uavcan_equipment_gnss_Fix2 benchmark_fix;
+
+static void sendOnce(Benchmark benchmark, uint8_t* tid)
+{
+    CanardTxStream stream;
+    switch (benchmark)
+    {
+    case BenchmarkRawObj:
+        broadcastBuffer(SIGNATURE, DATA_TYPE_ID, tid, RawPayload, sizeof(RawPayload));
+        break;
+    case BenchmarkRawStream:
+        beginMessage(&stream, SIGNATURE, DATA_TYPE_ID, tid);
+        for (uint8_t i = 0; i < sizeof(RawPayload); i += 4)
+        {
+            canardTxStreamWrite(&stream, &RawPayload[i], 4);                // As a field by field encoder would
+        }
+        canardTxStreamCommit(&stream);
+        break;
+    case BenchmarkBatteryInfoObj:
+    {
+        uint8_t buffer[UAVCAN_EQUIPMENT_POWER_BATTERYINFO_MAX_SIZE];
+        broadcastBuffer(UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID, tid,
+                        buffer, encodeBatteryInfo(&benchmark_battery, buffer));
+        break;
+    }
+    case BenchmarkBatteryInfoStream:
+        beginMessage(&stream, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_SIGNATURE, UAVCAN_EQUIPMENT_POWER_BATTERYINFO_ID, tid);
+        writeBatteryInfo(&stream, &benchmark_battery);
+        canardTxStreamCommit(&stream);
+        break;
+    case BenchmarkFix2Obj:
+    {
+        uint8_t buffer[UAVCAN_EQUIPMENT_GNSS_FIX2_MAX_SIZE];
+        broadcastBuffer(UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE, UAVCAN_EQUIPMENT_GNSS_FIX2_ID, tid,
+                        buffer, encodeFix2(&benchmark_fix, buffer));
+        break;
+    }
+    case BenchmarkFix2Stream:
+        beginMessage(&stream, UAVCAN_EQUIPMENT_GNSS_FIX2_SIGNATURE, UAVCAN_EQUIPMENT_GNSS_FIX2_ID, tid);
+        writeFix2(&stream, &benchmark_fix);
+        canardTxStreamCommit(&stream);
+        break;
+    default:
+        TEST_FAIL();
+        break;
+    }
+}
+
+static void testBenchmark(void)
+{
+    makeBatteryInfo(&benchmark_battery, 0);
+    makeFix2(&benchmark_fix, 0, false);
+    uint8_t tid = 0;
+    double best_ns[BenchmarkCount];
+
+    // The runs of each path are interleaved and the fastest is kept, so that a busy host skews neither path
+    for (uint8_t b = 0; b < BenchmarkCount; b++)
+    {
+        best_ns[b] = 1e9;
+    }
+    for (uint8_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        for (uint8_t b = 0; b < BenchmarkCount; b++)
+        {
+            const bool obj = (b % 2U) == 0U;
+            const double start = nowSeconds();
+            for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+            {
+                sendOnce((Benchmark) b, &tid);
+                drainQueues(obj ? &reference : &streamed);
+            }
+            const double ns = (nowSeconds() - start) * 1e9 / BENCHMARK_ROUNDS;
+            best_ns[b] = (ns < best_ns[b]) ? ns : best_ns[b];
+        }
+    }
+
+    char message[160];
+    snprintf(message, sizeof(message), "100 byte broadcast: canardBroadcastObj %.0f ns, stream in 4 byte writes %.0f ns",
+             best_ns[BenchmarkRawObj], best_ns[BenchmarkRawStream]);
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "BatteryInfo: encode + canardBroadcastObj %.0f ns with a %u byte buffer, "
+             "stream %.0f ns with a %u byte CanardTxStream",
+             best_ns[BenchmarkBatteryInfoObj], (unsigned) UAVCAN_EQUIPMENT_POWER_BATTERYINFO_MAX_SIZE,
+             best_ns[BenchmarkBatteryInfoStream], (unsigned) sizeof(CanardTxStream));
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Fix2: encode + canardBroadcastObj %.0f ns with a %u byte buffer, "
+             "stream %.0f ns with a %u byte CanardTxStream",
+             best_ns[BenchmarkFix2Obj], (unsigned) UAVCAN_EQUIPMENT_GNSS_FIX2_MAX_SIZE,
+             best_ns[BenchmarkFix2Stream], (unsigned) sizeof(CanardTxStream));
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(testStreamMatchesObj);
+    RUN_TEST(testScalarsMatchEncode);
+    RUN_TEST(testAnonymous);
+    RUN_TEST(testAbortAndOutOfMemory);
+    RUN_TEST(testMessagesMatchGeneratedEncoders);
+    RUN_TEST(testBenchmark);
+    return UNITY_END();
+}